@@ -340,6 +340,9 @@ typedef struct mi_page_s {
 #ifdef Py_GIL_DISABLED
   struct llist_node     qsbr_node;
   uint64_t              qsbr_goal;
+  // Has GC objects allocated since the last young collection.  Not a bit in
+  // the bitfields above: threads that do not own the page set it.
+  uint8_t               gc_young;
 #endif
 
   // 64-bit 9 words, 32-bit 12 words, (+2 for secure)
@@ -103,6 +103,14 @@ extern int _PyPerfTrampoline_Fini(void);
 extern void _PyPerfTrampoline_FreeArenas(void);
 extern int _PyIsPerfTrampolineActive(void);
 extern PyStatus _PyPerfTrampoline_AfterFork_Child(void);
+
+// Sampling profiler (Python/sampling_profiler.c)
+extern int _PySamplingProfiler_Start(PyTime_t interval);
+extern int _PySamplingProfiler_Stop(void);
+extern PyObject* _PySamplingProfiler_Dump(int clear);
+extern void _PySamplingProfiler_TakeSample(PyThreadState *tstate);
+extern void _PySamplingProfiler_Fini(void);
+extern void _PySamplingProfiler_AfterFork_Child(void);
 #ifdef PY_HAVE_PERF_TRAMPOLINE
 extern _PyPerf_Callbacks _Py_perfmap_callbacks;
 extern _PyPerf_Callbacks _Py_perfmap_jit_callbacks;
@@ -296,9 +304,11 @@ _Py_Check_ArgsIterable(PyThreadState *tstate, PyObject *func, PyObject *args);
 #define _PY_EVAL_PLEASE_STOP_BIT (1U << 5)
 #define _PY_EVAL_EXPLICIT_MERGE_BIT (1U << 6)
 #define _PY_EVAL_JIT_INVALIDATE_COLD_BIT (1U << 7)
+#define _PY_EVAL_SAMPLE_BIT (1U << 8)
+#define _PY_EVAL_PURGE_MEMORY_BIT (1U << 9)
 
 /* Reserve a few bits for future use */
-#define _PY_EVAL_EVENTS_BITS 8
+#define _PY_EVAL_EVENTS_BITS 10
 #define _PY_EVAL_EVENTS_MASK ((1 << _PY_EVAL_EVENTS_BITS)-1)
 
 static inline void
@@ -326,6 +336,7 @@ void _Py_set_eval_breaker_bit_all(PyInterpreterState *interp, uintptr_t bit);
 void _Py_unset_eval_breaker_bit_all(PyInterpreterState *interp, uintptr_t bit);
 
 PyAPI_FUNC(PyObject *) _PyFloat_FromDouble_ConsumeInputs(_PyStackRef left, _PyStackRef right, double value);
+PyAPI_FUNC(int) _PyFloat_StoreDouble_ConsumeInputs(_PyStackRef *target, _PyStackRef left, _PyStackRef right, double value);
 
 
 #ifdef __cplusplus
@@ -8,7 +8,8 @@ extern "C" {
 #  error "this header requires Py_BUILD_CORE define"
 #endif
 
-#include "pycore_lock.h"            // PyMutex
+#include "pycore_lock.h"            // PyMutex, PyEvent
+#include "pycore_pythread.h"        // PyThread_handle_t
 #include "pycore_gil.h"             // struct _gil_runtime_state
 
 
@@ -101,6 +102,19 @@ struct _ceval_runtime_state {
     // for the list of pending calls.
     struct _pending_calls pending_mainthread;
     PyMutex sys_trace_profile_mutex;
+    /* The in-process sampling profiler (Python/sampling_profiler.c). */
+    struct {
+        // Serializes starting and stopping the sampler thread.
+        PyMutex control;
+        int active;
+        PyTime_t interval;
+        PyThread_handle_t handle;
+        PyEvent stop;
+        // Protects samples, a hash table mapping each sampled stack to
+        // its count.
+        PyMutex mutex;
+        struct _Py_hashtable_t *samples;
+    } sampling;
 };
 
 
@@ -356,6 +356,18 @@ extern void _Py_Specialize_Send(_PyStackRef receiver, _Py_CODEUNIT *instr);
 extern void _Py_Specialize_ToBool(_PyStackRef value, _Py_CODEUNIT *instr);
 extern void _Py_Specialize_ContainsOp(_PyStackRef value, _Py_CODEUNIT *instr);
 
+// A site of a specialization profile, in the form _PyCode_Quicken() takes.
+typedef struct {
+    int index;          // of the instruction, in code units
+    uint8_t opcode;
+    uint8_t backoff;
+} _PyProfileSite;
+
+// Export for '_opcode' shared extension
+PyAPI_FUNC(PyObject *) _PyCode_GetSpecializationProfile(PyCodeObject *co);
+PyAPI_FUNC(Py_ssize_t) _PyCode_ApplySpecializationProfile(PyCodeObject *co,
+                                                           PyObject *profile);
+
 #ifdef Py_STATS
 
 #include "pycore_bitutils.h"  // _Py_bit_length
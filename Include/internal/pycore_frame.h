@@ -26,6 +26,7 @@ struct _frame {
     int f_lineno;               /* Current line number. Only valid if non-zero */
     char f_trace_lines;         /* Emit per-line trace events? */
     char f_trace_opcodes;       /* Emit per-opcode trace events? */
+    int8_t f_size_class;        /* Freelist size class, or -1 */
     PyObject *f_extra_locals;   /* Dict for locals set by users using f_locals, could be NULL */
     /* This is purely for backwards compatibility for PyEval_GetLocals.
        PyEval_GetLocals requires a borrowed reference so the actual reference
@@ -30,15 +30,17 @@ _Py_freelists_GET(void)
 
 // Pushes `op` to the freelist, calls `freefunc` if the freelist is full
 #define _Py_FREELIST_FREE(NAME, op, freefunc) \
-    _PyFreeList_Free(&_Py_freelists_GET()->NAME, _PyObject_CAST(op), \
-                     Py_ ## NAME ## _MAXFREELIST, freefunc)
+    _PyFreeList_Free(&_Py_freelists_GET()->NAME, _PyObject_CAST(op), freefunc)
 // Pushes `op` to the freelist, returns 1 if successful, 0 if the freelist is full
-#define _Py_FREELIST_PUSH(NAME, op, limit) \
-    _PyFreeList_Push(&_Py_freelists_GET()->NAME, _PyObject_CAST(op), limit)
+#define _Py_FREELIST_PUSH(NAME, op) \
+    _PyFreeList_Push(&_Py_freelists_GET()->NAME, _PyObject_CAST(op))
 
 // Pops a PyObject from the freelist, returns NULL if the freelist is empty.
 #define _Py_FREELIST_POP(TYPE, NAME) \
     _Py_CAST(TYPE*, _PyFreeList_Pop(&_Py_freelists_GET()->NAME))
+// Same as _Py_FREELIST_POP(), for objects of GC types.
+#define _Py_FREELIST_POP_GC(TYPE, NAME) \
+    _Py_CAST(TYPE*, _PyFreeList_PopGC(&_Py_freelists_GET()->NAME))
 
 // Pops a non-PyObject data structure from the freelist, returns NULL if the
 // freelist is empty.
@@ -48,23 +50,23 @@ _Py_freelists_GET(void)
 #define _Py_FREELIST_SIZE(NAME) (int)((_Py_freelists_GET()->NAME).size)
 
 static inline int
-_PyFreeList_Push(struct _Py_freelist *fl, void *obj, Py_ssize_t maxsize)
+_PyFreeList_Push(struct _Py_freelist *fl, void *obj)
 {
-    if (fl->size < maxsize && fl->size >= 0) {
+    if (fl->size < fl->maxsize && fl->size >= 0) {
         *(void **)obj = fl->freelist;
         fl->freelist = obj;
         fl->size++;
         OBJECT_STAT_INC(to_freelist);
         return 1;
     }
+    fl->overflows++;
     return 0;
 }
 
 static inline void
-_PyFreeList_Free(struct _Py_freelist *fl, void *obj, Py_ssize_t maxsize,
-                 freefunc dofree)
+_PyFreeList_Free(struct _Py_freelist *fl, void *obj, freefunc dofree)
 {
-    if (!_PyFreeList_Push(fl, obj, maxsize)) {
+    if (!_PyFreeList_Push(fl, obj)) {
         dofree(obj);
     }
 }
@@ -86,9 +88,28 @@ _PyFreeList_Pop(struct _Py_freelist *fl)
 {
     PyObject *op = _PyFreeList_PopNoStats(fl);
     if (op != NULL) {
+        fl->hits++;
         OBJECT_STAT_INC(from_freelist);
         _Py_NewReference(op);
     }
+    else {
+        fl->misses++;
+    }
+    return op;
+}
+
+static inline PyObject *
+_PyFreeList_PopGC(struct _Py_freelist *fl)
+{
+    PyObject *op = _PyFreeList_Pop(fl);
+#ifdef Py_GIL_DISABLED
+    if (op != NULL) {
+        // A reused object is new to the GC, like a freshly allocated one:
+        // include it in the next young collection.
+        assert(_PyObject_IS_GC(op));
+        _Py_atomic_store_uint8_relaxed(&_mi_ptr_page(op)->gc_young, 1);
+    }
+#endif
     return op;
 }
 
@@ -97,11 +118,36 @@ _PyFreeList_PopMem(struct _Py_freelist *fl)
 {
     void *op = _PyFreeList_PopNoStats(fl);
     if (op != NULL) {
+        fl->hits++;
         OBJECT_STAT_INC(from_freelist);
     }
+    else {
+        fl->misses++;
+    }
     return op;
 }
 
+// Set the limits of the freelists to those of *limits*, or to their defaults
+// if *limits* is NULL.
+extern void _PyObject_InitFreeLists(struct _Py_freelists *freelists,
+                                    const struct _Py_freelists *limits);
+
+// Add the statistics of the freelists of an exiting thread to those of its
+// interpreter.
+extern void _PyObject_MergeFreeListStats(PyInterpreterState *interp,
+                                         struct _Py_freelists *freelists);
+
+// Set the limit of the freelists called *name* in all threads of *interp*,
+// freeing the items beyond it.  Return -1 with an exception set if *name* is
+// unknown or *limit* is negative.
+extern int _PyObject_SetFreeListLimit(PyInterpreterState *interp,
+                                      const char *name, Py_ssize_t limit);
+
+// Return a dict mapping the name of each kind of freelist to a dict with its
+// limit, its current size and its hits, misses and overflows, summed over
+// all threads of *interp*.
+extern PyObject* _PyObject_GetFreeListStats(PyInterpreterState *interp);
+
 extern void _PyObject_ClearFreeLists(struct _Py_freelists *freelists, int is_finalization);
 
 #ifdef __cplusplus
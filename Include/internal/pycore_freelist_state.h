@@ -8,8 +8,11 @@ extern "C" {
 #  error "this header requires Py_BUILD_CORE define"
 #endif
 
+// Default limits of the freelists, see sys._set_freelist_limit().
 #  define PyTuple_MAXSAVESIZE 20     // Largest tuple to save on freelist
 #  define Py_tuple_MAXFREELIST 2000  // Maximum number of tuples of each size to save
+#  define PyBytes_MAXSAVESIZE 16     // Largest bytes object to save on freelist
+#  define Py_bytes_MAXFREELIST 80    // Maximum number of bytes of each size to save
 #  define Py_lists_MAXFREELIST 80
 #  define Py_dicts_MAXFREELIST 80
 #  define Py_dictkeys_MAXFREELIST 80
@@ -21,6 +24,16 @@ extern "C" {
 #  define Py_futureiters_MAXFREELIST 255
 #  define Py_object_stack_chunks_MAXFREELIST 4
 #  define Py_unicode_writers_MAXFREELIST 1
+#  define Py_ints_MAXFREELIST 100
+#  define Py_methods_MAXFREELIST 20
+#  define Py_frames_MAXFREELIST 20
+#  define Py_cells_MAXFREELIST 80
+
+// Frame objects are recycled by size class: class i holds frames with
+// Py_FRAME_FREELIST_MIN_SLOTS << i slots, and smaller frames are allocated
+// with the slots of their class.  Larger frames are not recycled.
+#  define Py_FRAME_FREELIST_MIN_SLOTS 8
+#  define Py_FRAME_FREELIST_CLASSES 3
 
 // A generic freelist of either PyObjects or other data structures.
 struct _Py_freelist {
@@ -31,6 +44,18 @@ struct _Py_freelist {
 
     // The number of items in the free list or -1 if the free list is disabled
     Py_ssize_t size;
+
+    // The maximum number of items, set at runtime by _PyObject_InitFreeLists()
+    // and _PyObject_SetFreeListLimit().
+    Py_ssize_t maxsize;
+
+    // Pops that found an item (hits) or an empty list (misses), and pushes
+    // that found a full list (overflows).  Counted in all builds: the
+    // freelists are per-thread (or under the GIL), so each count is a plain
+    // increment.
+    Py_ssize_t hits;
+    Py_ssize_t misses;
+    Py_ssize_t overflows;
 };
 
 struct _Py_freelists {
@@ -46,6 +71,11 @@ struct _Py_freelists {
     struct _Py_freelist futureiters;
     struct _Py_freelist object_stack_chunks;
     struct _Py_freelist unicode_writers;
+    struct _Py_freelist ints;
+    struct _Py_freelist methods;
+    struct _Py_freelist frames[Py_FRAME_FREELIST_CLASSES];
+    struct _Py_freelist cells;
+    struct _Py_freelist bytes[PyBytes_MAXSAVESIZE];
 };
 
 #ifdef __cplusplus
@@ -8,6 +8,8 @@ extern "C" {
 #  error "this header requires Py_BUILD_CORE define"
 #endif
 
+#include "pycore_bitutils.h"      // _Py_bit_length()
+
 /* GC information is stored BEFORE the object structure. */
 typedef struct {
     // Pointer to next object in the list.
@@ -52,6 +54,7 @@ static inline PyObject* _Py_FROM_GC(PyGC_Head *gc) {
 #  define _PyGC_BITS_SHARED         (16)
 #  define _PyGC_BITS_SHARED_INLINE  (32)
 #  define _PyGC_BITS_DEFERRED       (64)    // Use deferred reference counting
+#  define _PyGC_BITS_OLD            (128)   // Survived a collection
 #endif
 
 #ifdef Py_GIL_DISABLED
@@ -237,6 +240,10 @@ static inline void _PyGC_CLEAR_FINALIZED(PyObject *op) {
 /* If we change this, we need to change the default value in the
    signature of gc.collect. */
 #define NUM_GENERATIONS 3
+
+/* Default for parallel_threshold. */
+#define _PyGC_PARALLEL_THRESHOLD 100000
+
 /*
    NOTE: about untracking of mutable objects.
 
@@ -285,13 +292,34 @@ struct gc_generation {
                   generations */
 };
 
+/* Phases of a collection whose durations are recorded in the stats */
+typedef enum {
+    _PyGC_PHASE_UPDATE_REFS,
+    _PyGC_PHASE_SUBTRACT_REFS,
+    _PyGC_PHASE_MOVE_UNREACHABLE,
+    _PyGC_PHASE_FINALIZE,
+    _PyGC_PHASE_DELETE,
+    _PyGC_PHASES
+} _PyGC_Phase;
+
 struct gc_collection_stats {
     /* number of collected objects */
     Py_ssize_t collected;
     /* total number of uncollectable objects (put into gc.garbage) */
     Py_ssize_t uncollectable;
+    /* number of objects examined */
+    Py_ssize_t visited;
+    /* time spent in each phase */
+    PyTime_t phase_times[_PyGC_PHASES];
+    /* time spent in the whole collection */
+    PyTime_t duration;
 };
 
+/* Collection durations are counted in a histogram with four buckets per
+   power of two microseconds, so percentiles derived from it are accurate
+   to within 25%.  The last bucket also counts everything longer. */
+#define _PyGC_DURATION_BUCKETS 112
+
 /* Running stats per generation */
 struct gc_generation_stats {
     /* total number of collections */
@@ -300,8 +328,54 @@ struct gc_generation_stats {
     Py_ssize_t collected;
     /* total number of uncollectable objects (put into gc.garbage) */
     Py_ssize_t uncollectable;
+    /* total number of objects examined */
+    Py_ssize_t visited;
+    /* total time spent in each phase */
+    PyTime_t phase_times[_PyGC_PHASES];
+    /* histogram of collection durations, see _PyGC_DurationBucket() */
+    Py_ssize_t durations[_PyGC_DURATION_BUCKETS];
 };
 
+// Return the index of the durations bucket counting a collection that
+// took `duration` nanoseconds.
+static inline int
+_PyGC_DurationBucket(PyTime_t duration)
+{
+    PyTime_t us = duration / 1000;
+    if (us < 4) {
+        return us < 0 ? 0 : (int)us;
+    }
+    us = Py_MIN(us, (PyTime_t)1 << 30);
+    // Keep the three most significant bits: the leading one selects the
+    // power of two and the other two the quarter within it.
+    int shift = _Py_bit_length((unsigned long)us) - 3;
+    int bucket = 4 * shift + (int)(us >> shift);
+    return Py_MIN(bucket, _PyGC_DURATION_BUCKETS - 1);
+}
+
+// Add the time elapsed since *start to phase_times[phase] and start
+// timing the next phase.
+static inline void
+_PyGC_EndPhase(PyTime_t *phase_times, _PyGC_Phase phase, PyTime_t *start)
+{
+    PyTime_t now;
+    // ignore error: don't interrupt the GC if reading the clock fails
+    (void)PyTime_PerfCounterRaw(&now);
+    phase_times[phase] += now - *start;
+    *start = now;
+}
+
+// Return the exclusive upper bound of a durations bucket in microseconds.
+static inline double
+_PyGC_DurationBucketLimit(int bucket)
+{
+    int next = bucket + 1;
+    if (next < 4) {
+        return next;
+    }
+    return (double)(4 + next % 4) * (double)((PyTime_t)1 << (next / 4 - 1));
+}
+
 struct _gc_runtime_state {
     /* List of objects that still need to be cleaned up, singly linked
      * via their gc headers' gc_prev pointers.  */
@@ -330,6 +404,20 @@ struct _gc_runtime_state {
     /* Which of the old spaces is the visited space */
     int visited_space;
 
+    /* Target duration of an incremental collection, or zero to size
+       increments by work_to_do alone.  Only used by the default build. */
+    PyTime_t increment_budget;
+    /* Smoothed number of objects an incremental collection examines per
+       second, used to turn increment_budget into a number of objects. */
+    double increment_rate;
+
+    /* Number of threads that compute gc_refs and mark reachable objects
+       once the previous collection found at least parallel_threshold live
+       objects.  Zero means one thread per CPU usable by the process.  Only
+       used by the free-threaded build. */
+    int parallel_threads;
+    Py_ssize_t parallel_threshold;
+
 #ifdef Py_GIL_DISABLED
     /* This is the number of objects that survived the last full
        collection. It approximates the number of long lived objects
@@ -342,6 +430,9 @@ struct _gc_runtime_state {
        collections, and are awaiting to undergo a full collection for
        the first time. */
     Py_ssize_t long_lived_pending;
+
+    /* Helper threads of parallel collections, started on demand. */
+    struct _gc_helper_pool *parallel_helpers;
 #endif
 };
 
@@ -364,6 +455,9 @@ extern void _PyGC_Freeze(PyInterpreterState *interp);
 extern void _PyGC_Unfreeze(PyInterpreterState *interp);
 /* Number of frozen objects */
 extern Py_ssize_t _PyGC_GetFreezeCount(PyInterpreterState *interp);
+/* Make every object tracked by the GC immortal and stop tracking it.
+   Returns the number of objects made immortal. */
+extern Py_ssize_t _PyGC_ImmortalizeHeap(PyInterpreterState *interp);
 
 extern PyObject *_PyGC_GetObjects(PyInterpreterState *interp, int generation);
 extern PyObject *_PyGC_GetReferrers(PyInterpreterState *interp, PyObject *objs);
@@ -392,6 +486,10 @@ extern int _PyGC_VisitStackRef(union _PyStackRef *ref, visitproc visit, void *ar
 #ifdef Py_GIL_DISABLED
 extern void _PyGC_VisitObjectsWorldStopped(PyInterpreterState *interp,
                                            gcvisitobjects_t callback, void *arg);
+/* Stop the helper threads of parallel collections in every interpreter, so
+   that fork() is not called with them running.  The next parallel collection
+   starts them again.  Called with the world stopped and HEAD_LOCK held. */
+extern void _PyGC_BeforeFork(void);
 #endif
 
 #ifdef __cplusplus
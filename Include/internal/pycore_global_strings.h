@@ -637,6 +637,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(posix)
         STRUCT_FOR_ID(print_file_and_line)
         STRUCT_FOR_ID(priority)
+        STRUCT_FOR_ID(profile)
         STRUCT_FOR_ID(progress)
         STRUCT_FOR_ID(progress_handler)
         STRUCT_FOR_ID(progress_routine)
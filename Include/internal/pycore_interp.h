@@ -262,6 +262,18 @@ struct _is {
     struct callable_cache callable_cache;
     _PyOptimizerObject *optimizer;
     _PyExecutorObject *executor_list_head;
+#ifdef _Py_JIT
+    /* Executable memory shared by this interpreter's jitted executors
+       (see Python/jit.c). */
+    struct _jit_arena {
+        PyMutex mutex;
+        struct _PyJitChunk *chunks;
+        size_t chunk_count;
+        size_t mapped_size;  // Bytes mapped for all chunks.
+        size_t used_size;    // Bytes in pages owned by live executors.
+        size_t code_size;    // Bytes actually emitted for live executors.
+    } jit_arena;
+#endif
     size_t trace_run_counter;
     _rare_events rare_events;
     PyDict_WatchCallback builtins_dict_watcher;
@@ -27,9 +27,10 @@ struct _py_object_runtime_state {
 };
 
 struct _py_object_state {
-#if !defined(Py_GIL_DISABLED)
+    // In the free-threaded build, freelists are per thread and these hold no
+    // items: only the limits given to new threads and the statistics of the
+    // threads that are gone.
     struct _Py_freelists freelists;
-#endif
 #ifdef Py_REF_DEBUG
     Py_ssize_t reftotal;
 #endif
@@ -657,13 +657,56 @@ struct _obmalloc_usage {
 #endif /* WITH_PYMALLOC_RADIX_TREE */
 
 
+/*==========================================================================
+Allocation regions.
+
+Between _PyObject_EnterRegion() and _PyObject_ExitRegion(), the object
+domain allocator is replaced by one that bump-allocates small blocks from
+region pools, one per size class, instead of taking them from usedpools.
+pymalloc_alloc() and pymalloc_free() are not changed: outside regions,
+allocations cost exactly what they did before.
+
+A region pool is marked by REGION_SIZE_IDX in its szidx.  Freeing one of its
+blocks links it to the pool's freeblock list as usual, but the region never
+allocates from that list: it keeps bumping nextoffset, and restarts the pool
+from its start once all of its blocks are dead, so memory churned by
+short-lived objects is recycled in bulk.
+
+Region pools are linked in a doubly-linked list headed by `pools`.  A pool
+that filled up is kept for reuse by the region when its last block is freed,
+so a request that frees everything it allocated takes no pool from the arenas
+the next time around.  When the region ends, empty pools return to their
+arena at once.  Pools that still
+hold blocks -- objects that escaped the region -- become ordinary pools:
+their freeblock list and untouched tail are what pymalloc expects, so the
+dead blocks are reused and the pool is freed with its last block.  Objects
+cannot be moved, so escaped objects are counted rather than evacuated.
+*/
+
+struct _obmalloc_region {
+    /* Nesting depth of _PyObject_EnterRegion() */
+    int depth;
+    /* The pool that bump-allocates blocks of each size class, or NULL */
+    struct pool_header *current[NB_SMALL_SIZE_CLASSES];
+    /* Stack of the empty pools of each size class, linked through their
+       freeblock */
+    struct pool_header *empty[NB_SMALL_SIZE_CLASSES];
+    /* Head of the list of the pools of the region */
+    struct pool_header pools;
+};
+
+
 struct _obmalloc_global_state {
     int dump_debug_stats;
     Py_ssize_t interpreter_leaks;
+    /* Number of interpreters in an allocation region.  The region allocator
+       is installed while it is not zero. */
+    int active_regions;
 };
 
 struct _obmalloc_state {
     struct _obmalloc_pools pools;
+    struct _obmalloc_region region;
     struct _obmalloc_mgmt mgmt;
 #if WITH_PYMALLOC_RADIX_TREE
     struct _obmalloc_usage usage;
@@ -687,6 +730,14 @@ extern Py_ssize_t _Py_GetGlobalAllocatedBlocks(void);
 extern Py_ssize_t _PyInterpreterState_GetAllocatedBlocks(PyInterpreterState *);
 extern void _PyInterpreterState_FinalizeAllocatedBlocks(PyInterpreterState *);
 extern int _PyMem_init_obmalloc(PyInterpreterState *interp);
+
+/* Start an allocation region, see "Allocation regions" above.  Regions nest;
+   only the outermost one has an effect. */
+extern void _PyObject_EnterRegion(void);
+/* End an allocation region.  Return the number of blocks allocated in the
+   outermost region that are still alive, or -1 if no region is active.
+   Without pymalloc, regions have no effect and this always returns 0. */
+extern Py_ssize_t _PyObject_ExitRegion(void);
 extern bool _PyMem_obmalloc_state_on_heap(PyInterpreterState *interp);
 
 
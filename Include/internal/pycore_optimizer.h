@@ -105,6 +105,9 @@ _PyOptimizerObject *_Py_SetOptimizer(PyInterpreterState *interp, _PyOptimizerObj
 
 // Export for '_opcode' shared extension (JIT compiler).
 PyAPI_FUNC(_PyExecutorObject*) _Py_GetExecutor(PyCodeObject *code, int offset);
+PyAPI_FUNC(int) _Py_PrimeExecutor(PyCodeObject *code, int offset);
+extern PyObject *_Py_GetTraceCache(PyCodeObject *code, PyObject *loaded);
+extern int _Py_LoadTraceCache(PyCodeObject *code, PyObject *cache);
 
 void _Py_ExecutorInit(_PyExecutorObject *, const _PyBloomFilter *);
 void _Py_ExecutorDetach(_PyExecutorObject *);
@@ -201,6 +204,7 @@ static inline uint16_t uop_get_error_target(const _PyUOpInstruction *inst)
 typedef struct _Py_UopsSymbol _Py_UopsSymbol;
 
 struct _Py_UOpsAbstractFrame {
+    PyCodeObject *code;
     // Max stacklen
     int stack_len;
     int locals_len;
@@ -250,6 +254,7 @@ extern _Py_UopsSymbol *_Py_uop_sym_new_null(_Py_UOpsContext *ctx);
 extern bool _Py_uop_sym_has_type(_Py_UopsSymbol *sym);
 extern bool _Py_uop_sym_matches_type(_Py_UopsSymbol *sym, PyTypeObject *typ);
 extern bool _Py_uop_sym_matches_type_version(_Py_UopsSymbol *sym, unsigned int version);
+extern bool _Py_uop_sym_refines(_Py_UopsSymbol *sym, _Py_UopsSymbol *prev);
 extern void _Py_uop_sym_set_null(_Py_UOpsContext *ctx, _Py_UopsSymbol *sym);
 extern void _Py_uop_sym_set_non_null(_Py_UOpsContext *ctx, _Py_UopsSymbol *sym);
 extern void _Py_uop_sym_set_type(_Py_UOpsContext *ctx, _Py_UopsSymbol *sym, PyTypeObject *typ);
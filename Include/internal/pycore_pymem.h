@@ -2,7 +2,8 @@
 #define Py_INTERNAL_PYMEM_H
 
 #include "pycore_llist.h"           // struct llist_node
-#include "pycore_lock.h"            // PyMutex
+#include "pycore_lock.h"            // PyMutex, PyEvent
+#include "pycore_pythread.h"        // PyThread_handle_t
 
 #ifdef __cplusplus
 extern "C" {
@@ -47,6 +48,26 @@ struct _pymem_allocators {
     } debug;
     int is_debug_enabled;
     PyObjectArenaAllocator obj_arena;
+    // Set by _PyMem_EnableHugePages(): arenas are carved out of huge-page
+    // aligned chunks; [next, end) is what is left of the current chunk.
+    struct {
+        int enabled;
+        PyMutex mutex;
+        uintptr_t next;
+        uintptr_t end;
+    } huge_pages;
+    // The background memory purger, see _PyMem_StartPurger().
+    struct {
+        // Serializes starting and stopping the purger thread.
+        PyMutex control;
+        int active;
+        PyTime_t interval;
+        PyThread_handle_t handle;
+        PyEvent stop;
+        // Totals over all calls to _PyMem_PurgeFreeMemory().
+        Py_ssize_t purges;
+        Py_ssize_t bytes_released;
+    } purger;
 };
 
 struct _Py_mem_interp_free_queue {
@@ -116,6 +137,23 @@ extern int _PyMem_SetupAllocators(PyMemAllocatorName allocator);
 /* Is the debug allocator enabled? */
 extern int _PyMem_DebugEnabled(void);
 
+/* Back new obmalloc arenas and mimalloc segments with transparent huge
+   pages (PyConfig.huge_pages).  Memory allocated before the call is not
+   affected. */
+extern void _PyMem_EnableHugePages(void);
+
+/* Return the free memory held by the allocator of the current thread to the
+   OS: the unused pools of partially used pymalloc arenas, or the free pages
+   of the thread's mimalloc heaps.  Return the number of bytes released. */
+extern Py_ssize_t _PyMem_PurgeFreeMemory(void);
+
+/* Start a thread that asks every thread of the main interpreter to call
+   _PyMem_PurgeFreeMemory() every *interval*.  Return -1 with an exception
+   set if the purger is already running or the thread can't be started. */
+extern int _PyMem_StartPurger(PyTime_t interval);
+extern void _PyMem_StopPurger(void);
+extern void _PyMem_PurgerAfterFork_Child(void);
+
 // Enqueue a pointer to be freed possibly after some delay.
 extern void _PyMem_FreeDelayed(void *ptr);
 
@@ -1146,6 +1146,7 @@ extern "C" {
     INIT_ID(posix), \
     INIT_ID(print_file_and_line), \
     INIT_ID(priority), \
+    INIT_ID(profile), \
     INIT_ID(progress), \
     INIT_ID(progress_handler), \
     INIT_ID(progress_routine), \
@@ -16,6 +16,8 @@ extern const uint8_t _PyUop_Replication[MAX_UOP_ID+1];
 extern const char * const _PyOpcode_uop_name[MAX_UOP_ID+1];
 
 extern int _PyUop_num_popped(int opcode, int oparg);
+extern int _PyUop_num_pushed(int opcode, int oparg);
+extern int _PyUop_Fuse(int first, int second);
 
 #ifdef NEED_OPCODE_METADATA
 const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
@@ -78,13 +80,16 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_BINARY_OP_MULTIPLY_FLOAT] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
     [_BINARY_OP_ADD_FLOAT] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
     [_BINARY_OP_SUBTRACT_FLOAT] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_ADD_FLOAT_STORE_FAST] = HAS_ARG_FLAG | HAS_LOCAL_FLAG | HAS_DEOPT_FLAG | HAS_ERROR_FLAG,
+    [_BINARY_OP_SUBTRACT_FLOAT_STORE_FAST] = HAS_ARG_FLAG | HAS_LOCAL_FLAG | HAS_DEOPT_FLAG | HAS_ERROR_FLAG,
+    [_BINARY_OP_MULTIPLY_FLOAT_STORE_FAST] = HAS_ARG_FLAG | HAS_LOCAL_FLAG | HAS_DEOPT_FLAG | HAS_ERROR_FLAG,
     [_GUARD_BOTH_UNICODE] = HAS_EXIT_FLAG,
     [_BINARY_OP_ADD_UNICODE] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
     [_BINARY_OP_INPLACE_ADD_UNICODE] = HAS_LOCAL_FLAG | HAS_DEOPT_FLAG | HAS_ERROR_FLAG,
     [_BINARY_SUBSCR] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_BINARY_SLICE] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_STORE_SLICE] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
-    [_BINARY_SUBSCR_LIST_INT] = HAS_DEOPT_FLAG,
+    [_BINARY_SUBSCR_LIST_INT] = HAS_DEOPT_FLAG | HAS_ESCAPES_FLAG,
     [_BINARY_SUBSCR_STR_INT] = HAS_DEOPT_FLAG,
     [_BINARY_SUBSCR_TUPLE_INT] = HAS_DEOPT_FLAG,
     [_BINARY_SUBSCR_DICT] = HAS_DEOPT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
@@ -152,8 +157,8 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_LOAD_ATTR_INSTANCE_VALUE_0] = HAS_DEOPT_FLAG,
     [_LOAD_ATTR_INSTANCE_VALUE_1] = HAS_DEOPT_FLAG,
     [_LOAD_ATTR_INSTANCE_VALUE] = HAS_ARG_FLAG | HAS_DEOPT_FLAG | HAS_OPARG_AND_1_FLAG,
-    [_CHECK_ATTR_MODULE] = HAS_DEOPT_FLAG,
-    [_LOAD_ATTR_MODULE] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
+    [_CHECK_ATTR_MODULE_PUSH_KEYS] = HAS_DEOPT_FLAG,
+    [_LOAD_ATTR_MODULE_FROM_KEYS] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
     [_CHECK_ATTR_WITH_HINT] = HAS_EXIT_FLAG,
     [_LOAD_ATTR_WITH_HINT] = HAS_ARG_FLAG | HAS_NAME_FLAG | HAS_DEOPT_FLAG,
     [_LOAD_ATTR_SLOT_0] = HAS_DEOPT_FLAG,
@@ -165,9 +170,9 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_LOAD_ATTR_CLASS] = HAS_ARG_FLAG | HAS_OPARG_AND_1_FLAG,
     [_LOAD_ATTR_PROPERTY_FRAME] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
     [_GUARD_DORV_NO_DICT] = HAS_EXIT_FLAG,
-    [_STORE_ATTR_INSTANCE_VALUE] = 0,
+    [_STORE_ATTR_INSTANCE_VALUE] = HAS_DEOPT_FLAG,
     [_STORE_ATTR_WITH_HINT] = HAS_ARG_FLAG | HAS_NAME_FLAG | HAS_DEOPT_FLAG | HAS_ESCAPES_FLAG,
-    [_STORE_ATTR_SLOT] = 0,
+    [_STORE_ATTR_SLOT] = HAS_DEOPT_FLAG,
     [_COMPARE_OP] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_COMPARE_OP_FLOAT] = HAS_ARG_FLAG,
     [_COMPARE_OP_INT] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
@@ -284,6 +289,7 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_CHECK_FUNCTION] = HAS_DEOPT_FLAG,
     [_LOAD_GLOBAL_MODULE] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
     [_LOAD_GLOBAL_BUILTINS] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
+    [_LOAD_ATTR_MODULE] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
     [_INTERNAL_INCREMENT_OPT_COUNTER] = 0,
     [_DYNAMIC_EXIT] = HAS_ESCAPES_FLAG,
     [_START_EXECUTOR] = 0,
@@ -292,7 +298,28 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_CHECK_VALIDITY_AND_SET_IP] = HAS_DEOPT_FLAG,
     [_DEOPT] = 0,
     [_ERROR_POP_N] = HAS_ARG_FLAG | HAS_ESCAPES_FLAG,
+    [_ENTER_INLINED_CALL] = 0,
+    [_RETURN_INLINED] = HAS_ARG_FLAG | HAS_ESCAPES_FLAG,
+    [_EXIT_INLINED_CALL] = HAS_ARG_FLAG | HAS_ESCAPES_FLAG,
     [_TIER2_RESUME_CHECK] = HAS_DEOPT_FLAG,
+    [_BINARY_OP_MULTIPLY_INT_GUARD_BOTH] = HAS_EXIT_FLAG | HAS_ERROR_FLAG,
+    [_BINARY_OP_ADD_INT_GUARD_BOTH] = HAS_EXIT_FLAG | HAS_ERROR_FLAG,
+    [_BINARY_OP_SUBTRACT_INT_GUARD_BOTH] = HAS_EXIT_FLAG | HAS_ERROR_FLAG,
+    [_BINARY_OP_MULTIPLY_INT_GUARD_NOS] = HAS_EXIT_FLAG | HAS_ERROR_FLAG,
+    [_BINARY_OP_ADD_INT_GUARD_NOS] = HAS_EXIT_FLAG | HAS_ERROR_FLAG,
+    [_BINARY_OP_SUBTRACT_INT_GUARD_NOS] = HAS_EXIT_FLAG | HAS_ERROR_FLAG,
+    [_BINARY_OP_MULTIPLY_INT_GUARD_TOS] = HAS_EXIT_FLAG | HAS_ERROR_FLAG,
+    [_BINARY_OP_ADD_INT_GUARD_TOS] = HAS_EXIT_FLAG | HAS_ERROR_FLAG,
+    [_BINARY_OP_SUBTRACT_INT_GUARD_TOS] = HAS_EXIT_FLAG | HAS_ERROR_FLAG,
+    [_BINARY_OP_MULTIPLY_FLOAT_GUARD_BOTH] = HAS_EXIT_FLAG | HAS_ERROR_FLAG,
+    [_BINARY_OP_ADD_FLOAT_GUARD_BOTH] = HAS_EXIT_FLAG | HAS_ERROR_FLAG,
+    [_BINARY_OP_SUBTRACT_FLOAT_GUARD_BOTH] = HAS_EXIT_FLAG | HAS_ERROR_FLAG,
+    [_BINARY_OP_MULTIPLY_FLOAT_GUARD_NOS] = HAS_EXIT_FLAG | HAS_ERROR_FLAG,
+    [_BINARY_OP_ADD_FLOAT_GUARD_NOS] = HAS_EXIT_FLAG | HAS_ERROR_FLAG,
+    [_BINARY_OP_SUBTRACT_FLOAT_GUARD_NOS] = HAS_EXIT_FLAG | HAS_ERROR_FLAG,
+    [_BINARY_OP_MULTIPLY_FLOAT_GUARD_TOS] = HAS_EXIT_FLAG | HAS_ERROR_FLAG,
+    [_BINARY_OP_ADD_FLOAT_GUARD_TOS] = HAS_EXIT_FLAG | HAS_ERROR_FLAG,
+    [_BINARY_OP_SUBTRACT_FLOAT_GUARD_TOS] = HAS_EXIT_FLAG | HAS_ERROR_FLAG,
 };
 
 const uint8_t _PyUop_Replication[MAX_UOP_ID+1] = {
@@ -305,13 +332,34 @@ const uint8_t _PyUop_Replication[MAX_UOP_ID+1] = {
 const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_BINARY_OP] = "_BINARY_OP",
     [_BINARY_OP_ADD_FLOAT] = "_BINARY_OP_ADD_FLOAT",
+    [_BINARY_OP_ADD_FLOAT_GUARD_BOTH] = "_BINARY_OP_ADD_FLOAT_GUARD_BOTH",
+    [_BINARY_OP_ADD_FLOAT_GUARD_NOS] = "_BINARY_OP_ADD_FLOAT_GUARD_NOS",
+    [_BINARY_OP_ADD_FLOAT_GUARD_TOS] = "_BINARY_OP_ADD_FLOAT_GUARD_TOS",
+    [_BINARY_OP_ADD_FLOAT_STORE_FAST] = "_BINARY_OP_ADD_FLOAT_STORE_FAST",
     [_BINARY_OP_ADD_INT] = "_BINARY_OP_ADD_INT",
+    [_BINARY_OP_ADD_INT_GUARD_BOTH] = "_BINARY_OP_ADD_INT_GUARD_BOTH",
+    [_BINARY_OP_ADD_INT_GUARD_NOS] = "_BINARY_OP_ADD_INT_GUARD_NOS",
+    [_BINARY_OP_ADD_INT_GUARD_TOS] = "_BINARY_OP_ADD_INT_GUARD_TOS",
     [_BINARY_OP_ADD_UNICODE] = "_BINARY_OP_ADD_UNICODE",
     [_BINARY_OP_INPLACE_ADD_UNICODE] = "_BINARY_OP_INPLACE_ADD_UNICODE",
     [_BINARY_OP_MULTIPLY_FLOAT] = "_BINARY_OP_MULTIPLY_FLOAT",
+    [_BINARY_OP_MULTIPLY_FLOAT_GUARD_BOTH] = "_BINARY_OP_MULTIPLY_FLOAT_GUARD_BOTH",
+    [_BINARY_OP_MULTIPLY_FLOAT_GUARD_NOS] = "_BINARY_OP_MULTIPLY_FLOAT_GUARD_NOS",
+    [_BINARY_OP_MULTIPLY_FLOAT_GUARD_TOS] = "_BINARY_OP_MULTIPLY_FLOAT_GUARD_TOS",
+    [_BINARY_OP_MULTIPLY_FLOAT_STORE_FAST] = "_BINARY_OP_MULTIPLY_FLOAT_STORE_FAST",
     [_BINARY_OP_MULTIPLY_INT] = "_BINARY_OP_MULTIPLY_INT",
+    [_BINARY_OP_MULTIPLY_INT_GUARD_BOTH] = "_BINARY_OP_MULTIPLY_INT_GUARD_BOTH",
+    [_BINARY_OP_MULTIPLY_INT_GUARD_NOS] = "_BINARY_OP_MULTIPLY_INT_GUARD_NOS",
+    [_BINARY_OP_MULTIPLY_INT_GUARD_TOS] = "_BINARY_OP_MULTIPLY_INT_GUARD_TOS",
     [_BINARY_OP_SUBTRACT_FLOAT] = "_BINARY_OP_SUBTRACT_FLOAT",
+    [_BINARY_OP_SUBTRACT_FLOAT_GUARD_BOTH] = "_BINARY_OP_SUBTRACT_FLOAT_GUARD_BOTH",
+    [_BINARY_OP_SUBTRACT_FLOAT_GUARD_NOS] = "_BINARY_OP_SUBTRACT_FLOAT_GUARD_NOS",
+    [_BINARY_OP_SUBTRACT_FLOAT_GUARD_TOS] = "_BINARY_OP_SUBTRACT_FLOAT_GUARD_TOS",
+    [_BINARY_OP_SUBTRACT_FLOAT_STORE_FAST] = "_BINARY_OP_SUBTRACT_FLOAT_STORE_FAST",
     [_BINARY_OP_SUBTRACT_INT] = "_BINARY_OP_SUBTRACT_INT",
+    [_BINARY_OP_SUBTRACT_INT_GUARD_BOTH] = "_BINARY_OP_SUBTRACT_INT_GUARD_BOTH",
+    [_BINARY_OP_SUBTRACT_INT_GUARD_NOS] = "_BINARY_OP_SUBTRACT_INT_GUARD_NOS",
+    [_BINARY_OP_SUBTRACT_INT_GUARD_TOS] = "_BINARY_OP_SUBTRACT_INT_GUARD_TOS",
     [_BINARY_SLICE] = "_BINARY_SLICE",
     [_BINARY_SUBSCR] = "_BINARY_SUBSCR",
     [_BINARY_SUBSCR_CHECK_FUNC] = "_BINARY_SUBSCR_CHECK_FUNC",
@@ -347,7 +395,7 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_CHECK_AND_ALLOCATE_OBJECT] = "_CHECK_AND_ALLOCATE_OBJECT",
     [_CHECK_ATTR_CLASS] = "_CHECK_ATTR_CLASS",
     [_CHECK_ATTR_METHOD_LAZY_DICT] = "_CHECK_ATTR_METHOD_LAZY_DICT",
-    [_CHECK_ATTR_MODULE] = "_CHECK_ATTR_MODULE",
+    [_CHECK_ATTR_MODULE_PUSH_KEYS] = "_CHECK_ATTR_MODULE_PUSH_KEYS",
     [_CHECK_ATTR_WITH_HINT] = "_CHECK_ATTR_WITH_HINT",
     [_CHECK_CALL_BOUND_METHOD_EXACT_ARGS] = "_CHECK_CALL_BOUND_METHOD_EXACT_ARGS",
     [_CHECK_EG_MATCH] = "_CHECK_EG_MATCH",
@@ -391,8 +439,10 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_DICT_UPDATE] = "_DICT_UPDATE",
     [_DYNAMIC_EXIT] = "_DYNAMIC_EXIT",
     [_END_SEND] = "_END_SEND",
+    [_ENTER_INLINED_CALL] = "_ENTER_INLINED_CALL",
     [_ERROR_POP_N] = "_ERROR_POP_N",
     [_EXIT_INIT_CHECK] = "_EXIT_INIT_CHECK",
+    [_EXIT_INLINED_CALL] = "_EXIT_INLINED_CALL",
     [_EXIT_TRACE] = "_EXIT_TRACE",
     [_EXPAND_METHOD] = "_EXPAND_METHOD",
     [_EXPAND_METHOD_KW] = "_EXPAND_METHOD_KW",
@@ -460,6 +510,7 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_LOAD_ATTR_METHOD_NO_DICT] = "_LOAD_ATTR_METHOD_NO_DICT",
     [_LOAD_ATTR_METHOD_WITH_VALUES] = "_LOAD_ATTR_METHOD_WITH_VALUES",
     [_LOAD_ATTR_MODULE] = "_LOAD_ATTR_MODULE",
+    [_LOAD_ATTR_MODULE_FROM_KEYS] = "_LOAD_ATTR_MODULE_FROM_KEYS",
     [_LOAD_ATTR_NONDESCRIPTOR_NO_DICT] = "_LOAD_ATTR_NONDESCRIPTOR_NO_DICT",
     [_LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES] = "_LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES",
     [_LOAD_ATTR_PROPERTY_FRAME] = "_LOAD_ATTR_PROPERTY_FRAME",
@@ -528,6 +579,7 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_REPLACE_WITH_TRUE] = "_REPLACE_WITH_TRUE",
     [_RESUME_CHECK] = "_RESUME_CHECK",
     [_RETURN_GENERATOR] = "_RETURN_GENERATOR",
+    [_RETURN_INLINED] = "_RETURN_INLINED",
     [_RETURN_VALUE] = "_RETURN_VALUE",
     [_SAVE_RETURN_OFFSET] = "_SAVE_RETURN_OFFSET",
     [_SEND_GEN_FRAME] = "_SEND_GEN_FRAME",
@@ -699,6 +751,12 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 2;
         case _BINARY_OP_SUBTRACT_FLOAT:
             return 2;
+        case _BINARY_OP_ADD_FLOAT_STORE_FAST:
+            return 2;
+        case _BINARY_OP_SUBTRACT_FLOAT_STORE_FAST:
+            return 2;
+        case _BINARY_OP_MULTIPLY_FLOAT_STORE_FAST:
+            return 2;
         case _GUARD_BOTH_UNICODE:
             return 0;
         case _BINARY_OP_ADD_UNICODE:
@@ -847,10 +905,10 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 1;
         case _LOAD_ATTR_INSTANCE_VALUE:
             return 1;
-        case _CHECK_ATTR_MODULE:
+        case _CHECK_ATTR_MODULE_PUSH_KEYS:
             return 0;
-        case _LOAD_ATTR_MODULE:
-            return 1;
+        case _LOAD_ATTR_MODULE_FROM_KEYS:
+            return 2;
         case _CHECK_ATTR_WITH_HINT:
             return 0;
         case _LOAD_ATTR_WITH_HINT:
@@ -1111,6 +1169,8 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 0;
         case _LOAD_GLOBAL_BUILTINS:
             return 0;
+        case _LOAD_ATTR_MODULE:
+            return 1;
         case _INTERNAL_INCREMENT_OPT_COUNTER:
             return 1;
         case _DYNAMIC_EXIT:
@@ -1127,13 +1187,728 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 0;
         case _ERROR_POP_N:
             return oparg;
+        case _ENTER_INLINED_CALL:
+            return 0;
+        case _RETURN_INLINED:
+            return 3 + oparg;
+        case _EXIT_INLINED_CALL:
+            return oparg;
         case _TIER2_RESUME_CHECK:
             return 0;
+        case _BINARY_OP_MULTIPLY_INT_GUARD_BOTH:
+            return 2;
+        case _BINARY_OP_ADD_INT_GUARD_BOTH:
+            return 2;
+        case _BINARY_OP_SUBTRACT_INT_GUARD_BOTH:
+            return 2;
+        case _BINARY_OP_MULTIPLY_INT_GUARD_NOS:
+            return 2;
+        case _BINARY_OP_ADD_INT_GUARD_NOS:
+            return 2;
+        case _BINARY_OP_SUBTRACT_INT_GUARD_NOS:
+            return 2;
+        case _BINARY_OP_MULTIPLY_INT_GUARD_TOS:
+            return 2;
+        case _BINARY_OP_ADD_INT_GUARD_TOS:
+            return 2;
+        case _BINARY_OP_SUBTRACT_INT_GUARD_TOS:
+            return 2;
+        case _BINARY_OP_MULTIPLY_FLOAT_GUARD_BOTH:
+            return 2;
+        case _BINARY_OP_ADD_FLOAT_GUARD_BOTH:
+            return 2;
+        case _BINARY_OP_SUBTRACT_FLOAT_GUARD_BOTH:
+            return 2;
+        case _BINARY_OP_MULTIPLY_FLOAT_GUARD_NOS:
+            return 2;
+        case _BINARY_OP_ADD_FLOAT_GUARD_NOS:
+            return 2;
+        case _BINARY_OP_SUBTRACT_FLOAT_GUARD_NOS:
+            return 2;
+        case _BINARY_OP_MULTIPLY_FLOAT_GUARD_TOS:
+            return 2;
+        case _BINARY_OP_ADD_FLOAT_GUARD_TOS:
+            return 2;
+        case _BINARY_OP_SUBTRACT_FLOAT_GUARD_TOS:
+            return 2;
         default:
             return -1;
     }
 }
 
+int _PyUop_num_pushed(int opcode, int oparg)
+{
+    switch(opcode) {
+        case _NOP:
+            return 0;
+        case _CHECK_PERIODIC:
+            return 0;
+        case _CHECK_PERIODIC_IF_NOT_YIELD_FROM:
+            return 0;
+        case _RESUME_CHECK:
+            return 0;
+        case _LOAD_FAST_CHECK:
+            return 1;
+        case _LOAD_FAST_0:
+            return 1;
+        case _LOAD_FAST_1:
+            return 1;
+        case _LOAD_FAST_2:
+            return 1;
+        case _LOAD_FAST_3:
+            return 1;
+        case _LOAD_FAST_4:
+            return 1;
+        case _LOAD_FAST_5:
+            return 1;
+        case _LOAD_FAST_6:
+            return 1;
+        case _LOAD_FAST_7:
+            return 1;
+        case _LOAD_FAST:
+            return 1;
+        case _LOAD_FAST_AND_CLEAR:
+            return 1;
+        case _LOAD_FAST_LOAD_FAST:
+            return 2;
+        case _LOAD_CONST:
+            return 1;
+        case _LOAD_CONST_IMMORTAL:
+            return 1;
+        case _LOAD_SMALL_INT_0:
+            return 1;
+        case _LOAD_SMALL_INT_1:
+            return 1;
+        case _LOAD_SMALL_INT_2:
+            return 1;
+        case _LOAD_SMALL_INT_3:
+            return 1;
+        case _LOAD_SMALL_INT:
+            return 1;
+        case _STORE_FAST_0:
+            return 0;
+        case _STORE_FAST_1:
+            return 0;
+        case _STORE_FAST_2:
+            return 0;
+        case _STORE_FAST_3:
+            return 0;
+        case _STORE_FAST_4:
+            return 0;
+        case _STORE_FAST_5:
+            return 0;
+        case _STORE_FAST_6:
+            return 0;
+        case _STORE_FAST_7:
+            return 0;
+        case _STORE_FAST:
+            return 0;
+        case _STORE_FAST_LOAD_FAST:
+            return 1;
+        case _STORE_FAST_STORE_FAST:
+            return 0;
+        case _POP_TOP:
+            return 0;
+        case _PUSH_NULL:
+            return 1;
+        case _END_SEND:
+            return 1;
+        case _UNARY_NEGATIVE:
+            return 1;
+        case _UNARY_NOT:
+            return 1;
+        case _TO_BOOL:
+            return 1;
+        case _TO_BOOL_BOOL:
+            return 0;
+        case _TO_BOOL_INT:
+            return 1;
+        case _TO_BOOL_LIST:
+            return 1;
+        case _TO_BOOL_NONE:
+            return 1;
+        case _TO_BOOL_STR:
+            return 1;
+        case _REPLACE_WITH_TRUE:
+            return 1;
+        case _UNARY_INVERT:
+            return 1;
+        case _GUARD_BOTH_INT:
+            return 0;
+        case _GUARD_NOS_INT:
+            return 0;
+        case _GUARD_TOS_INT:
+            return 0;
+        case _BINARY_OP_MULTIPLY_INT:
+            return 1;
+        case _BINARY_OP_ADD_INT:
+            return 1;
+        case _BINARY_OP_SUBTRACT_INT:
+            return 1;
+        case _GUARD_BOTH_FLOAT:
+            return 0;
+        case _GUARD_NOS_FLOAT:
+            return 0;
+        case _GUARD_TOS_FLOAT:
+            return 0;
+        case _BINARY_OP_MULTIPLY_FLOAT:
+            return 1;
+        case _BINARY_OP_ADD_FLOAT:
+            return 1;
+        case _BINARY_OP_SUBTRACT_FLOAT:
+            return 1;
+        case _BINARY_OP_ADD_FLOAT_STORE_FAST:
+            return 0;
+        case _BINARY_OP_SUBTRACT_FLOAT_STORE_FAST:
+            return 0;
+        case _BINARY_OP_MULTIPLY_FLOAT_STORE_FAST:
+            return 0;
+        case _GUARD_BOTH_UNICODE:
+            return 0;
+        case _BINARY_OP_ADD_UNICODE:
+            return 1;
+        case _BINARY_OP_INPLACE_ADD_UNICODE:
+            return 0;
+        case _BINARY_SUBSCR:
+            return 1;
+        case _BINARY_SLICE:
+            return 1;
+        case _STORE_SLICE:
+            return 0;
+        case _BINARY_SUBSCR_LIST_INT:
+            return 1;
+        case _BINARY_SUBSCR_STR_INT:
+            return 1;
+        case _BINARY_SUBSCR_TUPLE_INT:
+            return 1;
+        case _BINARY_SUBSCR_DICT:
+            return 1;
+        case _BINARY_SUBSCR_CHECK_FUNC:
+            return 0;
+        case _BINARY_SUBSCR_INIT_CALL:
+            return 1;
+        case _LIST_APPEND:
+            return 0;
+        case _SET_ADD:
+            return 0;
+        case _STORE_SUBSCR:
+            return 0;
+        case _STORE_SUBSCR_LIST_INT:
+            return 0;
+        case _STORE_SUBSCR_DICT:
+            return 0;
+        case _DELETE_SUBSCR:
+            return 0;
+        case _CALL_INTRINSIC_1:
+            return 1;
+        case _CALL_INTRINSIC_2:
+            return 1;
+        case _RETURN_VALUE:
+            return 1;
+        case _GET_AITER:
+            return 1;
+        case _GET_ANEXT:
+            return 1;
+        case _GET_AWAITABLE:
+            return 1;
+        case _SEND_GEN_FRAME:
+            return 1;
+        case _YIELD_VALUE:
+            return 1;
+        case _POP_EXCEPT:
+            return 0;
+        case _LOAD_COMMON_CONSTANT:
+            return 1;
+        case _LOAD_BUILD_CLASS:
+            return 1;
+        case _STORE_NAME:
+            return 0;
+        case _DELETE_NAME:
+            return 0;
+        case _UNPACK_SEQUENCE:
+            return oparg;
+        case _UNPACK_SEQUENCE_TWO_TUPLE:
+            return 2;
+        case _UNPACK_SEQUENCE_TUPLE:
+            return oparg;
+        case _UNPACK_SEQUENCE_LIST:
+            return oparg;
+        case _UNPACK_EX:
+            return 1 + (oparg & 0xFF) + (oparg >> 8);
+        case _STORE_ATTR:
+            return 0;
+        case _DELETE_ATTR:
+            return 0;
+        case _STORE_GLOBAL:
+            return 0;
+        case _DELETE_GLOBAL:
+            return 0;
+        case _LOAD_LOCALS:
+            return 1;
+        case _LOAD_NAME:
+            return 1;
+        case _LOAD_GLOBAL:
+            return 1 + (oparg & 1);
+        case _GUARD_GLOBALS_VERSION:
+            return 0;
+        case _GUARD_GLOBALS_VERSION_PUSH_KEYS:
+            return 1;
+        case _GUARD_BUILTINS_VERSION_PUSH_KEYS:
+            return 1;
+        case _LOAD_GLOBAL_MODULE_FROM_KEYS:
+            return 1 + (oparg & 1);
+        case _LOAD_GLOBAL_BUILTINS_FROM_KEYS:
+            return 1 + (oparg & 1);
+        case _DELETE_FAST:
+            return 0;
+        case _MAKE_CELL:
+            return 0;
+        case _DELETE_DEREF:
+            return 0;
+        case _LOAD_FROM_DICT_OR_DEREF:
+            return 1;
+        case _LOAD_DEREF:
+            return 1;
+        case _STORE_DEREF:
+            return 0;
+        case _COPY_FREE_VARS:
+            return 0;
+        case _BUILD_STRING:
+            return 1;
+        case _BUILD_TUPLE:
+            return 1;
+        case _BUILD_LIST:
+            return 1;
+        case _LIST_EXTEND:
+            return 0;
+        case _SET_UPDATE:
+            return 0;
+        case _BUILD_SET:
+            return 1;
+        case _BUILD_MAP:
+            return 1;
+        case _SETUP_ANNOTATIONS:
+            return 0;
+        case _DICT_UPDATE:
+            return 0;
+        case _DICT_MERGE:
+            return 0;
+        case _MAP_ADD:
+            return 0;
+        case _LOAD_SUPER_ATTR_ATTR:
+            return 1;
+        case _LOAD_SUPER_ATTR_METHOD:
+            return 2;
+        case _LOAD_ATTR:
+            return 1 + (oparg & 1);
+        case _GUARD_TYPE_VERSION:
+            return 0;
+        case _CHECK_MANAGED_OBJECT_HAS_VALUES:
+            return 0;
+        case _LOAD_ATTR_INSTANCE_VALUE_0:
+            return 1;
+        case _LOAD_ATTR_INSTANCE_VALUE_1:
+            return 2;
+        case _LOAD_ATTR_INSTANCE_VALUE:
+            return 1 + (oparg & 1);
+        case _CHECK_ATTR_MODULE_PUSH_KEYS:
+            return 1;
+        case _LOAD_ATTR_MODULE_FROM_KEYS:
+            return 1 + (oparg & 1);
+        case _CHECK_ATTR_WITH_HINT:
+            return 0;
+        case _LOAD_ATTR_WITH_HINT:
+            return 1 + (oparg & 1);
+        case _LOAD_ATTR_SLOT_0:
+            return 1;
+        case _LOAD_ATTR_SLOT_1:
+            return 2;
+        case _LOAD_ATTR_SLOT:
+            return 1 + (oparg & 1);
+        case _CHECK_ATTR_CLASS:
+            return 0;
+        case _LOAD_ATTR_CLASS_0:
+            return 1;
+        case _LOAD_ATTR_CLASS_1:
+            return 2;
+        case _LOAD_ATTR_CLASS:
+            return 1 + (oparg & 1);
+        case _LOAD_ATTR_PROPERTY_FRAME:
+            return 1;
+        case _GUARD_DORV_NO_DICT:
+            return 0;
+        case _STORE_ATTR_INSTANCE_VALUE:
+            return 0;
+        case _STORE_ATTR_WITH_HINT:
+            return 0;
+        case _STORE_ATTR_SLOT:
+            return 0;
+        case _COMPARE_OP:
+            return 1;
+        case _COMPARE_OP_FLOAT:
+            return 1;
+        case _COMPARE_OP_INT:
+            return 1;
+        case _COMPARE_OP_STR:
+            return 1;
+        case _IS_OP:
+            return 1;
+        case _CONTAINS_OP:
+            return 1;
+        case _CONTAINS_OP_SET:
+            return 1;
+        case _CONTAINS_OP_DICT:
+            return 1;
+        case _CHECK_EG_MATCH:
+            return 2;
+        case _CHECK_EXC_MATCH:
+            return 1;
+        case _IMPORT_NAME:
+            return 1;
+        case _IMPORT_FROM:
+            return 1;
+        case _IS_NONE:
+            return 1;
+        case _GET_LEN:
+            return 1;
+        case _MATCH_CLASS:
+            return 1;
+        case _MATCH_MAPPING:
+            return 1;
+        case _MATCH_SEQUENCE:
+            return 1;
+        case _MATCH_KEYS:
+            return 1;
+        case _GET_ITER:
+            return 1;
+        case _GET_YIELD_FROM_ITER:
+            return 1;
+        case _FOR_ITER_TIER_TWO:
+            return 1;
+        case _ITER_CHECK_LIST:
+            return 0;
+        case _GUARD_NOT_EXHAUSTED_LIST:
+            return 0;
+        case _ITER_NEXT_LIST:
+            return 1;
+        case _ITER_CHECK_TUPLE:
+            return 0;
+        case _GUARD_NOT_EXHAUSTED_TUPLE:
+            return 0;
+        case _ITER_NEXT_TUPLE:
+            return 1;
+        case _ITER_CHECK_RANGE:
+            return 0;
+        case _GUARD_NOT_EXHAUSTED_RANGE:
+            return 0;
+        case _ITER_NEXT_RANGE:
+            return 1;
+        case _FOR_ITER_GEN_FRAME:
+            return 1;
+        case _LOAD_SPECIAL:
+            return 2;
+        case _WITH_EXCEPT_START:
+            return 1;
+        case _PUSH_EXC_INFO:
+            return 2;
+        case _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT:
+            return 0;
+        case _GUARD_KEYS_VERSION:
+            return 0;
+        case _LOAD_ATTR_METHOD_WITH_VALUES:
+            return 2;
+        case _LOAD_ATTR_METHOD_NO_DICT:
+            return 2;
+        case _LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES:
+            return 1;
+        case _LOAD_ATTR_NONDESCRIPTOR_NO_DICT:
+            return 1;
+        case _CHECK_ATTR_METHOD_LAZY_DICT:
+            return 0;
+        case _LOAD_ATTR_METHOD_LAZY_DICT:
+            return 2;
+        case _MAYBE_EXPAND_METHOD:
+            return 2 + oparg;
+        case _PY_FRAME_GENERAL:
+            return 1;
+        case _CHECK_FUNCTION_VERSION:
+            return 0;
+        case _CHECK_FUNCTION_VERSION_INLINE:
+            return 0;
+        case _CHECK_METHOD_VERSION:
+            return 0;
+        case _EXPAND_METHOD:
+            return 2 + oparg;
+        case _CHECK_IS_NOT_PY_CALLABLE:
+            return 0;
+        case _CALL_NON_PY_GENERAL:
+            return 1;
+        case _CHECK_CALL_BOUND_METHOD_EXACT_ARGS:
+            return 0;
+        case _INIT_CALL_BOUND_METHOD_EXACT_ARGS:
+            return 2 + oparg;
+        case _CHECK_PEP_523:
+            return 0;
+        case _CHECK_FUNCTION_EXACT_ARGS:
+            return 0;
+        case _CHECK_STACK_SPACE:
+            return 0;
+        case _INIT_CALL_PY_EXACT_ARGS_0:
+            return 1;
+        case _INIT_CALL_PY_EXACT_ARGS_1:
+            return 1;
+        case _INIT_CALL_PY_EXACT_ARGS_2:
+            return 1;
+        case _INIT_CALL_PY_EXACT_ARGS_3:
+            return 1;
+        case _INIT_CALL_PY_EXACT_ARGS_4:
+            return 1;
+        case _INIT_CALL_PY_EXACT_ARGS:
+            return 1;
+        case _PUSH_FRAME:
+            return 0;
+        case _CALL_TYPE_1:
+            return 1;
+        case _CALL_STR_1:
+            return 1;
+        case _CALL_TUPLE_1:
+            return 1;
+        case _CHECK_AND_ALLOCATE_OBJECT:
+            return 2 + oparg;
+        case _CREATE_INIT_FRAME:
+            return 1;
+        case _EXIT_INIT_CHECK:
+            return 0;
+        case _CALL_BUILTIN_CLASS:
+            return 1;
+        case _CALL_BUILTIN_O:
+            return 1;
+        case _CALL_BUILTIN_FAST:
+            return 1;
+        case _CALL_BUILTIN_FAST_WITH_KEYWORDS:
+            return 1;
+        case _CALL_LEN:
+            return 1;
+        case _CALL_ISINSTANCE:
+            return 1;
+        case _CALL_LIST_APPEND:
+            return 0;
+        case _CALL_METHOD_DESCRIPTOR_O:
+            return 1;
+        case _CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS:
+            return 1;
+        case _CALL_METHOD_DESCRIPTOR_NOARGS:
+            return 1;
+        case _CALL_METHOD_DESCRIPTOR_FAST:
+            return 1;
+        case _MAYBE_EXPAND_METHOD_KW:
+            return 3 + oparg;
+        case _PY_FRAME_KW:
+            return 1;
+        case _CHECK_FUNCTION_VERSION_KW:
+            return 0;
+        case _CHECK_METHOD_VERSION_KW:
+            return 0;
+        case _EXPAND_METHOD_KW:
+            return 3 + oparg;
+        case _CHECK_IS_NOT_PY_CALLABLE_KW:
+            return 0;
+        case _CALL_KW_NON_PY:
+            return 1;
+        case _MAKE_CALLARGS_A_TUPLE:
+            return 1 + (oparg & 1);
+        case _MAKE_FUNCTION:
+            return 1;
+        case _MAKE_DEFER_EXPR:
+            return 1;
+        case _SET_FUNCTION_ATTRIBUTE:
+            return 1;
+        case _RETURN_GENERATOR:
+            return 1;
+        case _BUILD_SLICE:
+            return 1;
+        case _CONVERT_VALUE:
+            return 1;
+        case _FORMAT_SIMPLE:
+            return 1;
+        case _FORMAT_WITH_SPEC:
+            return 1;
+        case _COPY:
+            return 1;
+        case _BINARY_OP:
+            return 1;
+        case _SWAP:
+            return 2 + (oparg-2);
+        case _GUARD_IS_TRUE_POP:
+            return 0;
+        case _GUARD_IS_FALSE_POP:
+            return 0;
+        case _GUARD_IS_NONE_POP:
+            return 0;
+        case _GUARD_IS_NOT_NONE_POP:
+            return 0;
+        case _JUMP_TO_TOP:
+            return 0;
+        case _SET_IP:
+            return 0;
+        case _CHECK_STACK_SPACE_OPERAND:
+            return 0;
+        case _SAVE_RETURN_OFFSET:
+            return 0;
+        case _EXIT_TRACE:
+            return 0;
+        case _CHECK_VALIDITY:
+            return 0;
+        case _LOAD_CONST_INLINE:
+            return 1;
+        case _LOAD_CONST_INLINE_BORROW:
+            return 1;
+        case _POP_TOP_LOAD_CONST_INLINE_BORROW:
+            return 1;
+        case _LOAD_CONST_INLINE_WITH_NULL:
+            return 2;
+        case _LOAD_CONST_INLINE_BORROW_WITH_NULL:
+            return 2;
+        case _CHECK_FUNCTION:
+            return 0;
+        case _LOAD_GLOBAL_MODULE:
+            return 1 + (oparg & 1);
+        case _LOAD_GLOBAL_BUILTINS:
+            return 1 + (oparg & 1);
+        case _LOAD_ATTR_MODULE:
+            return 1 + (oparg & 1);
+        case _INTERNAL_INCREMENT_OPT_COUNTER:
+            return 0;
+        case _DYNAMIC_EXIT:
+            return 0;
+        case _START_EXECUTOR:
+            return 0;
+        case _MAKE_WARM:
+            return 0;
+        case _FATAL_ERROR:
+            return 0;
+        case _CHECK_VALIDITY_AND_SET_IP:
+            return 0;
+        case _DEOPT:
+            return 0;
+        case _ERROR_POP_N:
+            return 0;
+        case _ENTER_INLINED_CALL:
+            return 0;
+        case _RETURN_INLINED:
+            return 1;
+        case _EXIT_INLINED_CALL:
+            return 0;
+        case _TIER2_RESUME_CHECK:
+            return 0;
+        case _BINARY_OP_MULTIPLY_INT_GUARD_BOTH:
+            return 1;
+        case _BINARY_OP_ADD_INT_GUARD_BOTH:
+            return 1;
+        case _BINARY_OP_SUBTRACT_INT_GUARD_BOTH:
+            return 1;
+        case _BINARY_OP_MULTIPLY_INT_GUARD_NOS:
+            return 1;
+        case _BINARY_OP_ADD_INT_GUARD_NOS:
+            return 1;
+        case _BINARY_OP_SUBTRACT_INT_GUARD_NOS:
+            return 1;
+        case _BINARY_OP_MULTIPLY_INT_GUARD_TOS:
+            return 1;
+        case _BINARY_OP_ADD_INT_GUARD_TOS:
+            return 1;
+        case _BINARY_OP_SUBTRACT_INT_GUARD_TOS:
+            return 1;
+        case _BINARY_OP_MULTIPLY_FLOAT_GUARD_BOTH:
+            return 1;
+        case _BINARY_OP_ADD_FLOAT_GUARD_BOTH:
+            return 1;
+        case _BINARY_OP_SUBTRACT_FLOAT_GUARD_BOTH:
+            return 1;
+        case _BINARY_OP_MULTIPLY_FLOAT_GUARD_NOS:
+            return 1;
+        case _BINARY_OP_ADD_FLOAT_GUARD_NOS:
+            return 1;
+        case _BINARY_OP_SUBTRACT_FLOAT_GUARD_NOS:
+            return 1;
+        case _BINARY_OP_MULTIPLY_FLOAT_GUARD_TOS:
+            return 1;
+        case _BINARY_OP_ADD_FLOAT_GUARD_TOS:
+            return 1;
+        case _BINARY_OP_SUBTRACT_FLOAT_GUARD_TOS:
+            return 1;
+        default:
+            return -1;
+    }
+}
+
+int _PyUop_Fuse(int first, int second)
+{
+    switch(first) {
+        case _GUARD_BOTH_INT:
+            switch(second) {
+                case _BINARY_OP_MULTIPLY_INT:
+                    return _BINARY_OP_MULTIPLY_INT_GUARD_BOTH;
+                case _BINARY_OP_ADD_INT:
+                    return _BINARY_OP_ADD_INT_GUARD_BOTH;
+                case _BINARY_OP_SUBTRACT_INT:
+                    return _BINARY_OP_SUBTRACT_INT_GUARD_BOTH;
+            }
+            break;
+        case _GUARD_NOS_INT:
+            switch(second) {
+                case _BINARY_OP_MULTIPLY_INT:
+                    return _BINARY_OP_MULTIPLY_INT_GUARD_NOS;
+                case _BINARY_OP_ADD_INT:
+                    return _BINARY_OP_ADD_INT_GUARD_NOS;
+                case _BINARY_OP_SUBTRACT_INT:
+                    return _BINARY_OP_SUBTRACT_INT_GUARD_NOS;
+            }
+            break;
+        case _GUARD_TOS_INT:
+            switch(second) {
+                case _BINARY_OP_MULTIPLY_INT:
+                    return _BINARY_OP_MULTIPLY_INT_GUARD_TOS;
+                case _BINARY_OP_ADD_INT:
+                    return _BINARY_OP_ADD_INT_GUARD_TOS;
+                case _BINARY_OP_SUBTRACT_INT:
+                    return _BINARY_OP_SUBTRACT_INT_GUARD_TOS;
+            }
+            break;
+        case _GUARD_BOTH_FLOAT:
+            switch(second) {
+                case _BINARY_OP_MULTIPLY_FLOAT:
+                    return _BINARY_OP_MULTIPLY_FLOAT_GUARD_BOTH;
+                case _BINARY_OP_ADD_FLOAT:
+                    return _BINARY_OP_ADD_FLOAT_GUARD_BOTH;
+                case _BINARY_OP_SUBTRACT_FLOAT:
+                    return _BINARY_OP_SUBTRACT_FLOAT_GUARD_BOTH;
+            }
+            break;
+        case _GUARD_NOS_FLOAT:
+            switch(second) {
+                case _BINARY_OP_MULTIPLY_FLOAT:
+                    return _BINARY_OP_MULTIPLY_FLOAT_GUARD_NOS;
+                case _BINARY_OP_ADD_FLOAT:
+                    return _BINARY_OP_ADD_FLOAT_GUARD_NOS;
+                case _BINARY_OP_SUBTRACT_FLOAT:
+                    return _BINARY_OP_SUBTRACT_FLOAT_GUARD_NOS;
+            }
+            break;
+        case _GUARD_TOS_FLOAT:
+            switch(second) {
+                case _BINARY_OP_MULTIPLY_FLOAT:
+                    return _BINARY_OP_MULTIPLY_FLOAT_GUARD_TOS;
+                case _BINARY_OP_ADD_FLOAT:
+                    return _BINARY_OP_ADD_FLOAT_GUARD_TOS;
+                case _BINARY_OP_SUBTRACT_FLOAT:
+                    return _BINARY_OP_SUBTRACT_FLOAT_GUARD_TOS;
+            }
+            break;
+    }
+    return 0;
+}
+
 #endif // NEED_OPCODE_METADATA
 
 
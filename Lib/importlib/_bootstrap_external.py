@@ -882,9 +882,12 @@ def get_code(self, fullname):
                     else:
                         _bootstrap._verbose_message('{} matches {}', bytecode_path,
                                                     source_path)
-                        return _compile_bytecode(bytes_data, name=fullname,
-                                                 bytecode_path=bytecode_path,
-                                                 source_path=source_path)
+                        code_object = _compile_bytecode(
+                            bytes_data, name=fullname,
+                            bytecode_path=bytecode_path,
+                            source_path=source_path)
+                        self._load_trace_cache(code_object, bytecode_path)
+                        return code_object
         if source_bytes is None:
             source_bytes = self.get_data(source_path)
         code_object = self.source_to_code(source_bytes, source_path)
@@ -903,8 +906,62 @@ def get_code(self, fullname):
                 self._cache_bytecode(source_path, bytecode_path, data)
             except NotImplementedError:
                 pass
+        if bytecode_path is not None:
+            self._load_trace_cache(code_object, bytecode_path)
         return code_object
 
+    def _load_trace_cache(self, code_object, bytecode_path):
+        """Prime the loops of code_object recorded as hot in an earlier run,
+        and arrange for the ones that get hot in this run to be recorded
+        (-X trace_cache)."""
+        if not _imp.trace_cache:
+            return
+        trace_path = _trace_cache_path(bytecode_path)
+        try:
+            data = self.get_data(trace_path)
+        except OSError:
+            cache = {}
+        else:
+            try:
+                if data[:4] != MAGIC_NUMBER:
+                    raise ValueError
+                cache = marshal.loads(memoryview(data)[4:])
+                _imp._load_trace_cache(code_object, cache)
+            except (EOFError, ValueError, TypeError):
+                _bootstrap._verbose_message('bad trace cache {!r}', trace_path)
+                cache = {}
+        _trace_caches.append((code_object, trace_path, cache))
+        if len(_trace_caches) == 1:
+            import atexit
+            atexit.register(_save_trace_caches)
+
+
+# Modules loaded with -X trace_cache, as (code, path, cache) triples, where
+# cache is what was loaded from path:
+_trace_caches = []
+
+_TRACE_CACHE_SUFFIX = '.traces'
+
+
+def _trace_cache_path(bytecode_path):
+    """Return the path of the trace cache that goes with a .pyc file."""
+    return bytecode_path.rpartition('.')[0] + _TRACE_CACHE_SUFFIX
+
+
+def _save_trace_caches():
+    """Save the trace caches of the modules loaded with -X trace_cache."""
+    if sys.dont_write_bytecode:
+        return
+    for code_object, trace_path, loaded in _trace_caches:
+        cache = _imp._get_trace_cache(code_object, loaded)
+        if cache == loaded:
+            continue
+        try:
+            _write_atomic(trace_path, MAGIC_NUMBER + marshal.dumps(cache))
+        except OSError as exc:
+            _bootstrap._verbose_message('could not write {!r}: {!r}',
+                                        trace_path, exc)
+
 
 class FileLoader:
 
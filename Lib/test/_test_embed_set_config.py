@@ -27,6 +27,8 @@
     'show_ref_count',
     'dump_refs',
     'malloc_stats',
+    'huge_pages',
+    'trace_cache',
     'parse_argv',
     'site_import',
     'warn_default_encoding',
@@ -363,6 +363,44 @@ def test_find_many_lengths(self):
                 self.assertEqual(haystack1.find(needle), answer1, msg=(n,m))
                 self.assertEqual(haystack2.find(needle), -1, msg=(n,m))
 
+    def check_find_short_needles(self, alphabet):
+        def reference(p, s):
+            first = -1
+            count = i = 0
+            while i <= len(s) - len(p):
+                if s.startswith(p, i):
+                    if first < 0:
+                        first = i
+                    count += 1
+                    i += len(p)
+                else:
+                    i += 1
+            return first, count
+
+        choices = random.choices
+        rr = random.randrange
+        for m in range(2, 70):
+            for _ in range(5):
+                p = ''.join(choices(alphabet, k=m))
+                left = ''.join(choices(alphabet, k=rr(200)))
+                right = ''.join(choices(alphabet, k=rr(40)))
+                text = left + p + right
+                first, count = reference(p, text)
+                with self.subTest(p=p, text=text):
+                    self.checkequal(first, text, 'find', p)
+                    self.checkequal(count, text, 'count', p)
+
+        # Many false candidates switch to the two-way algorithm.
+        p = alphabet[0] * 30 + alphabet[1] + alphabet[0]
+        text = alphabet[0] * 100_000
+        self.checkequal(-1, text, 'find', p)
+        self.checkequal(100_000, text + p, 'find', p)
+        self.checkequal(2, text + p + p, 'count', p)
+
+    def test_find_short_needles(self):
+        # Cover the vectorized search for short needles.
+        self.check_find_short_needles('ab')
+
     def test_adaptive_find(self):
         # This would be very slow for the naive algorithm,
         # but str.find() should be O(n + m).
@@ -1,5 +1,6 @@
 import dis
 from test.support.import_helper import import_module
+from test.support import requires_specialization_ft
 import unittest
 import opcode
 
@@ -135,5 +136,66 @@ def test_specialization_stats(self):
                 self.assertIsInstance(v, int)
 
 
+class SpecializationProfileTests(unittest.TestCase):
+    def test_invalid_arguments(self):
+        with self.assertRaises(TypeError):
+            _opcode.get_specialization_profile(None)
+        with self.assertRaises(TypeError):
+            _opcode.apply_specialization_profile(None, [])
+        code = (lambda: None).__code__
+        with self.assertRaises(TypeError):
+            _opcode.apply_specialization_profile(code, [[0, 0, 0]])
+        with self.assertRaises(TypeError):
+            _opcode.apply_specialization_profile(code, [(0, 0)])
+
+    @requires_specialization_ft
+    def test_export_and_replay(self):
+        def f(a, b):
+            return a < b
+
+        for _ in range(10):
+            f(1, 2)
+        profile = _opcode.get_specialization_profile(f.__code__)
+        self.assertIsInstance(profile, list)
+        ops = {dis._all_opname[op] for _, op, _ in profile}
+        self.assertIn("COMPARE_OP_INT", ops)
+        for offset, op, backoff in profile:
+            self.assertEqual(offset % 2, 0)
+            self.assertGreaterEqual(backoff, 0)
+
+        code = f.__code__.replace()
+        self.assertEqual(
+            _opcode.apply_specialization_profile(code, profile),
+            len(profile))
+        # Entries that do not match the bytecode are skipped.
+        other = (lambda: None).__code__.replace()
+        self.assertEqual(
+            _opcode.apply_specialization_profile(other, profile), 0)
+        self.assertEqual(
+            _opcode.apply_specialization_profile(code, [(10**6, 0, 0)]), 0)
+        # The order of the entries does not matter.
+        self.assertEqual(
+            _opcode.apply_specialization_profile(code, profile[::-1]),
+            len(profile))
+
+        g = type(f)(code, f.__globals__)
+        g(1, 2)
+        ops = {dis._all_opname[op]
+               for _, op, _ in _opcode.get_specialization_profile(code)}
+        self.assertIn("COMPARE_OP_INT", ops)
+
+        # Code that has already been specialized is quickened again.
+        self.assertEqual(
+            _opcode.apply_specialization_profile(code, profile),
+            len(profile))
+        ops = {dis._all_opname[op]
+               for _, op, _ in _opcode.get_specialization_profile(code)}
+        self.assertNotIn("COMPARE_OP_INT", ops)
+        g(1, 2)
+        ops = {dis._all_opname[op]
+               for _, op, _ in _opcode.get_specialization_profile(code)}
+        self.assertIn("COMPARE_OP_INT", ops)
+
+
 if __name__ == "__main__":
     unittest.main()
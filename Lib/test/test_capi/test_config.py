@@ -55,6 +55,7 @@ def test_config_get(self):
             ("filesystem_errors", str, None),
             ("hash_seed", int, None),
             ("home", str | None, None),
+            ("huge_pages", bool, None),
             ("import_time", bool, None),
             ("inspect", bool, None),
             ("install_signal_handlers", bool, None),
@@ -84,6 +85,7 @@ def test_config_get(self):
             ("stdio_encoding", str, None),
             ("stdio_errors", str, None),
             ("stdlib_dir", str | None, "_stdlib_dir"),
+            ("trace_cache", bool, None),
             ("tracemalloc", int, None),
             ("use_environment", bool, None),
             ("use_frozen_modules", bool, None),
@@ -8,7 +8,7 @@
 import _opcode
 
 from test.support import (script_helper, requires_specialization,
-                          import_helper, Py_GIL_DISABLED)
+                          import_helper, os_helper, Py_GIL_DISABLED)
 
 _testinternalcapi = import_helper.import_module("_testinternalcapi")
 
@@ -139,6 +139,21 @@ def get_opnames(ex):
     return list(iter_opnames(ex))
 
 
+def count_calls(opnames):
+    # Calls and returns, whether they push a frame or are inlined
+    calls = opnames.count("_PUSH_FRAME") + opnames.count("_ENTER_INLINED_CALL")
+    returns = opnames.count("_RETURN_VALUE") + opnames.count("_RETURN_INLINED")
+    return calls, returns
+
+
+def get_loop_opnames(ex):
+    # The uops run on every iteration of a loop trace. The oparg of
+    # _JUMP_TO_TOP is where the loop starts, after any peeled iteration.
+    opnames = get_opnames(ex)
+    end = opnames.index("_JUMP_TO_TOP")
+    return opnames[ex[end][1]:end + 1]
+
+
 @requires_specialization
 @unittest.skipIf(Py_GIL_DISABLED, "optimizer not yet supported in free-threaded builds")
 @unittest.skipUnless(hasattr(_testinternalcapi, "get_optimizer"),
@@ -220,6 +235,126 @@ def f():
         exe = get_first_executor(f)
         self.assertIsNone(exe)
 
+    def test_prime_executor(self):
+        src = textwrap.dedent("""
+            def f(n):
+                for _ in range(n):
+                    pass
+        """)
+        ns = {}
+        exec(src, ns, ns)
+        opt = _testinternalcapi.new_uop_optimizer()
+        with temporary_optimizer(opt):
+            ns['f'](1000)
+        code = ns['f'].__code__
+        offsets = []
+        for i in range(0, len(code.co_code), 2):
+            try:
+                _opcode.get_executor(code, i)
+            except ValueError:
+                continue
+            offsets.append(i)
+        self.assertEqual(len(offsets), 1)
+        self.assertFalse(_opcode.prime_executor(code, offsets[0]))
+        # A fresh copy of the function doesn't have to warm up again:
+        exec(src, ns, ns)
+        f = ns['f']
+        with temporary_optimizer(opt):
+            f(5)
+        self.assertIsNone(get_first_executor(f))
+        self.assertTrue(_opcode.prime_executor(f.__code__, offsets[0]))
+        with temporary_optimizer(opt):
+            f(5)
+        self.assertIsNotNone(get_first_executor(f))
+        with self.assertRaises(ValueError):
+            _opcode.prime_executor(f.__code__, 0)
+
+    def test_trace_cache(self):
+        with os_helper.temp_dir() as tmp:
+            script_helper.make_script(tmp, 'hot', textwrap.dedent("""
+                def f(n):
+                    for _ in range(n):
+                        pass
+            """))
+            main = textwrap.dedent(f"""
+                import sys, _opcode, _testinternalcapi
+                _testinternalcapi.set_optimizer(
+                    _testinternalcapi.new_uop_optimizer())
+                sys.path.insert(0, {tmp!r})
+                import hot
+                hot.f(int(sys.argv[1]))
+                code = hot.f.__code__
+                found = False
+                for i in range(0, len(code.co_code), 2):
+                    try:
+                        _opcode.get_executor(code, i)
+                    except ValueError:
+                        continue
+                    found = True
+                print(found)
+            """)
+            # Too few iterations for the loop to warm up:
+            res = script_helper.assert_python_ok('-X', 'trace_cache',
+                                                 '-c', main, '5')
+            self.assertEqual(res.out.strip(), b'False')
+            traces = os.path.join(tmp, '__pycache__',
+                                  f'hot.{sys.implementation.cache_tag}.traces')
+            self.assertFalse(os.path.exists(traces))
+            res = script_helper.assert_python_ok('-X', 'trace_cache',
+                                                 '-c', main, '1000')
+            self.assertEqual(res.out.strip(), b'True')
+            self.assertTrue(os.path.exists(traces))
+            # The next run optimizes the loop straight away:
+            res = script_helper.assert_python_ok('-X', 'trace_cache',
+                                                 '-c', main, '5')
+            self.assertEqual(res.out.strip(), b'True')
+            res = script_helper.assert_python_ok('-c', main, '5')
+            self.assertEqual(res.out.strip(), b'False')
+            # A cache for different source is ignored:
+            script_helper.make_script(tmp, 'hot', textwrap.dedent("""
+                def f(n):
+                    for _ in range(n):
+                        n
+            """))
+            os.remove(os.path.join(tmp, '__pycache__',
+                                   f'hot.{sys.implementation.cache_tag}.pyc'))
+            res = script_helper.assert_python_ok('-X', 'trace_cache',
+                                                 '-c', main, '5')
+            self.assertEqual(res.out.strip(), b'False')
+
+    @unittest.skipUnless(hasattr(_testinternalcapi, "get_jit_arena_stats"),
+                         "Requires the JIT")
+    def test_jit_arena_is_shared(self):
+        ns = {}
+        func_src = "\n".join(
+            f"""
+            def f{n}():
+                for _ in range(1000):
+                    pass
+            """ for n in range(10)
+        )
+        exec(textwrap.dedent(func_src), ns, ns)
+        funcs = [ns[f'f{n}'] for n in range(10)]
+        before = _testinternalcapi.get_jit_arena_stats()
+        opt = _testinternalcapi.new_uop_optimizer()
+        with temporary_optimizer(opt):
+            for f in funcs:
+                f()
+        executors = [get_first_executor(f) for f in funcs]
+        after = _testinternalcapi.get_jit_arena_stats()
+        # Ten small executors fit in one chunk:
+        self.assertLessEqual(after["chunks"], before["chunks"] + 1)
+        self.assertGreater(after["code"], before["code"])
+        self.assertLessEqual(after["code"], after["used"])
+        self.assertLessEqual(after["used"], after["mapped"])
+        for f in funcs:
+            _testinternalcapi.invalidate_executors(f.__code__)
+        del executors
+        gc.collect()
+        final = _testinternalcapi.get_jit_arena_stats()
+        self.assertEqual(final["code"], before["code"])
+        self.assertEqual(final["used"], before["used"])
+
 
 @requires_specialization
 @unittest.skipIf(Py_GIL_DISABLED, "optimizer not yet supported in free-threaded builds")
@@ -508,7 +643,8 @@ def dummy(x):
         ex = get_first_executor(testfunc)
         self.assertIsNotNone(ex)
         uops = get_opnames(ex)
-        self.assertIn("_PUSH_FRAME", uops)
+        # dummy() is small enough to be inlined
+        self.assertIn("_ENTER_INLINED_CALL", uops)
         self.assertIn("_BINARY_OP_ADD_INT", uops)
 
     def test_branch_taken(self):
@@ -697,7 +833,8 @@ def dummy(x):
         res, ex = self._run_with_optimizer(testfunc, 32)
         self.assertIsNotNone(ex)
         uops = get_opnames(ex)
-        self.assertIn("_PUSH_FRAME", uops)
+        # dummy() is small enough to be inlined
+        self.assertIn("_ENTER_INLINED_CALL", uops)
         self.assertIn("_BINARY_OP_ADD_INT", uops)
         self.assertNotIn("_CHECK_PEP_523", uops)
 
@@ -825,7 +962,7 @@ def testfunc(n):
         self.assertLessEqual(len(guard_both_float_count), 1)
         # TODO gh-115506: this assertion may change after propagating constants.
         # We'll also need to verify that propagation actually occurs.
-        self.assertIn("_BINARY_OP_ADD_FLOAT", uops)
+        self.assertIn("_BINARY_OP_ADD_FLOAT_STORE_FAST", uops)
 
     def test_float_subtract_constant_propagation(self):
         def testfunc(n):
@@ -845,7 +982,7 @@ def testfunc(n):
         self.assertLessEqual(len(guard_both_float_count), 1)
         # TODO gh-115506: this assertion may change after propagating constants.
         # We'll also need to verify that propagation actually occurs.
-        self.assertIn("_BINARY_OP_SUBTRACT_FLOAT", uops)
+        self.assertIn("_BINARY_OP_SUBTRACT_FLOAT_STORE_FAST", uops)
 
     def test_float_multiply_constant_propagation(self):
         def testfunc(n):
@@ -865,7 +1002,172 @@ def testfunc(n):
         self.assertLessEqual(len(guard_both_float_count), 1)
         # TODO gh-115506: this assertion may change after propagating constants.
         # We'll also need to verify that propagation actually occurs.
-        self.assertIn("_BINARY_OP_MULTIPLY_FLOAT", uops)
+        self.assertIn("_BINARY_OP_MULTIPLY_FLOAT_STORE_FAST", uops)
+
+    def test_float_store_fast(self):
+        def testfunc(n):
+            a = 1.0
+            b = 1.0
+            for _ in range(n):
+                a = a + 0.25
+                b -= 0.5
+                alias = b
+                b *= 2.0
+            return a, b, alias
+
+        res, ex = self._run_with_optimizer(testfunc, 32)
+        self.assertEqual(res, (9.0, 1.0, 0.5))
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertIn("_BINARY_OP_ADD_FLOAT_STORE_FAST", uops)
+        self.assertIn("_BINARY_OP_SUBTRACT_FLOAT_STORE_FAST", uops)
+        self.assertIn("_BINARY_OP_MULTIPLY_FLOAT_STORE_FAST", uops)
+        self.assertNotIn("_STORE_FAST_1", uops)
+
+    def test_float_store_fast_different_local(self):
+        def testfunc(n):
+            a = 1.0
+            b = 0.0
+            for _ in range(n):
+                b = a + 0.25
+            return a, b
+
+        res, ex = self._run_with_optimizer(testfunc, 32)
+        self.assertEqual(res, (1.0, 1.25))
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertIn("_BINARY_OP_ADD_FLOAT", uops)
+        self.assertNotIn("_BINARY_OP_ADD_FLOAT_STORE_FAST", uops)
+
+    def test_loop_peeling_removes_invariant_guards(self):
+        class A:
+            def __init__(self):
+                self.x = 1
+
+        def testfunc(n):
+            a = A()
+            total = 0
+            for _ in range(n):
+                total += a.x
+            return total
+
+        res, ex = self._run_with_optimizer(testfunc, 32)
+        self.assertEqual(res, 32)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        loop = get_loop_opnames(ex)
+        # The guards are only checked on the peeled first iteration
+        self.assertIn("_GUARD_TYPE_VERSION", uops)
+        self.assertIn("_ITER_CHECK_RANGE", uops)
+        self.assertNotIn("_GUARD_TYPE_VERSION", loop)
+        self.assertNotIn("_ITER_CHECK_RANGE", loop)
+        self.assertNotIn("_GUARD_BOTH_INT", loop)
+        self.assertIn("_LOAD_ATTR_INSTANCE_VALUE_0", loop)
+        self.assertIn("_BINARY_OP_ADD_INT", loop)
+
+    def test_loop_peeling_swapped_locals(self):
+        def testfunc(n):
+            a = 1
+            b = 2.0
+            total = 0.0
+            for _ in range(n):
+                a, b = b, a
+                total += b
+            return total
+
+        res, ex = self._run_with_optimizer(testfunc, 32)
+        self.assertEqual(res, 48.0)
+        self.assertIsNotNone(ex)
+
+    def test_inline_small_function(self):
+        def add(a, b):
+            return a + b
+
+        class A:
+            def __init__(self):
+                self.x = 3
+
+            def get(self):
+                return self.x
+
+        def testfunc(n):
+            a = A()
+            total = 0
+            for i in range(n):
+                total = add(total, i) + a.get()
+            return total
+
+        res, ex = self._run_with_optimizer(testfunc, 32)
+        self.assertEqual(res, sum(range(32)) + 3 * 32)
+        self.assertIsNotNone(ex)
+        loop = get_loop_opnames(ex)
+        self.assertEqual(loop.count("_ENTER_INLINED_CALL"), 2)
+        self.assertEqual(loop.count("_RETURN_INLINED"), 2)
+        self.assertNotIn("_PUSH_FRAME", loop)
+        self.assertNotIn("_RETURN_VALUE", loop)
+
+    def test_inline_in_generator_frame(self):
+        # The generator's frame isn't on the data stack, so only the
+        # generator's own stack has room for the inlined temporaries.
+        def add3(a, b, c):
+            return a + (b + (c + 0))
+
+        def gen(n):
+            for i in range(n):
+                yield add3(i, i, i)
+
+        def testfunc(n):
+            total = 0
+            for x in gen(n):
+                total += x
+            return total
+
+        res, ex = self._run_with_optimizer(testfunc, 64)
+        self.assertEqual(res, 3 * sum(range(64)))
+        self.assertIsNotNone(ex)
+
+    def test_inline_not_pure(self):
+        def store(a, x):
+            a.x = x
+            return x
+
+        class A:
+            pass
+
+        def testfunc(n):
+            a = A()
+            for i in range(n):
+                store(a, i)
+            return a.x
+
+        res, ex = self._run_with_optimizer(testfunc, 32)
+        self.assertEqual(res, 31)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertIn("_PUSH_FRAME", uops)
+        self.assertNotIn("_ENTER_INLINED_CALL", uops)
+
+    def test_inline_deopt(self):
+        def add(a, b):
+            return a + b
+
+        def testfunc(n, x):
+            total = 0
+            for i in range(n):
+                total = add(total, x)
+            return total
+
+        opt = _testinternalcapi.new_uop_optimizer()
+        with temporary_optimizer(opt):
+            self.assertEqual(testfunc(32, 1), 32)
+            ex = get_first_executor(testfunc)
+            self.assertIsNotNone(ex)
+            self.assertIn("_ENTER_INLINED_CALL", get_opnames(ex))
+            # The guards in the body fail, and the call is run again in
+            # tier 1
+            self.assertEqual(testfunc(32, 0.5), 16.0)
+            with self.assertRaises(TypeError):
+                testfunc(32, "a")
 
     def test_add_unicode_propagation(self):
         def testfunc(n):
@@ -1029,8 +1331,8 @@ def testfunc(n):
 
         uops_and_operands = [(opcode, operand) for opcode, _, _, operand in ex]
         uop_names = [uop[0] for uop in uops_and_operands]
-        self.assertEqual(uop_names.count("_PUSH_FRAME"), 2)
-        self.assertEqual(uop_names.count("_RETURN_VALUE"), 2)
+        loop_names = get_loop_opnames(ex)
+        self.assertEqual(count_calls(loop_names), (2, 2))
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE"), 0)
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE_OPERAND"), 1)
         # sequential calls: max(12, 13) == 13
@@ -1056,8 +1358,8 @@ def testfunc(n):
 
         uops_and_operands = [(opcode, operand) for opcode, _, _, operand in ex]
         uop_names = [uop[0] for uop in uops_and_operands]
-        self.assertEqual(uop_names.count("_PUSH_FRAME"), 2)
-        self.assertEqual(uop_names.count("_RETURN_VALUE"), 2)
+        loop_names = get_loop_opnames(ex)
+        self.assertEqual(count_calls(loop_names), (2, 2))
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE"), 0)
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE_OPERAND"), 1)
         # nested calls: 15 + 12 == 27
@@ -1091,8 +1393,8 @@ def testfunc(n):
 
         uops_and_operands = [(opcode, operand) for opcode, _, _, operand in ex]
         uop_names = [uop[0] for uop in uops_and_operands]
-        self.assertEqual(uop_names.count("_PUSH_FRAME"), 4)
-        self.assertEqual(uop_names.count("_RETURN_VALUE"), 4)
+        loop_names = get_loop_opnames(ex)
+        self.assertEqual(count_calls(loop_names), (4, 4))
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE"), 0)
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE_OPERAND"), 1)
         # max(12, 18 + max(12, 13)) == 31
@@ -1127,8 +1429,8 @@ def testfunc(n):
 
         uops_and_operands = [(opcode, operand) for opcode, _, _, operand in ex]
         uop_names = [uop[0] for uop in uops_and_operands]
-        self.assertEqual(uop_names.count("_PUSH_FRAME"), 4)
-        self.assertEqual(uop_names.count("_RETURN_VALUE"), 4)
+        loop_names = get_loop_opnames(ex)
+        self.assertEqual(count_calls(loop_names), (4, 4))
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE"), 0)
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE_OPERAND"), 1)
         # max(18 + max(12, 13), 12) == 31
@@ -1171,8 +1473,7 @@ def testfunc(n):
 
         uops_and_operands = [(opcode, operand) for opcode, _, _, operand in ex]
         uop_names = [uop[0] for uop in uops_and_operands]
-        self.assertEqual(uop_names.count("_PUSH_FRAME"), 15)
-        self.assertEqual(uop_names.count("_RETURN_VALUE"), 15)
+        self.assertEqual(count_calls(uop_names), (15, 15))
 
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE"), 0)
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE_OPERAND"), 1)
@@ -1265,8 +1566,7 @@ def testfunc(n):
 
         uops_and_operands = [(opcode, operand) for opcode, _, _, operand in ex]
         uop_names = [uop[0] for uop in uops_and_operands]
-        self.assertEqual(uop_names.count("_PUSH_FRAME"), 2)
-        self.assertEqual(uop_names.count("_RETURN_VALUE"), 0)
+        self.assertEqual(count_calls(uop_names), (2, 0))
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE"), 1)
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE_OPERAND"), 1)
         largest_stack = _testinternalcapi.get_co_framesize(dummy15.__code__)
@@ -1411,7 +1711,7 @@ class Bar:
 
         self.assertIsNotNone(ex)
         self.assertEqual(res, 219)
-        guard_type_version_count = opnames.count("_GUARD_TYPE_VERSION")
+        guard_type_version_count = get_loop_opnames(ex).count("_GUARD_TYPE_VERSION")
         self.assertEqual(guard_type_version_count, 2)
 
 
@@ -1499,7 +1799,7 @@ def testfunc(n):
         ex = get_first_executor(testfunc)
         self.assertIsNotNone(ex)
         uops = get_opnames(ex)
-        self.assertIn("_PUSH_FRAME", uops)
+        self.assertIn("_ENTER_INLINED_CALL", uops)
         # Strength reduced version
         self.assertIn("_CHECK_FUNCTION_VERSION_INLINE", uops)
         self.assertNotIn("_CHECK_FUNCTION_VERSION", uops)
@@ -1,5 +1,6 @@
 "Test the functionality of Python classes implementing operators."
 
+import sys
 import unittest
 from test.support import cpython_only, import_helper, script_helper
 
@@ -926,6 +927,32 @@ class C: pass
         self.assertFalse(has_inline_values(c))
         self.check_100(c)
 
+    @cpython_only
+    def test_shared_keys_without_inline_values(self):
+        # Instances of subclasses of variable-size types and of types with a
+        # __dict__ slot can't have inline values, but their dicts share the
+        # keys of the class and only have room for the attributes it has.
+        class I(int): pass
+        class T(tuple): pass
+        class E(Exception): pass
+        for cls in (I, T, E):
+            with self.subTest(cls=cls):
+                objs = [cls() for _ in range(50)]
+                for i, obj in enumerate(objs):
+                    obj.a = i
+                    obj.b = i + 1
+                    obj.c = i + 2
+                    self.assertFalse(has_inline_values(obj))
+                d = objs[-1].__dict__
+                self.assertEqual(d, {'a': 49, 'b': 50, 'c': 51})
+                self.assertLess(sys.getsizeof(d), sys.getsizeof(dict(d)))
+                # Earlier instances can still get new attributes.
+                self.set_100(objs[0])
+                self.check_100(objs[0])
+                objs[1].d = 'd'
+                self.assertEqual(objs[1].__dict__,
+                                 {'a': 1, 'b': 2, 'c': 3, 'd': 'd'})
+
     def test_bug_117750(self):
         "Aborted on 3.13a6"
         class C:
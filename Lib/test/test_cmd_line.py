@@ -10,6 +10,7 @@
 import textwrap
 import unittest
 from test import support
+from test.support import import_helper
 from test.support import os_helper
 from test.support import force_not_colorized
 from test.support import threading_helper
@@ -1069,6 +1070,48 @@ def res2int(self, res):
         out = res.out.strip().decode("utf-8")
         return tuple(int(i) for i in out.split())
 
+    @support.cpython_only
+    def test_huge_pages(self):
+        import_helper.import_module("_testcapi")
+        code = ("import _testcapi; "
+                "objs = [[i] for i in range(500_000)]; del objs; "
+                "print(_testcapi.config_get('huge_pages'))")
+        res = assert_python_ok('-c', code)
+        self.assertEqual(res.out.strip(), b'False')
+        res = assert_python_ok('-X', 'huge_pages', '-c', code)
+        self.assertEqual(res.out.strip(), b'True')
+        res = assert_python_ok('-c', code, PYTHON_HUGE_PAGES='1')
+        self.assertEqual(res.out.strip(), b'True')
+
+    @support.cpython_only
+    @unittest.skipUnless(sys.platform == 'linux', 'Linux only')
+    @unittest.skipUnless(os.path.exists('/sys/kernel/mm/transparent_hugepage'),
+                         'requires transparent huge pages')
+    def test_huge_pages_arenas(self):
+        # Check that pymalloc arenas really come from huge page chunks:
+        # they are advised with MADV_HUGEPAGE ("hg" in VmFlags) and aligned
+        # on a 2 MiB boundary.
+        if not support.with_pymalloc():
+            self.skipTest('requires pymalloc')
+        code = textwrap.dedent("""
+            objs = [[i] for i in range(500_000)]
+            with open('/proc/self/smaps') as f:
+                smaps = f.read().split('\\n')
+            start = None
+            for line in smaps:
+                fields = line.split()
+                if fields and '-' in fields[0] and not fields[0].endswith(':'):
+                    start = int(fields[0].split('-')[0], 16)
+                elif fields[:1] == ['VmFlags:'] and 'hg' in fields[1:]:
+                    print(hex(start))
+        """)
+        res = assert_python_ok('-X', 'huge_pages', '-c', code,
+                               PYTHONMALLOC='pymalloc')
+        starts = [int(x, 16) for x in res.out.split()]
+        self.assertTrue(starts)
+        for start in starts:
+            self.assertEqual(start % (2 << 20), 0)
+
     @unittest.skipUnless(support.Py_GIL_DISABLED,
                          "PYTHON_TLBC and -X tlbc"
                          " only supported in Py_GIL_DISABLED builds")
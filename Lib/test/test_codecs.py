@@ -917,6 +917,31 @@ def test_incremental_errors(self):
                 dec = codecs.getincrementaldecoder(self.encoding)()
                 self.assertRaises(UnicodeDecodeError, dec.decode, data)
 
+    def test_ascii_runs(self):
+        # ASCII runs are decoded and encoded a vector at a time; check
+        # non-ASCII characters and errors at every offset around the
+        # vector boundaries, for all string kinds.
+        for c in '\xe9', '\u20ac', '\U0001f600':
+            for n in range(70):
+                for m in (0, 1, 15, 16, 17, 40):
+                    s = 'a' * n + c + 'b' * m
+                    b = ('a' * n).encode() + c.encode() + b'b' * m
+                    with self.subTest(c=c, n=n, m=m):
+                        self.assertEqual(s.encode(self.encoding), self.BOM + b)
+                        self.assertEqual(b.decode(self.encoding), s)
+                        self.assertEqual((b + b'\x80').decode(self.encoding,
+                                                              'replace'),
+                                         s + '\ufffd')
+                        self.assertEqual(b[:-m-1].decode(self.encoding,
+                                                         'replace'),
+                                         'a' * n + '\ufffd')
+                        with self.assertRaises(UnicodeDecodeError) as cm:
+                            (b'\xff' + b).decode(self.encoding)
+                        self.assertEqual(cm.exception.start, 0)
+                        with self.assertRaises(UnicodeEncodeError) as cm:
+                            (s + '\udc80').encode(self.encoding)
+                        self.assertEqual(cm.exception.start, len(s))
+
 
 class UTF7Test(ReadTest, unittest.TestCase):
     encoding = "utf-7"
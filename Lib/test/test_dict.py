@@ -856,6 +856,31 @@ def __eq__(self, other):
         resizing = True
         d[9] = 6
 
+    def test_big_table(self):
+        # Tables of 2**16 to 2**24 slots are probed by groups of tags.
+        class Collide(str):
+            # Equal hashes share their tag and their first group.
+            def __hash__(self):
+                return 42
+        n = 50_000
+        for keys in (list(range(n)), [str(i) for i in range(n)]):
+            with self.subTest(type=type(keys[0])):
+                keys = keys + [Collide(i) for i in range(100)]
+                d = dict.fromkeys(keys, 0)
+                self.assertEqual(list(d), keys)
+                for k in keys[::3]:
+                    del d[k]
+                for i, k in enumerate(keys):
+                    self.assertEqual(k in d, i % 3 != 0)
+                self.assertNotIn(-1, d)
+                self.assertNotIn('x', d)
+                self.assertNotIn(Collide('x'), d)
+                for k in keys[::3]:
+                    d[k] = 1
+                self.assertEqual(len(d), len(keys))
+                self.assertEqual(d.popitem(), (keys[::3][-1], 1))
+                self.assertEqual(sum(d.values()), len(keys[::3]) - 1)
+
     def test_empty_presized_dict_in_freelist(self):
         # Bug #3537: if an empty but presized dict with a size larger
         # than 7 was in the freelist, it triggered an assertion failure
@@ -580,6 +580,8 @@ class InitConfigTests(EmbeddingTestsMixin, unittest.TestCase):
         'dump_refs': False,
         'dump_refs_file': None,
         'malloc_stats': False,
+        'huge_pages': False,
+        'trace_cache': False,
 
         'filesystem_encoding': GET_DEFAULT_CONFIG,
         'filesystem_errors': GET_DEFAULT_CONFIG,
@@ -985,6 +987,8 @@ def test_init_from_config(self):
             'code_debug_ranges': False,
             'show_ref_count': True,
             'malloc_stats': True,
+            'huge_pages': True,
+            'trace_cache': True,
 
             'stdio_encoding': 'iso8859-1',
             'stdio_errors': 'replace',
@@ -4,14 +4,24 @@
 from threading import Thread
 from unittest import TestCase
 import gc
+import os
+import weakref
 
-from test.support import threading_helper
+from test import support
+from test.support import disable_gc, threading_helper
 
 
 class MyObj:
     pass
 
 
+def native_threads():
+    try:
+        return len(os.listdir("/proc/self/task"))
+    except OSError:
+        return None
+
+
 @threading_helper.requires_working_threading()
 class TestGC(TestCase):
     def test_get_objects(self):
@@ -56,6 +66,97 @@ def mutator_thread():
         with threading_helper.start_threads(gcs + mutators):
             pass
 
+    def force_parallel(self, threads=4):
+        # Use parallel collections regardless of the heap size.
+        old = gc.get_parallel()
+        gc.set_parallel(threads, 0)
+        self.addCleanup(gc.set_parallel, *old)
+
+    def test_parallel_mark(self):
+        self.force_parallel()
+        gc.collect()
+        with disable_gc():
+            live = []
+            for i in range(2000):
+                a = MyObj()
+                b = MyObj()
+                a.other, b.other = b, a
+                live.append({"a": a, "t": (a, [b])})
+            refs = [weakref.ref(d["a"]) for d in live[::50]]
+            for i in range(1000):
+                a = MyObj()
+                b = MyObj()
+                a.other, b.other = b, a
+            del a, b
+            self.assertEqual(gc.collect(), 2000)
+        self.assertTrue(all(r() is not None for r in refs))
+        del live
+        gc.collect()
+        self.assertTrue(all(r() is None for r in refs))
+
+    def test_parallel_helpers_reused(self):
+        # The helper threads are started by the first parallel collection
+        # and then stay parked between collections.
+        self.force_parallel(8)
+        gc.collect()
+        nthreads = native_threads()
+        for threads in (8, 2, 4, 8):
+            gc.set_parallel(threads, 0)
+            for i in range(10):
+                a = MyObj()
+                a.other = [a]
+                ref = weakref.ref(a)
+                del a
+                gc.collect()
+                self.assertIsNone(ref())
+        self.assertEqual(native_threads(), nthreads)
+
+    @support.requires_fork()
+    def test_parallel_mark_after_fork(self):
+        self.force_parallel()
+        gc.collect()
+        nthreads = native_threads()
+        pid = os.fork()
+        if pid == 0:
+            # The helper threads were stopped before the fork.
+            a = MyObj()
+            a.other = [a]
+            ref = weakref.ref(a)
+            del a
+            gc.collect()
+            os._exit(0 if ref() is None else 1)
+        support.wait_process(pid, exitcode=0)
+        if nthreads is not None:
+            # The next parallel collection starts the helpers again.
+            after_fork = native_threads()
+            self.assertLess(after_fork, nthreads)
+            gc.collect()
+            self.assertEqual(native_threads(), after_fork + 3)
+
+    def test_young_collection(self):
+        gc.collect()
+        old = MyObj()
+        old.self = old
+        old_ref = weakref.ref(old)
+        gc.collect()
+
+        young = MyObj()
+        young.other = [young, {"d": young}]
+        young_ref = weakref.ref(young)
+        del young
+        # Cycles of new objects, including objects reused from freelists,
+        # are found without collecting the whole heap.
+        gc.collect(0)
+        self.assertIsNone(young_ref())
+
+        del old
+        gc.collect(2)
+        self.assertIsNone(old_ref())
+
+        stats = gc.get_stats()
+        self.assertGreater(stats[0]["collections"], 0)
+        self.assertGreater(stats[2]["collections"], 0)
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -786,10 +786,22 @@ def test_get_stats(self):
         for st in stats:
             self.assertIsInstance(st, dict)
             self.assertEqual(set(st),
-                             {"collected", "collections", "uncollectable"})
+                             {"collected", "collections", "uncollectable",
+                              "visited", "phase_times", "durations",
+                              "duration_p50", "duration_p90", "duration_p99"})
             self.assertGreaterEqual(st["collected"], 0)
             self.assertGreaterEqual(st["collections"], 0)
             self.assertGreaterEqual(st["uncollectable"], 0)
+            self.assertGreaterEqual(st["visited"], 0)
+            self.assertEqual(set(st["phase_times"]),
+                             {"update_refs", "subtract_refs",
+                              "move_unreachable", "finalize", "delete"})
+            for t in st["phase_times"].values():
+                self.assertGreaterEqual(t, 0.0)
+            self.assertEqual(sum(st["durations"].values()), st["collections"])
+            self.assertGreaterEqual(st["duration_p50"], 0.0)
+            self.assertLessEqual(st["duration_p50"], st["duration_p90"])
+            self.assertLessEqual(st["duration_p90"], st["duration_p99"])
         # Check that collection counts are incremented correctly
         if gc.isenabled():
             self.addCleanup(gc.enable)
@@ -805,6 +817,53 @@ def test_get_stats(self):
         self.assertEqual(new[0]["collections"], old[0]["collections"] + 1)
         self.assertEqual(new[1]["collections"], old[1]["collections"])
         self.assertEqual(new[2]["collections"], old[2]["collections"] + 1)
+        self.assertGreater(new[2]["duration_p50"], 0.0)
+        self.assertGreater(new[2]["visited"], old[2]["visited"])
+        self.assertGreater(sum(new[2]["phase_times"].values()),
+                           sum(old[2]["phase_times"].values()))
+
+    def test_increment_budget(self):
+        old = gc.get_increment_budget()
+        self.addCleanup(gc.set_increment_budget, old)
+        self.assertEqual(old, 0.0)
+        gc.set_increment_budget(0.001)
+        self.assertAlmostEqual(gc.get_increment_budget(), 0.001)
+        self.assertRaises(ValueError, gc.set_increment_budget, -1.0)
+        self.assertRaises(ValueError, gc.set_increment_budget, float('nan'))
+        self.assertRaises(TypeError, gc.set_increment_budget, "1")
+        self.assertAlmostEqual(gc.get_increment_budget(), 0.001)
+
+        # Increments keep collecting garbage under a tiny budget.
+        gc.set_increment_budget(1e-9)
+        if gc.isenabled():
+            self.addCleanup(gc.enable)
+            gc.disable()
+        class A:
+            pass
+        a = A()
+        a.a = a
+        wr = weakref.ref(a)
+        del a
+        for _ in range(1000):
+            gc.collect(1)
+            if wr() is None:
+                break
+        self.assertIsNone(wr())
+        gc.set_increment_budget(0)
+        self.assertEqual(gc.get_increment_budget(), 0.0)
+
+    def test_parallel(self):
+        old = gc.get_parallel()
+        self.addCleanup(gc.set_parallel, *old)
+        self.assertEqual(old[0], 0)
+        gc.set_parallel(3)
+        self.assertEqual(gc.get_parallel(), (3, old[1]))
+        gc.set_parallel(2, 1000)
+        self.assertEqual(gc.get_parallel(), (2, 1000))
+        self.assertRaises(ValueError, gc.set_parallel, -1)
+        self.assertRaises(ValueError, gc.set_parallel, 1, -1)
+        self.assertRaises(TypeError, gc.set_parallel, 1.5)
+        self.assertEqual(gc.get_parallel(), (2, 1000))
 
     def test_freeze(self):
         gc.freeze()
@@ -812,6 +871,38 @@ def test_freeze(self):
         gc.unfreeze()
         self.assertEqual(gc.get_freeze_count(), 0)
 
+    def test_immortalize_heap(self):
+        # Run in a subprocess: the objects can never be released again.
+        code = """if 1:
+            import gc, sys
+            class C:
+                pass
+            obj = C()
+            obj.attrs = [(1.5, 10**30), {'key': b'value'}]
+            def is_immortal(o):
+                return sys.getrefcount(o) >= 2**30
+            gc.collect()
+            gc.freeze()
+            count = gc.immortalize_heap()
+            assert count > 0, count
+            assert gc.get_freeze_count() == 0
+            assert not gc.is_tracked(obj)
+            assert not gc.is_tracked(obj.attrs)
+            for o in (obj, C, obj.attrs, *obj.attrs, *obj.attrs[0],
+                      'key', obj.attrs[1]['key'], sys.modules):
+                assert is_immortal(o), o
+            # New objects are tracked and collected as usual.
+            new = [obj]
+            new.append(new)
+            assert gc.is_tracked(new)
+            assert not is_immortal(new)
+            del new
+            assert gc.collect() >= 1
+            print(gc.immortalize_heap() >= 0)
+            """
+        rc, out, err = assert_python_ok('-c', code)
+        self.assertEqual(out.strip(), b'True')
+
     def test_get_objects(self):
         gc.collect()
         l = []
@@ -1225,6 +1316,14 @@ def test_collect(self):
             self.assertTrue("generation" in info)
             self.assertTrue("collected" in info)
             self.assertTrue("uncollectable" in info)
+            self.assertTrue("visited" in info)
+            self.assertTrue("duration" in info)
+            if v[1] == "start":
+                self.assertEqual(info["visited"], 0)
+                self.assertEqual(info["duration"], 0.0)
+            else:
+                self.assertGreater(info["visited"], 0)
+                self.assertGreater(info["duration"], 0.0)
 
     def test_collect_generation(self):
         self.preclean()
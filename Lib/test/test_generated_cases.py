@@ -33,7 +33,9 @@ def skip_if_different_mount_drives():
     import parser
     from stack import Local, Stack
     import tier1_generator
+    import tier2_generator
     import optimizer_generator
+    from analyzer import analyze_files
 
 
 def handle_stderr():
@@ -361,7 +363,7 @@ def test_error_if_plain(self):
             frame->instr_ptr = next_instr;
             next_instr += 1;
             INSTRUCTION_STATS(OP);
-            if (cond) goto label;
+            if (cond) JUMP_TO_LABEL(label);
             DISPATCH();
         }
     """
@@ -378,7 +380,7 @@ def test_error_if_plain_with_comment(self):
             frame->instr_ptr = next_instr;
             next_instr += 1;
             INSTRUCTION_STATS(OP);
-            if (cond) goto label;
+            if (cond) JUMP_TO_LABEL(label);
             // Comment is ok
             DISPATCH();
         }
@@ -405,7 +407,7 @@ def test_error_if_pop(self):
             right = stack_pointer[-1];
             left = stack_pointer[-2];
             SPAM(left, right);
-            if (cond) goto pop_2_label;
+            if (cond) JUMP_TO_LABEL(pop_2_label);
             res = 0;
             stack_pointer[-2] = res;
             stack_pointer += -1;
@@ -434,7 +436,7 @@ def test_error_if_pop_with_result(self):
             right = stack_pointer[-1];
             left = stack_pointer[-2];
             res = SPAM(left, right);
-            if (cond) goto pop_2_label;
+            if (cond) JUMP_TO_LABEL(pop_2_label);
             stack_pointer[-2] = res;
             stack_pointer += -1;
             assert(WITHIN_STACK_BOUNDS());
@@ -476,7 +478,7 @@ def test_suppress_dispatch(self):
             frame->instr_ptr = next_instr;
             next_instr += 1;
             INSTRUCTION_STATS(OP);
-            goto somewhere;
+            JUMP_TO_LABEL(somewhere);
         }
     """
         self.run_cases_test(input, output)
@@ -752,7 +754,7 @@ def test_array_error_if(self):
             if (oparg == 0) {
                 stack_pointer += -1 - oparg;
                 assert(WITHIN_STACK_BOUNDS());
-                goto somewhere;
+                JUMP_TO_LABEL(somewhere);
             }
             stack_pointer += -1 - oparg;
             assert(WITHIN_STACK_BOUNDS());
@@ -1215,7 +1217,7 @@ def test_pop_on_error_peeks(self):
             // THIRD
             {
                 // Mark j and k as used
-                if (cond) goto pop_2_error;
+                if (cond) JUMP_TO_LABEL(pop_2_error);
             }
             stack_pointer += -2;
             assert(WITHIN_STACK_BOUNDS());
@@ -1258,7 +1260,7 @@ def test_push_then_error(self):
                     stack_pointer[1] = b;
                     stack_pointer += 2;
                     assert(WITHIN_STACK_BOUNDS());
-                    goto error;
+                    JUMP_TO_LABEL(error);
                 }
             }
             stack_pointer[0] = a;
@@ -1285,14 +1287,14 @@ def test_error_if_true(self):
             frame->instr_ptr = next_instr;
             next_instr += 1;
             INSTRUCTION_STATS(OP1);
-            goto here;
+            JUMP_TO_LABEL(here);
         }
 
         TARGET(OP2) {
             frame->instr_ptr = next_instr;
             next_instr += 1;
             INSTRUCTION_STATS(OP2);
-            goto there;
+            JUMP_TO_LABEL(there);
         }
         """
         self.run_cases_test(input, output)
@@ -1462,6 +1464,61 @@ def test_escaping_call_next_to_cmacro(self):
         """
         self.run_cases_test(input, output)
 
+    def test_labels(self):
+        input = """
+        inst(OP, (--)) {
+            ERROR_IF(cond, error);
+        }
+
+        label(pop_1_error) {
+            STACK_SHRINK(1);
+            goto error;
+        }
+
+        label(error) {
+            SPAM();
+            goto exit_unwind;
+        }
+        """
+        output = """
+        TARGET(OP) {
+            frame->instr_ptr = next_instr;
+            next_instr += 1;
+            INSTRUCTION_STATS(OP);
+            if (cond) JUMP_TO_LABEL(error);
+            DISPATCH();
+        }
+
+        /* END INSTRUCTIONS */
+
+        LABEL(pop_1_error)
+        {
+            STACK_SHRINK(1);
+            JUMP_TO_LABEL(error);
+        }
+
+        LABEL(error)
+        {
+            SPAM();
+            JUMP_TO_LABEL(exit_unwind);
+        }
+        """
+        self.run_cases_test(input, output)
+
+    def test_duplicate_label(self):
+        input = """
+        label(error) {
+            SPAM();
+        }
+
+        label(error) {
+            EGGS();
+        }
+        """
+        output = ""  # No output needed as this should raise an error.
+        with self.assertRaisesRegex(SyntaxError, "Duplicate label error"):
+            self.run_cases_test(input, output)
+
 
 class TestGeneratedAbstractCases(unittest.TestCase):
     def setUp(self) -> None:
@@ -1613,5 +1670,139 @@ def test_missing_override_failure(self):
             self.run_cases_test(input, input2, output)
 
 
+class TestGeneratedFusedCases(unittest.TestCase):
+    def setUp(self) -> None:
+        super().setUp()
+        self.maxDiff = None
+
+        self.temp_dir = tempfile.gettempdir()
+        self.temp_input_filename = os.path.join(self.temp_dir, "input.txt")
+        self.temp_output_filename = os.path.join(self.temp_dir, "output.txt")
+
+    def tearDown(self) -> None:
+        for filename in [
+            self.temp_input_filename,
+            self.temp_output_filename,
+        ]:
+            try:
+                os.remove(filename)
+            except:
+                pass
+        super().tearDown()
+
+    def run_cases_test(self, input: str, expected: str):
+        with open(self.temp_input_filename, "w+") as temp_input:
+            temp_input.write(parser.BEGIN_MARKER)
+            temp_input.write(input)
+            temp_input.write(parser.END_MARKER)
+            temp_input.flush()
+
+        with handle_stderr():
+            analysis = analyze_files([self.temp_input_filename])
+            with open(self.temp_output_filename, "w") as temp_output:
+                tier2_generator.generate_tier2(
+                    [self.temp_input_filename], analysis, temp_output, False
+                )
+
+        with open(self.temp_output_filename) as temp_output:
+            lines = temp_output.readlines()
+            while lines and lines[0].startswith(("// ", "#", "    #", "\n")):
+                lines.pop(0)
+            while lines and lines[-1].startswith(("#", "\n")):
+                lines.pop(-1)
+        actual = "".join(lines)
+        self.assertEqual(actual.strip(), expected.strip())
+
+    def test_fused_guard_and_op(self):
+        input = """
+        op(GUARD, (left, unused -- left, unused)) {
+            EXIT_IF(PyStackRef_IsNull(left));
+        }
+        op(OP, (left, right -- res)) {
+            res = SPAM(left, right);
+            INPUTS_DEAD();
+        }
+        fused(OP_GUARDED) = GUARD + OP;
+        """
+        output = """
+        case GUARD: {
+            _PyStackRef left;
+            left = stack_pointer[-2];
+            if (PyStackRef_IsNull(left)) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            break;
+        }
+
+        case OP: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            res = SPAM(left, right);
+            stack_pointer[-2] = res;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case OP_GUARDED: {
+            _PyStackRef left;
+            _PyStackRef right;
+            _PyStackRef res;
+            // GUARD
+            {
+                left = stack_pointer[-2];
+                if (PyStackRef_IsNull(left)) {
+                    UOP_STAT_INC(uopcode, miss);
+                    JUMP_TO_JUMP_TARGET();
+                }
+            }
+            // OP
+            {
+                right = stack_pointer[-1];
+                res = SPAM(left, right);
+            }
+            stack_pointer[-2] = res;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+        """
+        self.run_cases_test(input, output)
+
+    def test_fused_guard_must_peek(self):
+        input = """
+        op(GUARD, (left, right -- res)) {
+            res = SPAM(left, right);
+            INPUTS_DEAD();
+        }
+        op(OP, (left, right -- res)) {
+            res = SPAM(left, right);
+            INPUTS_DEAD();
+        }
+        fused(OP_GUARDED) = GUARD + OP;
+        """
+        with self.assertRaisesRegex(SyntaxError, "must only peek"):
+            self.run_cases_test(input, "")
+
+    def test_fused_one_exit(self):
+        input = """
+        op(GUARD, (value -- value)) {
+            EXIT_IF(PyStackRef_IsNull(value));
+        }
+        op(OP, (value -- res)) {
+            DEOPT_IF(PyStackRef_IsNull(value));
+            res = SPAM(value);
+            INPUTS_DEAD();
+        }
+        fused(OP_GUARDED) = GUARD + OP;
+        """
+        with self.assertRaisesRegex(SyntaxError, "Only one part"):
+            self.run_cases_test(input, "")
+
+
 if __name__ == "__main__":
     unittest.main()
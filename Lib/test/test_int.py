@@ -1,7 +1,6 @@
 import sys
 
 import unittest
-from unittest import mock
 from test import support
 from test.test_grammar import (VALID_UNDERSCORE_LITERALS,
                                INVALID_UNDERSCORE_LITERALS)
@@ -736,8 +735,8 @@ class IntSubclassStrDigitLimitsTests(IntStrDigitLimitsTests):
 
 
 class PyLongModuleTests(unittest.TestCase):
-    # Tests of the functions in _pylong.py.  Those get used when the
-    # number of digits in the input values are large enough.
+    # Tests of the conversions and divisions of ints with many digits, and
+    # of the functions in _pylong.py, which implement them in Python.
 
     def setUp(self):
         super().setUp()
@@ -794,36 +793,26 @@ def test_pylong_str_to_int(self):
 
     @support.cpython_only  # tests implementation details of CPython.
     @unittest.skipUnless(_pylong, "_pylong module required")
-    @mock.patch.object(_pylong, "int_to_decimal_string")
-    def test_pylong_misbehavior_error_path_to_str(
-            self, mock_int_to_str):
-        with support.adjust_int_max_str_digits(20_000):
-            big_value = int('7'*19_999)
-            mock_int_to_str.return_value = None  # not a str
-            with self.assertRaises(TypeError) as ctx:
-                str(big_value)
-            self.assertIn('_pylong.int_to_decimal_string did not',
-                          str(ctx.exception))
-            mock_int_to_str.side_effect = RuntimeError("testABC")
-            with self.assertRaises(RuntimeError):
-                str(big_value)
-
-    @support.cpython_only  # tests implementation details of CPython.
-    @unittest.skipUnless(_pylong, "_pylong module required")
-    @mock.patch.object(_pylong, "int_from_string")
-    def test_pylong_misbehavior_error_path_from_str(
-            self, mock_int_from_str):
-        big_value = '7'*19_999
-        with support.adjust_int_max_str_digits(20_000):
-            mock_int_from_str.return_value = b'not an int'
-            with self.assertRaises(TypeError) as ctx:
-                int(big_value)
-            self.assertIn('_pylong.int_from_string did not',
-                          str(ctx.exception))
-
-            mock_int_from_str.side_effect = RuntimeError("test123")
-            with self.assertRaises(RuntimeError):
-                int(big_value)
+    def test_pylong_decimal_conversions(self):
+        # str() and int() convert big decimals natively, by divide and
+        # conquer above some thresholds; check them against _pylong around
+        # those thresholds, and with long runs of 0 and 9 digits.
+        from random import getrandbits
+        for bits in (17_000, 18_000, 18_030, 19_000, 30_000, 36_000, 120_000):
+            for n in (getrandbits(bits) | 1 << (bits - 1),
+                      1 << bits, (1 << bits) - 1, 10**(bits // 4) - 1):
+                with self.subTest(bits=bits, n=n % 1000):
+                    s = _pylong.int_to_decimal_string(n)
+                    self.assertEqual(str(n), s)
+                    self.assertEqual(str(-n), '-' + s)
+        for digits in (4_999, 5_000, 5_001, 9_001, 18_000, 40_000):
+            for s in ('9' * digits, '1' + '0' * (digits - 1),
+                      str(getrandbits(digits * 3))[:digits].rjust(digits, '0'),
+                      '00000' + '7' * digits):
+                with self.subTest(digits=digits, s=s[:10]):
+                    self.assertEqual(int(s), _pylong.int_from_string(s))
+            s = '1_234' * (digits // 4)
+            self.assertEqual(int(s), int(s.replace('_', '')))
 
     def test_pylong_roundtrip(self):
         from random import randrange, getrandbits
@@ -12,6 +12,8 @@
 BASE = 2 ** SHIFT
 MASK = BASE - 1
 KARATSUBA_CUTOFF = 70   # from longobject.c
+NTT_CUTOFF = 1200       # from longobject.c
+BZ_DIV_CUTOFF = 80      # from longobject.c
 
 # Max number of base BASE digits to use in test cases.  Doubling
 # this will more than double the runtime.
@@ -229,6 +231,87 @@ def test_karatsuba(self):
                          1)
                     self.assertEqual(x, y)
 
+    def test_ntt(self):
+        # Products of more than NTT_CUTOFF digits use a number-theoretic
+        # transform; check them against products of pieces small enough to
+        # be done by Karatsuba.
+        def slow_mul(a, b):
+            piece = (NTT_CUTOFF // 2) * SHIFT
+            mask = (1 << piece) - 1
+            bs = []
+            while b:
+                bs.append(b & mask)
+                b >>= piece
+            result = 0
+            i = 0
+            while a:
+                ai = a & mask
+                for j, bj in enumerate(bs):
+                    result += (ai * bj) << ((i + j) * piece)
+                a >>= piece
+                i += 1
+            return result
+
+        digits = [NTT_CUTOFF - 1, NTT_CUTOFF, NTT_CUTOFF + 1,
+                  NTT_CUTOFF * 2 + 7, NTT_CUTOFF * 5]
+        for adigits in digits:
+            for bdigits in digits + [NTT_CUTOFF * 20]:
+                if bdigits < adigits:
+                    continue
+                abits, bbits = adigits * SHIFT, bdigits * SHIFT
+                with self.subTest(abits=abits, bbits=bbits):
+                    a = random.getrandbits(abits)
+                    b = random.getrandbits(bbits)
+                    self.assertEqual(a * b, slow_mul(a, b))
+                    self.assertEqual(a * a, slow_mul(a, a))
+                    # All digits at their maximum give the biggest
+                    # convolution terms.
+                    a = (1 << abits) - 1
+                    b = (1 << bbits) - 1
+                    self.assertEqual(a * b, (1 << (abits + bbits)) -
+                                            (1 << abits) - (1 << bbits) + 1)
+                    self.assertEqual(-a * a, -slow_mul(a, a))
+
+    def test_bz_division(self):
+        # Divisions with both a divisor and a quotient of BZ_DIV_CUTOFF
+        # digits or more are recursive; check them against long divisions
+        # by blocks of fewer quotient digits, which use the school method.
+        def school_divmod(a, b):
+            block = (BZ_DIV_CUTOFF - 1) * SHIFT
+            blocks = []
+            while a:
+                blocks.append(a & ((1 << block) - 1))
+                a >>= block
+            q = r = 0
+            for x in reversed(blocks):
+                qx, r = divmod(r << block | x, b)
+                q = q << block | qx
+            return q, r
+
+        digits = [BZ_DIV_CUTOFF - 1, BZ_DIV_CUTOFF, BZ_DIV_CUTOFF + 1,
+                  BZ_DIV_CUTOFF * 3 + 1, BZ_DIV_CUTOFF * 10]
+        for bdigits in digits:
+            bbits = bdigits * SHIFT
+            for qdigits in digits + [bdigits * 2, bdigits * 3 + 5]:
+                abits = (bdigits + qdigits) * SHIFT
+                with self.subTest(bdigits=bdigits, qdigits=qdigits):
+                    b = random.getrandbits(bbits) | 1 << (bbits - 1)
+                    for a in (random.getrandbits(abits),
+                              (1 << abits) - 1,
+                              (b << (abits - bbits)) - 1,
+                              b * ((1 << (abits - bbits)) - 1)):
+                        q, r = school_divmod(a, b)
+                        self.assertEqual(divmod(a, b), (q, r))
+                        self.assertEqual(a % b, r)
+                        self.assertEqual(divmod(-a, b),
+                                         (-q - 1, b - r) if r else (-q, 0))
+                        self.assertEqual(divmod(a, -b),
+                                         (-q - 1, r - b) if r else (-q, 0))
+                    # Divisors with few bits in their top digit.
+                    b >>= SHIFT - 1
+                    a = random.getrandbits(abits)
+                    self.assertEqual(divmod(a, b), school_divmod(a, b))
+
     def check_bitop_identities_1(self, x):
         eq = self.assertEqual
         with self.subTest(x=x):
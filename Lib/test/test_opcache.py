@@ -546,7 +546,7 @@ def count_args(self, *args):
 
 
 @threading_helper.requires_working_threading()
-@requires_specialization
+@requires_specialization_ft
 class TestRacesDoNotCrash(TestBase):
     # Careful with these. Bigger numbers have a higher chance of catching bugs,
     # but you can also burn through a *ton* of type/dict/function versions:
@@ -588,6 +588,7 @@ def assert_races_do_not_crash(
             for writer in writers:
                 writer.join()
 
+    @requires_specialization
     def test_binary_subscr_getitem(self):
         def get_items():
             class C:
@@ -640,6 +641,7 @@ def write(items):
         opname = "BINARY_SUBSCR_LIST_INT"
         self.assert_races_do_not_crash(opname, get_items, read, write)
 
+    @requires_specialization
     def test_for_iter_gen(self):
         def get_items():
             def g():
@@ -671,6 +673,7 @@ def write(items):
         opname = "FOR_ITER_GEN"
         self.assert_races_do_not_crash(opname, get_items, read, write)
 
+    @requires_specialization
     def test_for_iter_list(self):
         def get_items():
             items = []
@@ -692,6 +695,7 @@ def write(items):
         opname = "FOR_ITER_LIST"
         self.assert_races_do_not_crash(opname, get_items, read, write)
 
+    @requires_specialization
     def test_load_attr_class(self):
         def get_items():
             class C:
@@ -721,6 +725,7 @@ def write(items):
         opname = "LOAD_ATTR_CLASS"
         self.assert_races_do_not_crash(opname, get_items, read, write)
 
+    @requires_specialization
     def test_load_attr_getattribute_overridden(self):
         def get_items():
             class C:
@@ -750,6 +755,7 @@ def write(items):
         opname = "LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN"
         self.assert_races_do_not_crash(opname, get_items, read, write)
 
+    @requires_specialization
     def test_load_attr_instance_value(self):
         def get_items():
             class C:
@@ -773,6 +779,7 @@ def write(items):
         opname = "LOAD_ATTR_INSTANCE_VALUE"
         self.assert_races_do_not_crash(opname, get_items, read, write)
 
+    @requires_specialization
     def test_load_attr_method_lazy_dict(self):
         def get_items():
             class C(Exception):
@@ -802,6 +809,7 @@ def write(items):
         opname = "LOAD_ATTR_METHOD_LAZY_DICT"
         self.assert_races_do_not_crash(opname, get_items, read, write)
 
+    @requires_specialization
     def test_load_attr_method_no_dict(self):
         def get_items():
             class C:
@@ -832,6 +840,7 @@ def write(items):
         opname = "LOAD_ATTR_METHOD_NO_DICT"
         self.assert_races_do_not_crash(opname, get_items, read, write)
 
+    @requires_specialization
     def test_load_attr_method_with_values(self):
         def get_items():
             class C:
@@ -861,6 +870,7 @@ def write(items):
         opname = "LOAD_ATTR_METHOD_WITH_VALUES"
         self.assert_races_do_not_crash(opname, get_items, read, write)
 
+    @requires_specialization
     def test_load_attr_module(self):
         def get_items():
             items = []
@@ -885,6 +895,7 @@ def write(items):
         opname = "LOAD_ATTR_MODULE"
         self.assert_races_do_not_crash(opname, get_items, read, write)
 
+    @requires_specialization
     def test_load_attr_property(self):
         def get_items():
             class C:
@@ -914,6 +925,7 @@ def write(items):
         opname = "LOAD_ATTR_PROPERTY"
         self.assert_races_do_not_crash(opname, get_items, read, write)
 
+    @requires_specialization
     def test_load_attr_with_hint(self):
         def get_items():
             class C:
@@ -940,6 +952,7 @@ def write(items):
         opname = "LOAD_ATTR_WITH_HINT"
         self.assert_races_do_not_crash(opname, get_items, read, write)
 
+    @requires_specialization
     def test_load_global_module(self):
         def get_items():
             items = []
@@ -961,6 +974,7 @@ def write(items):
             opname, get_items, read, write, check_items=True
         )
 
+    @requires_specialization
     def test_store_attr_instance_value(self):
         def get_items():
             class C:
@@ -983,6 +997,7 @@ def write(items):
         opname = "STORE_ATTR_INSTANCE_VALUE"
         self.assert_races_do_not_crash(opname, get_items, read, write)
 
+    @requires_specialization
     def test_store_attr_with_hint(self):
         def get_items():
             class C:
@@ -1255,6 +1270,211 @@ def g():
         self.assert_specialized(g, "CONTAINS_OP_SET")
         self.assert_no_opcode(g, "CONTAINS_OP")
 
+    @cpython_only
+    @requires_specialization_ft
+    def test_compare_op(self):
+        def f():
+            for _ in range(100):
+                a, b = 1, 2
+                c = a < b
+                self.assertTrue(c)
+
+        f()
+        self.assert_specialized(f, "COMPARE_OP_INT")
+        self.assert_no_opcode(f, "COMPARE_OP")
+
+        def g():
+            for _ in range(100):
+                a, b = "foo", "bar"
+                c = a == b
+                self.assertFalse(c)
+
+        g()
+        self.assert_specialized(g, "COMPARE_OP_STR")
+        self.assert_no_opcode(g, "COMPARE_OP")
+
+    @cpython_only
+    @requires_specialization_ft
+    def test_to_bool(self):
+        def f():
+            for _ in range(100):
+                x = []
+                if x:
+                    self.fail()
+
+        f()
+        self.assert_specialized(f, "TO_BOOL_LIST")
+        self.assert_no_opcode(f, "TO_BOOL")
+
+        class C:
+            pass
+
+        def g():
+            for _ in range(100):
+                x = C()
+                if not x:
+                    self.fail()
+
+        g()
+        self.assert_specialized(g, "TO_BOOL_ALWAYS_TRUE")
+        self.assert_no_opcode(g, "TO_BOOL")
+
+    @cpython_only
+    @requires_specialization_ft
+    def test_unpack_sequence(self):
+        def f():
+            t = 1, 2
+            for _ in range(100):
+                a, b = t
+                self.assertEqual(a, 1)
+                self.assertEqual(b, 2)
+
+        f()
+        self.assert_specialized(f, "UNPACK_SEQUENCE_TWO_TUPLE")
+        self.assert_no_opcode(f, "UNPACK_SEQUENCE")
+
+        def g():
+            l = [1, 2]
+            for _ in range(100):
+                a, b = l
+                self.assertEqual(a, 1)
+                self.assertEqual(b, 2)
+
+        g()
+        self.assert_specialized(g, "UNPACK_SEQUENCE_LIST")
+        self.assert_no_opcode(g, "UNPACK_SEQUENCE")
+
+    @cpython_only
+    @requires_specialization_ft
+    def test_for_iter(self):
+        def f():
+            total = 0
+            for _ in range(100):
+                for i in range(3):
+                    total += i
+            self.assertEqual(total, 300)
+
+        f()
+        self.assert_specialized(f, "FOR_ITER_RANGE")
+
+        def g():
+            total = 0
+            for _ in range(100):
+                for i in (1, 2):
+                    total += i
+            self.assertEqual(total, 300)
+
+        g()
+        self.assert_specialized(g, "FOR_ITER_TUPLE")
+
+    @cpython_only
+    @requires_specialization_ft
+    def test_store_subscr(self):
+        def f():
+            for _ in range(100):
+                x = [1, 2]
+                x[0] = 3
+                self.assertEqual(x, [3, 2])
+
+        f()
+        self.assert_specialized(f, "STORE_SUBSCR_LIST_INT")
+        self.assert_no_opcode(f, "STORE_SUBSCR")
+
+        def g():
+            for _ in range(100):
+                x = {}
+                x["a"] = 1
+                self.assertEqual(x, {"a": 1})
+
+        g()
+        self.assert_specialized(g, "STORE_SUBSCR_DICT")
+        self.assert_no_opcode(g, "STORE_SUBSCR")
+
+    @cpython_only
+    @requires_specialization_ft
+    def test_binary_subscr(self):
+        def f():
+            l = [1, 2, 3]
+            for _ in range(100):
+                self.assertEqual(l[1], 2)
+
+        f()
+        self.assert_specialized(f, "BINARY_SUBSCR_LIST_INT")
+        self.assert_no_opcode(f, "BINARY_SUBSCR")
+
+        def g():
+            d = {"a": 1}
+            for _ in range(100):
+                self.assertEqual(d["a"], 1)
+
+        g()
+        self.assert_specialized(g, "BINARY_SUBSCR_DICT")
+        self.assert_no_opcode(g, "BINARY_SUBSCR")
+
+    @cpython_only
+    @requires_specialization_ft
+    def test_call(self):
+        def add(a, b):
+            return a + b
+
+        def f():
+            for _ in range(100):
+                self.assertEqual(add(1, 2), 3)
+
+        f()
+        self.assert_specialized(f, "CALL_PY_EXACT_ARGS")
+
+        def g():
+            t = (1, 2)
+            for _ in range(100):
+                self.assertEqual(len(t), 2)
+
+        g()
+        self.assert_specialized(g, "CALL_LEN")
+
+        def h():
+            x = []
+            for i in range(100):
+                x.append(i)
+            self.assertEqual(len(x), 100)
+
+        h()
+        self.assert_specialized(h, "CALL_LIST_APPEND")
+
+    @cpython_only
+    @requires_specialization_ft
+    def test_call_kw(self):
+        def add(a, b):
+            return a + b
+
+        def f():
+            for _ in range(100):
+                self.assertEqual(add(1, b=2), 3)
+
+        f()
+        self.assert_specialized(f, "CALL_KW_PY")
+        self.assert_no_opcode(f, "CALL_KW")
+
+    @cpython_only
+    @requires_specialization_ft
+    def test_load_super_attr(self):
+        class A:
+            def m(self):
+                return 1
+
+        class B(A):
+            def m(self):
+                return super().m()
+
+        def f():
+            b = B()
+            for _ in range(100):
+                self.assertEqual(b.m(), 1)
+
+        f()
+        self.assert_specialized(B.m, "LOAD_SUPER_ATTR_METHOD")
+        self.assert_no_opcode(B.m, "LOAD_SUPER_ATTR")
+
 
 
 if __name__ == "__main__":
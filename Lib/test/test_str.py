@@ -311,6 +311,15 @@ def test_find(self):
         self.checkequal(-1, 'a' * 100, 'find', 'a\U00100304')
         self.checkequal(-1, '\u0102' * 100, 'find', '\u0102\U00100304')
 
+    def test_find_short_needles(self):
+        string_tests.StringLikeTest.test_find_short_needles(self)
+        # test the UCS2 and UCS4 kinds, including characters which only
+        # differ from the needle in their high bytes
+        self.check_find_short_needles('\u0100\u0101')
+        self.check_find_short_needles('a\u0161')
+        self.check_find_short_needles('\U00010100\U00010101')
+        self.check_find_short_needles('\u0101\U00010101')
+
     def test_rfind(self):
         string_tests.StringLikeTest.test_rfind(self)
         # test implementation details of the memrchr fast path
@@ -22,6 +22,8 @@
 except ImportError:
     interpreters = None
 import textwrap
+import time
+import types
 import unittest
 import warnings
 
@@ -1112,6 +1114,137 @@ def test_getallocatedblocks(self):
         c = sys.getallocatedblocks()
         self.assertIn(c, range(b - 50, b + 50))
 
+    def test_allocation_region(self):
+        with_pymalloc = support.with_pymalloc()
+        if with_pymalloc:
+            with self.assertRaises(RuntimeError):
+                sys._exit_allocation_region()
+        try:
+            import _testinternalcapi
+            alloc_name = _testinternalcapi.pymem_getallocatorsname()
+        except (ImportError, RuntimeError):
+            alloc_name = None
+
+        class C:
+            pass
+
+        sys._enter_allocation_region()
+        try:
+            kept = [C() for i in range(1000)]
+            for i in range(10000):
+                temp = C()
+            del temp
+            sys._enter_allocation_region()
+            self.assertEqual(sys._exit_allocation_region(), 0)
+        finally:
+            escaped = sys._exit_allocation_region()
+        if alloc_name in ('pymalloc', 'pymalloc_debug'):
+            # The instances in kept escaped the region.
+            self.assertGreaterEqual(escaped, 1000)
+            self.assertLess(escaped, 3000)
+        else:
+            self.assertGreaterEqual(escaped, 0)
+        self.assertIsInstance(kept[999], C)
+        del kept
+        if with_pymalloc:
+            with self.assertRaises(RuntimeError):
+                sys._exit_allocation_region()
+
+    def test_purge_memory(self):
+        try:
+            import _testinternalcapi
+            alloc_name = _testinternalcapi.pymem_getallocatorsname()
+        except (ImportError, RuntimeError):
+            alloc_name = None
+
+        class C:
+            pass
+
+        # Keep one instance in 2000 alive: most pools are freed, but their
+        # arenas are not.
+        objs = [C() for i in range(200_000)]
+        kept = objs[::2000]
+        del objs
+        stats = sys._get_memory_purger_stats()
+        released = sys._purge_memory()
+        if alloc_name in ('pymalloc', 'pymalloc_debug'):
+            self.assertGreater(released, 0)
+        else:
+            self.assertGreaterEqual(released, 0)
+        new_stats = sys._get_memory_purger_stats()
+        self.assertEqual(new_stats['purges'], stats['purges'] + 1)
+        self.assertEqual(new_stats['bytes_released'],
+                         stats['bytes_released'] + released)
+        # The purged pools can be reused.
+        objs = [C() for i in range(200_000)]
+        self.assertIsInstance(kept[-1], C)
+        del objs, kept
+
+    @threading_helper.requires_working_threading()
+    def test_memory_purger(self):
+        with self.assertRaises(ValueError):
+            sys._start_memory_purger(0.0)
+        self.assertFalse(sys._get_memory_purger_stats()['running'])
+        self.assertIsNone(sys._get_memory_purger_stats()['interval'])
+        sys._start_memory_purger(0.001)
+        try:
+            with self.assertRaises(RuntimeError):
+                sys._start_memory_purger(0.001)
+            stats = sys._get_memory_purger_stats()
+            self.assertTrue(stats['running'])
+            self.assertAlmostEqual(stats['interval'], 0.001)
+            for _ in support.sleeping_retry(support.SHORT_TIMEOUT):
+                objs = [[i] for i in range(1000)]
+                del objs
+                if sys._get_memory_purger_stats()['purges'] > stats['purges']:
+                    break
+        finally:
+            sys._stop_memory_purger()
+        self.assertFalse(sys._get_memory_purger_stats()['running'])
+        # Stopping again has no effect.
+        sys._stop_memory_purger()
+
+    def test_freelists(self):
+        stats = sys._get_freelist_stats()
+        for name in ('floats', 'tuples', 'lists', 'dicts', 'ints', 'methods',
+                     'frames', 'cells', 'bytes'):
+            self.assertIn(name, stats)
+        for name, item in stats.items():
+            self.assertEqual(sorted(item),
+                             ['hits', 'limit', 'misses', 'overflows', 'size'])
+            self.assertGreaterEqual(item['limit'], 0, name)
+
+        self.assertRaises(ValueError, sys._set_freelist_limit, 'spam', 1)
+        self.assertRaises(ValueError, sys._set_freelist_limit, 'cells', -1)
+
+        def make_cells(n):
+            cells = [types.CellType(i) for i in range(n)]
+            del cells
+
+        limit = stats['cells']['limit']
+        self.addCleanup(sys._set_freelist_limit, 'cells', limit)
+        sys._set_freelist_limit('cells', 10)
+        make_cells(100)
+        stats = sys._get_freelist_stats()['cells']
+        self.assertEqual(stats['limit'], 10)
+        # Other threads can hold up to 10 cells each in the free-threaded
+        # build.
+        self.assertGreaterEqual(stats['size'], 10)
+        make_cells(5)
+        new_stats = sys._get_freelist_stats()['cells']
+        self.assertGreaterEqual(new_stats['hits'], stats['hits'] + 5)
+
+        # A limit of 0 disables the freelist.
+        sys._set_freelist_limit('cells', 0)
+        stats = sys._get_freelist_stats()['cells']
+        self.assertEqual(stats['size'], 0)
+        make_cells(5)
+        new_stats = sys._get_freelist_stats()['cells']
+        self.assertEqual(new_stats['hits'], stats['hits'])
+        self.assertGreaterEqual(new_stats['misses'], stats['misses'] + 5)
+        self.assertGreaterEqual(new_stats['overflows'],
+                                stats['overflows'] + 5)
+
     def test_is_gil_enabled(self):
         if support.Py_GIL_DISABLED:
             self.assertIs(type(sys._is_gil_enabled()), bool)
@@ -1297,6 +1430,71 @@ def test_disable_gil_abi(self):
         self.assertEqual('t' in sys.abiflags, support.Py_GIL_DISABLED)
 
 
+@test.support.cpython_only
+class SamplingProfilerTest(unittest.TestCase):
+    def setUp(self):
+        sys._stop_sampling_profiler()
+        sys._dump_sampling_profile()
+        self.addCleanup(sys._stop_sampling_profiler)
+
+    @staticmethod
+    def spin(duration):
+        def sampled_leaf():
+            for _ in range(100):
+                pass
+        end = time.perf_counter() + duration
+        while time.perf_counter() < end:
+            sampled_leaf()
+
+    def test_invalid_interval(self):
+        for interval in (0, -1.0, float('nan')):
+            with self.assertRaises(ValueError):
+                sys._start_sampling_profiler(interval)
+
+    def test_start_twice(self):
+        sys._start_sampling_profiler()
+        with self.assertRaises(RuntimeError):
+            sys._start_sampling_profiler()
+        sys._stop_sampling_profiler()
+        # Stopping twice is harmless.
+        sys._stop_sampling_profiler()
+
+    def test_folded_stacks(self):
+        sys._start_sampling_profiler(0.001)
+        self.spin(0.2)
+        sys._stop_sampling_profiler()
+
+        profile = sys._dump_sampling_profile(clear=False)
+        self.assertIsInstance(profile, dict)
+        self.assertTrue(profile)
+        for stack, count in profile.items():
+            self.assertIsInstance(stack, str)
+            self.assertIsInstance(count, int)
+            self.assertGreater(count, 0)
+        leaf = [stack for stack in profile
+                if stack.split(';')[-1].startswith(
+                    'SamplingProfilerTest.spin.<locals>.sampled_leaf '
+                    f'({__file__}:')]
+        self.assertTrue(leaf)
+        self.assertIn(';SamplingProfilerTest.spin (', leaf[0])
+
+        self.assertEqual(sys._dump_sampling_profile(), profile)
+        self.assertEqual(sys._dump_sampling_profile(), {})
+
+    @threading_helper.reap_threads
+    @threading_helper.requires_working_threading()
+    def test_threads(self):
+        import threading
+        sys._start_sampling_profiler(0.001)
+        t = threading.Thread(target=self.spin, args=(0.2,))
+        t.start()
+        t.join()
+        sys._stop_sampling_profiler()
+        profile = sys._dump_sampling_profile()
+        self.assertTrue(any(stack.startswith('Thread._bootstrap ')
+                            for stack in profile))
+
+
 @test.support.cpython_only
 class UnraisableHookTest(unittest.TestCase):
     def test_original_unraisablehook(self):
@@ -397,6 +397,100 @@ _opcode_get_executor_impl(PyObject *module, PyObject *code, int offset)
 #endif
 }
 
+/*[clinic input]
+
+_opcode.prime_executor
+
+  code: object
+  offset: int
+
+Make the backward jump at offset in code start optimizing when next executed.
+
+Return True if the jump was primed, or False if it already has an executor.
+[clinic start generated code]*/
+
+static PyObject *
+_opcode_prime_executor_impl(PyObject *module, PyObject *code, int offset)
+/*[clinic end generated code: output=a233df06f00cfc61 input=997e0561fc9d4030]*/
+{
+    if (!PyCode_Check(code)) {
+        PyErr_Format(PyExc_TypeError,
+                     "expected a code object, not '%.100s'",
+                     Py_TYPE(code)->tp_name);
+        return NULL;
+    }
+#ifdef _Py_TIER2
+    int res = _Py_PrimeExecutor((PyCodeObject *)code, offset);
+    if (res < 0) {
+        return NULL;
+    }
+    return PyBool_FromLong(res);
+#else
+    PyErr_Format(PyExc_RuntimeError,
+                 "Executors are not available in this build");
+    return NULL;
+#endif
+}
+
+/*[clinic input]
+
+_opcode.get_specialization_profile
+
+  code: object
+
+Return the specialization state of each adaptive instruction in code.
+
+The result is a list of (offset, opcode, backoff) tuples.  offset is a byte
+offset and opcode is the instruction currently executed at that offset,
+which may be a specialization.  backoff is how far specialization of a
+generic instruction has backed off.
+[clinic start generated code]*/
+
+static PyObject *
+_opcode_get_specialization_profile_impl(PyObject *module, PyObject *code)
+/*[clinic end generated code: output=d0aa2bdba3841ff0 input=a9e7a6a3a2cea956]*/
+{
+    if (!PyCode_Check(code)) {
+        PyErr_Format(PyExc_TypeError,
+                     "expected a code object, not '%.100s'",
+                     Py_TYPE(code)->tp_name);
+        return NULL;
+    }
+    return _PyCode_GetSpecializationProfile((PyCodeObject *)code);
+}
+
+/*[clinic input]
+
+_opcode.apply_specialization_profile -> Py_ssize_t
+
+  code: object
+  profile: object
+
+Prime code with a profile from get_specialization_profile().
+
+Instructions that were specialized when the profile was recorded will
+specialize the first time they run.  Instructions that failed to specialize
+resume with the recorded backoff.  Entries that do not match the bytecode
+are ignored, and so is the whole profile if code is instrumented or has
+executors.
+
+Return the number of entries applied.
+[clinic start generated code]*/
+
+static Py_ssize_t
+_opcode_apply_specialization_profile_impl(PyObject *module, PyObject *code,
+                                          PyObject *profile)
+/*[clinic end generated code: output=fadc6e944dfa097a input=b5ec83669a680570]*/
+{
+    if (!PyCode_Check(code)) {
+        PyErr_Format(PyExc_TypeError,
+                     "expected a code object, not '%.100s'",
+                     Py_TYPE(code)->tp_name);
+        return -1;
+    }
+    return _PyCode_ApplySpecializationProfile((PyCodeObject *)code, profile);
+}
+
 static PyMethodDef
 opcode_functions[] =  {
     _OPCODE_STACK_EFFECT_METHODDEF
@@ -413,6 +507,9 @@ opcode_functions[] =  {
     _OPCODE_GET_INTRINSIC1_DESCS_METHODDEF
     _OPCODE_GET_INTRINSIC2_DESCS_METHODDEF
     _OPCODE_GET_EXECUTOR_METHODDEF
+    _OPCODE_PRIME_EXECUTOR_METHODDEF
+    _OPCODE_GET_SPECIALIZATION_PROFILE_METHODDEF
+    _OPCODE_APPLY_SPECIALIZATION_PROFILE_METHODDEF
     _OPCODE_GET_SPECIAL_METHOD_NAMES_METHODDEF
     {NULL, NULL, 0, NULL}
 };
@@ -1052,6 +1052,27 @@ invalidate_executors(PyObject *self, PyObject *obj)
     Py_RETURN_NONE;
 }
 
+#ifdef _Py_JIT
+
+static PyObject *
+get_jit_arena_stats(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    struct _jit_arena *arena = &_PyInterpreterState_GET()->jit_arena;
+    PyMutex_Lock(&arena->mutex);
+    size_t chunk_count = arena->chunk_count;
+    size_t mapped_size = arena->mapped_size;
+    size_t used_size = arena->used_size;
+    size_t code_size = arena->code_size;
+    PyMutex_Unlock(&arena->mutex);
+    return Py_BuildValue("{snsnsnsn}",
+                         "chunks", (Py_ssize_t)chunk_count,
+                         "mapped", (Py_ssize_t)mapped_size,
+                         "used", (Py_ssize_t)used_size,
+                         "code", (Py_ssize_t)code_size);
+}
+
+#endif
+
 #endif
 
 static int _pending_callback(void *arg)
@@ -2116,6 +2137,9 @@ static PyMethodDef module_functions[] = {
     {"new_uop_optimizer", new_uop_optimizer, METH_NOARGS, NULL},
     {"add_executor_dependency", add_executor_dependency, METH_VARARGS, NULL},
     {"invalidate_executors", invalidate_executors, METH_O, NULL},
+#ifdef _Py_JIT
+    {"get_jit_arena_stats", get_jit_arena_stats, METH_NOARGS, NULL},
+#endif
 #endif
     {"pending_threadfunc", _PyCFunction_CAST(pending_threadfunc),
      METH_VARARGS | METH_KEYWORDS},
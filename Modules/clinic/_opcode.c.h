@@ -756,4 +756,200 @@ _opcode_get_executor(PyObject *module, PyObject *const *args, Py_ssize_t nargs,
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=2e0c39286d0253e7 input=a9049054013a1b77]*/
+
+PyDoc_STRVAR(_opcode_prime_executor__doc__,
+"prime_executor($module, /, code, offset)\n"
+"--\n"
+"\n"
+"Make the backward jump at offset in code start optimizing when next executed.\n"
+"\n"
+"Return True if the jump was primed, or False if it already has an executor.");
+
+#define _OPCODE_PRIME_EXECUTOR_METHODDEF    \
+    {"prime_executor", _PyCFunction_CAST(_opcode_prime_executor), METH_FASTCALL|METH_KEYWORDS, _opcode_prime_executor__doc__},
+
+static PyObject *
+_opcode_prime_executor_impl(PyObject *module, PyObject *code, int offset);
+
+static PyObject *
+_opcode_prime_executor(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 2
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(code), &_Py_ID(offset), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"code", "offset", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "prime_executor",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[2];
+    PyObject *code;
+    int offset;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
+            /*minpos*/ 2, /*maxpos*/ 2, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    code = args[0];
+    offset = PyLong_AsInt(args[1]);
+    if (offset == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = _opcode_prime_executor_impl(module, code, offset);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_opcode_get_specialization_profile__doc__,
+"get_specialization_profile($module, /, code)\n"
+"--\n"
+"\n"
+"Return the specialization state of each adaptive instruction in code.\n"
+"\n"
+"The result is a list of (offset, opcode, backoff) tuples.  offset is a byte\n"
+"offset and opcode is the instruction currently executed at that offset,\n"
+"which may be a specialization.  backoff is how far specialization of a\n"
+"generic instruction has backed off.");
+
+#define _OPCODE_GET_SPECIALIZATION_PROFILE_METHODDEF    \
+    {"get_specialization_profile", _PyCFunction_CAST(_opcode_get_specialization_profile), METH_FASTCALL|METH_KEYWORDS, _opcode_get_specialization_profile__doc__},
+
+static PyObject *
+_opcode_get_specialization_profile_impl(PyObject *module, PyObject *code);
+
+static PyObject *
+_opcode_get_specialization_profile(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 1
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(code), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"code", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "get_specialization_profile",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[1];
+    PyObject *code;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
+            /*minpos*/ 1, /*maxpos*/ 1, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    code = args[0];
+    return_value = _opcode_get_specialization_profile_impl(module, code);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_opcode_apply_specialization_profile__doc__,
+"apply_specialization_profile($module, /, code, profile)\n"
+"--\n"
+"\n"
+"Prime code with a profile from get_specialization_profile().\n"
+"\n"
+"Instructions that were specialized when the profile was recorded will\n"
+"specialize the first time they run.  Instructions that failed to specialize\n"
+"resume with the recorded backoff.  Entries that do not match the bytecode\n"
+"are ignored, and so is the whole profile if code is instrumented or has\n"
+"executors.\n"
+"\n"
+"Return the number of entries applied.");
+
+#define _OPCODE_APPLY_SPECIALIZATION_PROFILE_METHODDEF    \
+    {"apply_specialization_profile", _PyCFunction_CAST(_opcode_apply_specialization_profile), METH_FASTCALL|METH_KEYWORDS, _opcode_apply_specialization_profile__doc__},
+
+static Py_ssize_t
+_opcode_apply_specialization_profile_impl(PyObject *module, PyObject *code,
+                                          PyObject *profile);
+
+static PyObject *
+_opcode_apply_specialization_profile(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 2
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(code), &_Py_ID(profile), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"code", "profile", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "apply_specialization_profile",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[2];
+    PyObject *code;
+    PyObject *profile;
+    Py_ssize_t _return_value;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
+            /*minpos*/ 2, /*maxpos*/ 2, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    code = args[0];
+    profile = args[1];
+    _return_value = _opcode_apply_specialization_profile_impl(module, code, profile);
+    if ((_return_value == -1) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyLong_FromSsize_t(_return_value);
+
+exit:
+    return return_value;
+}
+/*[clinic end generated code: output=23b6f46563796040 input=a9049054013a1b77]*/
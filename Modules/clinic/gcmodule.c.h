@@ -286,6 +286,124 @@ gc_get_threshold(PyObject *module, PyObject *Py_UNUSED(ignored))
     return gc_get_threshold_impl(module);
 }
 
+PyDoc_STRVAR(gc_set_increment_budget__doc__,
+"set_increment_budget($module, budget, /)\n"
+"--\n"
+"\n"
+"Set the target duration of incremental collections in seconds.\n"
+"\n"
+"Setting \'budget\' to zero sizes increments by the amount of pending\n"
+"work alone.");
+
+#define GC_SET_INCREMENT_BUDGET_METHODDEF    \
+    {"set_increment_budget", (PyCFunction)gc_set_increment_budget, METH_O, gc_set_increment_budget__doc__},
+
+static PyObject *
+gc_set_increment_budget_impl(PyObject *module, double budget);
+
+static PyObject *
+gc_set_increment_budget(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    double budget;
+
+    if (PyFloat_CheckExact(arg)) {
+        budget = PyFloat_AS_DOUBLE(arg);
+    }
+    else
+    {
+        budget = PyFloat_AsDouble(arg);
+        if (budget == -1.0 && PyErr_Occurred()) {
+            goto exit;
+        }
+    }
+    return_value = gc_set_increment_budget_impl(module, budget);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(gc_get_increment_budget__doc__,
+"get_increment_budget($module, /)\n"
+"--\n"
+"\n"
+"Return the target duration of incremental collections in seconds.");
+
+#define GC_GET_INCREMENT_BUDGET_METHODDEF    \
+    {"get_increment_budget", (PyCFunction)gc_get_increment_budget, METH_NOARGS, gc_get_increment_budget__doc__},
+
+static PyObject *
+gc_get_increment_budget_impl(PyObject *module);
+
+static PyObject *
+gc_get_increment_budget(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return gc_get_increment_budget_impl(module);
+}
+
+PyDoc_STRVAR(gc_set_parallel__doc__,
+"set_parallel(threads, [threshold])\n"
+"Set the number of threads used by large collections.\n"
+"\n"
+"Setting \'threads\' to zero uses one thread per CPU available to the\n"
+"process.  Collections are parallel once the previous collection found\n"
+"at least \'threshold\' live objects.");
+
+#define GC_SET_PARALLEL_METHODDEF    \
+    {"set_parallel", (PyCFunction)gc_set_parallel, METH_VARARGS, gc_set_parallel__doc__},
+
+static PyObject *
+gc_set_parallel_impl(PyObject *module, int threads, int group_right_1,
+                     Py_ssize_t threshold);
+
+static PyObject *
+gc_set_parallel(PyObject *module, PyObject *args)
+{
+    PyObject *return_value = NULL;
+    int threads;
+    int group_right_1 = 0;
+    Py_ssize_t threshold = 0;
+
+    switch (PyTuple_GET_SIZE(args)) {
+        case 1:
+            if (!PyArg_ParseTuple(args, "i:set_parallel", &threads)) {
+                goto exit;
+            }
+            break;
+        case 2:
+            if (!PyArg_ParseTuple(args, "in:set_parallel", &threads, &threshold)) {
+                goto exit;
+            }
+            group_right_1 = 1;
+            break;
+        default:
+            PyErr_SetString(PyExc_TypeError, "gc.set_parallel requires 1 to 2 arguments");
+            goto exit;
+    }
+    return_value = gc_set_parallel_impl(module, threads, group_right_1, threshold);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(gc_get_parallel__doc__,
+"get_parallel($module, /)\n"
+"--\n"
+"\n"
+"Return the number of threads and the threshold of parallel collections.");
+
+#define GC_GET_PARALLEL_METHODDEF    \
+    {"get_parallel", (PyCFunction)gc_get_parallel, METH_NOARGS, gc_get_parallel__doc__},
+
+static PyObject *
+gc_get_parallel_impl(PyObject *module);
+
+static PyObject *
+gc_get_parallel(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return gc_get_parallel_impl(module);
+}
+
 PyDoc_STRVAR(gc_get_count__doc__,
 "get_count($module, /)\n"
 "--\n"
@@ -580,4 +698,36 @@ gc_get_freeze_count(PyObject *module, PyObject *Py_UNUSED(ignored))
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=3e33248997e06c34 input=a9049054013a1b77]*/
+
+PyDoc_STRVAR(gc_immortalize_heap__doc__,
+"immortalize_heap($module, /)\n"
+"--\n"
+"\n"
+"Make all current tracked objects immortal and stop tracking them.\n"
+"\n"
+"The objects are never deallocated and their reference counts are no longer\n"
+"written, so after a POSIX fork() call the pages holding them stay shared\n"
+"between processes.  Returns the number of objects made immortal.");
+
+#define GC_IMMORTALIZE_HEAP_METHODDEF    \
+    {"immortalize_heap", (PyCFunction)gc_immortalize_heap, METH_NOARGS, gc_immortalize_heap__doc__},
+
+static Py_ssize_t
+gc_immortalize_heap_impl(PyObject *module);
+
+static PyObject *
+gc_immortalize_heap(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+    Py_ssize_t _return_value;
+
+    _return_value = gc_immortalize_heap_impl(module);
+    if ((_return_value == -1) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyLong_FromSsize_t(_return_value);
+
+exit:
+    return return_value;
+}
+/*[clinic end generated code: output=74cbbc069b1ea6a2 input=a9049054013a1b77]*/
@@ -8,6 +8,7 @@
 #include "pycore_gc.h"
 #include "pycore_object.h"      // _PyObject_IS_GC()
 #include "pycore_pystate.h"     // _PyInterpreterState_GET()
+#include "pycore_time.h"        // _PyTime_FromSecondsDouble()
 #include "pycore_tuple.h"       // _PyTuple_FromArray()
 
 typedef struct _gc_runtime_state GCState;
@@ -186,6 +187,104 @@ gc_get_threshold_impl(PyObject *module)
                          0);
 }
 
+/*[clinic input]
+gc.set_increment_budget
+
+    budget: double
+    /
+
+Set the target duration of incremental collections in seconds.
+
+Setting 'budget' to zero sizes increments by the amount of pending
+work alone.
+[clinic start generated code]*/
+
+static PyObject *
+gc_set_increment_budget_impl(PyObject *module, double budget)
+/*[clinic end generated code: output=91c1bdcccfb2741f input=06aa10bdbce5dc14]*/
+{
+    if (!(budget >= 0.0)) {
+        PyErr_SetString(PyExc_ValueError,
+                        "increment budget must be non-negative");
+        return NULL;
+    }
+    PyTime_t ns;
+    if (_PyTime_FromSecondsDouble(budget, _PyTime_ROUND_CEILING, &ns) < 0) {
+        return NULL;
+    }
+    GCState *gcstate = get_gc_state();
+    gcstate->increment_budget = ns;
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+gc.get_increment_budget
+
+Return the target duration of incremental collections in seconds.
+[clinic start generated code]*/
+
+static PyObject *
+gc_get_increment_budget_impl(PyObject *module)
+/*[clinic end generated code: output=ae8fb394a21e4aa2 input=5dbc9edbb475575c]*/
+{
+    GCState *gcstate = get_gc_state();
+    return PyFloat_FromDouble(PyTime_AsSecondsDouble(gcstate->increment_budget));
+}
+
+/*[clinic input]
+gc.set_parallel
+
+    threads: int
+    [
+    threshold: Py_ssize_t
+    ]
+    /
+
+Set the number of threads used by large collections.
+
+Setting 'threads' to zero uses one thread per CPU available to the
+process.  Collections are parallel once the previous collection found
+at least 'threshold' live objects.
+[clinic start generated code]*/
+
+static PyObject *
+gc_set_parallel_impl(PyObject *module, int threads, int group_right_1,
+                     Py_ssize_t threshold)
+/*[clinic end generated code: output=cb2eddd5d08f29c2 input=b82a1373297753ce]*/
+{
+    if (threads < 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "number of threads must be non-negative");
+        return NULL;
+    }
+    if (group_right_1 && threshold < 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "parallel threshold must be non-negative");
+        return NULL;
+    }
+    GCState *gcstate = get_gc_state();
+    gcstate->parallel_threads = threads;
+    if (group_right_1) {
+        gcstate->parallel_threshold = threshold;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+gc.get_parallel
+
+Return the number of threads and the threshold of parallel collections.
+[clinic start generated code]*/
+
+static PyObject *
+gc_get_parallel_impl(PyObject *module)
+/*[clinic end generated code: output=687b447d6b1d5d71 input=c2da3caed8feff08]*/
+{
+    GCState *gcstate = get_gc_state();
+    return Py_BuildValue("(in)", gcstate->parallel_threads,
+                         gcstate->parallel_threshold);
+}
+
 /*[clinic input]
 gc.get_count
 
@@ -331,6 +430,91 @@ gc_get_objects_impl(PyObject *module, Py_ssize_t generation)
     return _PyGC_GetObjects(interp, (int)generation);
 }
 
+/* Return an upper bound of the given percentile of the collection
+   durations in seconds, or zero if there were no collections. */
+static double
+duration_percentile(const struct gc_generation_stats *st, double percentile)
+{
+    Py_ssize_t total = 0;
+    for (int i = 0; i < _PyGC_DURATION_BUCKETS; i++) {
+        total += st->durations[i];
+    }
+    if (total == 0) {
+        return 0.0;
+    }
+    double rank = percentile * (double)total;
+    Py_ssize_t count = 0;
+    for (int i = 0; i < _PyGC_DURATION_BUCKETS; i++) {
+        count += st->durations[i];
+        if ((double)count >= rank) {
+            return _PyGC_DurationBucketLimit(i) / 1e6;
+        }
+    }
+    return _PyGC_DurationBucketLimit(_PyGC_DURATION_BUCKETS - 1) / 1e6;
+}
+
+static const char * const phase_names[_PyGC_PHASES] = {
+    [_PyGC_PHASE_UPDATE_REFS] = "update_refs",
+    [_PyGC_PHASE_SUBTRACT_REFS] = "subtract_refs",
+    [_PyGC_PHASE_MOVE_UNREACHABLE] = "move_unreachable",
+    [_PyGC_PHASE_FINALIZE] = "finalize",
+    [_PyGC_PHASE_DELETE] = "delete",
+};
+
+/* Return a dict mapping phase names to the time spent in them in seconds. */
+static PyObject *
+phase_times_as_dict(const struct gc_generation_stats *st)
+{
+    PyObject *dict = PyDict_New();
+    if (dict == NULL) {
+        return NULL;
+    }
+    for (int i = 0; i < _PyGC_PHASES; i++) {
+        PyObject *seconds = PyFloat_FromDouble(
+            PyTime_AsSecondsDouble(st->phase_times[i]));
+        if (seconds == NULL ||
+            PyDict_SetItemString(dict, phase_names[i], seconds) < 0)
+        {
+            Py_XDECREF(seconds);
+            Py_DECREF(dict);
+            return NULL;
+        }
+        Py_DECREF(seconds);
+    }
+    return dict;
+}
+
+/* Return a dict mapping the upper bound of each non-empty bucket of the
+   durations histogram, in seconds, to its number of collections. */
+static PyObject *
+durations_as_dict(const struct gc_generation_stats *st)
+{
+    PyObject *dict = PyDict_New();
+    if (dict == NULL) {
+        return NULL;
+    }
+    for (int i = 0; i < _PyGC_DURATION_BUCKETS; i++) {
+        if (st->durations[i] == 0) {
+            continue;
+        }
+        PyObject *limit = PyFloat_FromDouble(_PyGC_DurationBucketLimit(i) / 1e6);
+        if (limit == NULL) {
+            Py_DECREF(dict);
+            return NULL;
+        }
+        PyObject *count = PyLong_FromSsize_t(st->durations[i]);
+        if (count == NULL || PyDict_SetItem(dict, limit, count) < 0) {
+            Py_XDECREF(count);
+            Py_DECREF(limit);
+            Py_DECREF(dict);
+            return NULL;
+        }
+        Py_DECREF(count);
+        Py_DECREF(limit);
+    }
+    return dict;
+}
+
 /*[clinic input]
 gc.get_stats
 
@@ -358,10 +542,16 @@ gc_get_stats_impl(PyObject *module)
     for (i = 0; i < NUM_GENERATIONS; i++) {
         PyObject *dict;
         st = &stats[i];
-        dict = Py_BuildValue("{snsnsn}",
+        dict = Py_BuildValue("{snsnsnsnsNsdsdsdsN}",
                              "collections", st->collections,
                              "collected", st->collected,
-                             "uncollectable", st->uncollectable
+                             "uncollectable", st->uncollectable,
+                             "visited", st->visited,
+                             "phase_times", phase_times_as_dict(st),
+                             "duration_p50", duration_percentile(st, 0.50),
+                             "duration_p90", duration_percentile(st, 0.90),
+                             "duration_p99", duration_percentile(st, 0.99),
+                             "durations", durations_as_dict(st)
                             );
         if (dict == NULL)
             goto error;
@@ -463,6 +653,24 @@ gc_get_freeze_count_impl(PyObject *module)
     return _PyGC_GetFreezeCount(interp);
 }
 
+/*[clinic input]
+gc.immortalize_heap -> Py_ssize_t
+
+Make all current tracked objects immortal and stop tracking them.
+
+The objects are never deallocated and their reference counts are no longer
+written, so after a POSIX fork() call the pages holding them stay shared
+between processes.  Returns the number of objects made immortal.
+[clinic start generated code]*/
+
+static Py_ssize_t
+gc_immortalize_heap_impl(PyObject *module)
+/*[clinic end generated code: output=6580f7e04b6e010e input=f6546293daaed634]*/
+{
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    return _PyGC_ImmortalizeHeap(interp);
+}
+
 
 PyDoc_STRVAR(gc__doc__,
 "This module provides access to the garbage collector for reference cycles.\n"
@@ -477,6 +685,10 @@ PyDoc_STRVAR(gc__doc__,
 "get_debug() -- Get debugging flags.\n"
 "set_threshold() -- Set the collection thresholds.\n"
 "get_threshold() -- Return the current the collection thresholds.\n"
+"set_increment_budget() -- Set the target duration of incremental collections.\n"
+"get_increment_budget() -- Return the target duration of incremental collections.\n"
+"set_parallel() -- Set the number of threads used by large collections.\n"
+"get_parallel() -- Return the settings of parallel collections.\n"
 "get_objects() -- Return a list of all objects tracked by the collector.\n"
 "is_tracked() -- Returns true if a given object is tracked.\n"
 "is_finalized() -- Returns true if a given object has been already finalized.\n"
@@ -484,7 +696,8 @@ PyDoc_STRVAR(gc__doc__,
 "get_referents() -- Return the list of objects that an object refers to.\n"
 "freeze() -- Freeze all tracked objects and ignore them for future collections.\n"
 "unfreeze() -- Unfreeze all objects in the permanent generation.\n"
-"get_freeze_count() -- Return the number of objects in the permanent generation.\n");
+"get_freeze_count() -- Return the number of objects in the permanent generation.\n"
+"immortalize_heap() -- Make all tracked objects immortal and stop tracking them.\n");
 
 static PyMethodDef GcMethods[] = {
     GC_ENABLE_METHODDEF
@@ -495,6 +708,10 @@ static PyMethodDef GcMethods[] = {
     GC_GET_COUNT_METHODDEF
     GC_SET_THRESHOLD_METHODDEF
     GC_GET_THRESHOLD_METHODDEF
+    GC_SET_INCREMENT_BUDGET_METHODDEF
+    GC_GET_INCREMENT_BUDGET_METHODDEF
+    GC_SET_PARALLEL_METHODDEF
+    GC_GET_PARALLEL_METHODDEF
     GC_COLLECT_METHODDEF
     GC_GET_OBJECTS_METHODDEF
     GC_GET_STATS_METHODDEF
@@ -505,6 +722,7 @@ static PyMethodDef GcMethods[] = {
     GC_FREEZE_METHODDEF
     GC_UNFREEZE_METHODDEF
     GC_GET_FREEZE_COUNT_METHODDEF
+    GC_IMMORTALIZE_HEAP_METHODDEF
     {NULL,      NULL}           /* Sentinel */
 };
 
@@ -16,11 +16,13 @@
 #include "pycore_call.h"          // _PyObject_CallNoArgs()
 #include "pycore_ceval.h"         // _PyEval_ReInitThreads()
 #include "pycore_fileutils.h"     // _Py_closerange()
+#include "pycore_gc.h"            // _PyGC_BeforeFork()
 #include "pycore_initconfig.h"    // _PyStatus_EXCEPTION()
 #include "pycore_long.h"          // _PyLong_IsNegative()
 #include "pycore_moduleobject.h"  // _PyModule_GetState()
 #include "pycore_object.h"        // _PyObject_LookupSpecial()
 #include "pycore_pylifecycle.h"   // _PyOS_URandom()
+#include "pycore_pymem.h"         // _PyMem_PurgerAfterFork_Child()
 #include "pycore_pystate.h"       // _PyInterpreterState_GET()
 #include "pycore_signal.h"        // Py_NSIG
 #include "pycore_time.h"          // _PyLong_FromTime_t()
@@ -624,6 +626,9 @@ PyOS_BeforeFork(void)
     _PyImport_AcquireLock(interp);
     _PyEval_StopTheWorldAll(&_PyRuntime);
     HEAD_LOCK(&_PyRuntime);
+#ifdef Py_GIL_DISABLED
+    _PyGC_BeforeFork();
+#endif
 }
 
 void
@@ -693,6 +698,8 @@ PyOS_AfterFork_Child(void)
     if (_PyStatus_EXCEPTION(status)) {
         goto fatal_error;
     }
+    _PySamplingProfiler_AfterFork_Child();
+    _PyMem_PurgerAfterFork_Child();
 
     run_at_forkers(tstate->interp->after_forkers_child, 0);
     return;
@@ -7,6 +7,7 @@
 #include "pycore_call.h"          // _PyObject_CallNoArgs()
 #include "pycore_ceval.h"         // _PyEval_GetBuiltin()
 #include "pycore_format.h"        // F_LJUST
+#include "pycore_freelist.h"      // _Py_FREELIST_FREE(), _Py_FREELIST_POP()
 #include "pycore_global_objects.h"// _Py_GET_GLOBAL_OBJECT()
 #include "pycore_initconfig.h"    // _PyStatus_OK()
 #include "pycore_long.h"          // _PyLong_DigitValue
@@ -51,6 +52,30 @@ static inline PyObject* bytes_get_empty(void)
 }
 
 
+// Allocate a bytes object of length 'size' > 0, reusing one of the same
+// length if the freelist has one.  The contents are left uninitialized.
+static PyBytesObject *
+bytes_new_uninitialized(Py_ssize_t size)
+{
+    assert(size > 0);
+    PyBytesObject *op;
+    if (size <= PyBytes_MAXSAVESIZE) {
+        op = _Py_FREELIST_POP(PyBytesObject, bytes[size - 1]);
+        if (op != NULL) {
+            assert(Py_SIZE(op) == size);
+            return op;
+        }
+    }
+    /* Inline PyObject_NewVar */
+    op = (PyBytesObject *)PyObject_Malloc(PyBytesObject_SIZE + size);
+    if (op == NULL) {
+        return (PyBytesObject *)PyErr_NoMemory();
+    }
+    _PyObject_InitVar((PyVarObject*)op, &PyBytes_Type, size);
+    return op;
+}
+
+
 /*
    For PyBytes_FromString(), the parameter 'str' points to a null-terminated
    string containing exactly 'size' bytes.
@@ -89,15 +114,20 @@ _PyBytes_FromSize(Py_ssize_t size, int use_calloc)
         return NULL;
     }
 
-    /* Inline PyObject_NewVar */
-    if (use_calloc)
+    if (use_calloc) {
+        /* Inline PyObject_NewVar */
         op = (PyBytesObject *)PyObject_Calloc(1, PyBytesObject_SIZE + size);
-    else
-        op = (PyBytesObject *)PyObject_Malloc(PyBytesObject_SIZE + size);
-    if (op == NULL) {
-        return PyErr_NoMemory();
+        if (op == NULL) {
+            return PyErr_NoMemory();
+        }
+        _PyObject_InitVar((PyVarObject*)op, &PyBytes_Type, size);
+    }
+    else {
+        op = bytes_new_uninitialized(size);
+        if (op == NULL) {
+            return NULL;
+        }
     }
-    _PyObject_InitVar((PyVarObject*)op, &PyBytes_Type, size);
 _Py_COMP_DIAG_PUSH
 _Py_COMP_DIAG_IGNORE_DEPR_DECLS
     op->ob_shash = -1;
@@ -159,12 +189,10 @@ PyBytes_FromString(const char *str)
         return (PyObject *)op;
     }
 
-    /* Inline PyObject_NewVar */
-    op = (PyBytesObject *)PyObject_Malloc(PyBytesObject_SIZE + size);
+    op = bytes_new_uninitialized(size);
     if (op == NULL) {
-        return PyErr_NoMemory();
+        return NULL;
     }
-    _PyObject_InitVar((PyVarObject*)op, &PyBytes_Type, size);
 _Py_COMP_DIAG_PUSH
 _Py_COMP_DIAG_IGNORE_DEPR_DECLS
     op->ob_shash = -1;
@@ -1386,6 +1414,17 @@ PyBytes_Repr(PyObject *obj, int smartquotes)
     return NULL;
 }
 
+static void
+bytes_dealloc(PyObject *op)
+{
+    Py_ssize_t size = Py_SIZE(op);
+    if (PyBytes_CheckExact(op) && 0 < size && size <= PyBytes_MAXSAVESIZE) {
+        _Py_FREELIST_FREE(bytes[size - 1], op, PyObject_Free);
+        return;
+    }
+    Py_TYPE(op)->tp_free(op);
+}
+
 static PyObject *
 bytes_repr(PyObject *op)
 {
@@ -3043,7 +3082,7 @@ PyTypeObject PyBytes_Type = {
     "bytes",
     PyBytesObject_SIZE,
     sizeof(char),
-    0,                                          /* tp_dealloc */
+    bytes_dealloc,                              /* tp_dealloc */
     0,                                          /* tp_vectorcall_offset */
     0,                                          /* tp_getattr */
     0,                                          /* tp_setattr */
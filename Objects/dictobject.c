@@ -38,7 +38,8 @@ Size of indices is dk_size.  Type of each index in indices varies with dk_size:
 
 * int8  for          dk_size <= 128
 * int16 for 256   <= dk_size <= 2**15
-* int32 for 2**16 <= dk_size <= 2**31
+* int32 for 2**16 <= dk_size <= 2**31, with a tag in the top byte for
+  dk_size <= 2**24 (see DK_HAS_TAGS())
 * int64 for 2**32 <= dk_size
 
 dk_entries is array of PyDictKeyEntry when dk_kind == DICT_KEYS_GENERAL or
@@ -130,6 +131,7 @@ As a consequence of this, split keys have a maximum size of 16.
 #include "pycore_pystate.h"              // _PyThreadState_GET()
 #include "pycore_setobject.h"            // _PySet_NextEntry()
 #include "stringlib/eq.h"                // unicode_eq()
+#include "stringlib/simd.h"              // STRINGLIB_HAVE_SSE2
 
 #include <stdbool.h>
 
@@ -472,6 +474,63 @@ dictkeys_decref(PyInterpreterState *interp, PyDictKeysObject *dk, bool use_qsbr)
     }
 }
 
+/* Tables of 2**DK_TAGS_LOG_MINSIZE to 2**DK_TAGS_LOG_MAXSIZE slots keep a
+   tag in the top byte of each slot of dk_indices:  DK_TAG_EMPTY for an
+   unused slot, DK_TAG_DUMMY for a dummy one, and 7 bits of the hash of the
+   key otherwise.  The index is in the low 24 bits, where DKIX_EMPTY and
+   DKIX_DUMMY are 0xffffff and 0xfffffe, so that filling the table with 0xff
+   bytes leaves all its slots unused.  The slots are probed in aligned groups
+   of DK_GROUP_SIZE:  the tags of a group are compared with the tag of the key
+   at once, so that dk_entries is only read for the slots whose tag matches,
+   and a lookup stops at the first group with an unused slot.  A group is 64
+   contiguous bytes, so a miss usually costs a single cache miss (two if the
+   group straddles two lines), and a hit one more for the entry, as without
+   tags.
+
+   The groups are probed in triangular order (the group of the hash, then 1,
+   3, 6, ... groups further), which visits all of them.  As ints hash to
+   themselves, the hash is first mixed by a multiplication (Fibonacci
+   hashing); its top bits select the first group, and the next 7 bits give
+   the tag.
+
+   Bigger tables need all 32 bits of their slots for the index.  The
+   free-threaded build does not use tags, for lock-free lookups. */
+#ifdef Py_GIL_DISABLED
+#  define DK_HAS_TAGS(dk) 0
+#else
+#  define DK_TAGS_LOG_MINSIZE 16
+#  define DK_TAGS_LOG_MAXSIZE 24
+#  define DK_HAS_TAGS(dk) (DK_LOG_SIZE(dk) >= DK_TAGS_LOG_MINSIZE && \
+                           DK_LOG_SIZE(dk) <= DK_TAGS_LOG_MAXSIZE)
+#endif
+#define DK_GROUP_SIZE 16
+#define DK_TAG_EMPTY 0xff
+#define DK_TAG_DUMMY 0xfe
+#define DK_SLOT_INDEX_MASK 0xffffffu
+#if SIZEOF_SIZE_T > 4
+#  define DK_TAGS_MULTIPLIER 0x9e3779b97f4a7c15u
+#else
+#  define DK_TAGS_MULTIPLIER 0x9e3779b9u
+#endif
+
+static inline Py_ssize_t
+dk_slot_index(uint32_t slot)
+{
+    return (Py_ssize_t)((slot + 2) & DK_SLOT_INDEX_MASK) - 2;
+}
+
+static inline uint8_t
+dk_slot_tag(uint32_t slot)
+{
+    return (uint8_t)(slot >> 24);
+}
+
+static inline uint32_t *
+dictkeys_slots(PyDictKeysObject *keys)
+{
+    return (uint32_t *)keys->dk_indices;
+}
+
 /* lookup indices.  returns DKIX_EMPTY, DKIX_DUMMY, or ix >=0 */
 static inline Py_ssize_t
 dictkeys_get_index(const PyDictKeysObject *keys, Py_ssize_t i)
@@ -485,6 +544,11 @@ dictkeys_get_index(const PyDictKeysObject *keys, Py_ssize_t i)
     else if (log2size < 16) {
         ix = LOAD_INDEX(keys, 16, i);
     }
+#ifdef DK_TAGS_LOG_MINSIZE
+    else if (log2size <= DK_TAGS_LOG_MAXSIZE) {
+        ix = dk_slot_index((uint32_t)LOAD_INDEX(keys, 32, i));
+    }
+#endif
 #if SIZEOF_VOID_P > 4
     else if (log2size >= 32) {
         ix = LOAD_INDEX(keys, 64, i);
@@ -514,6 +578,14 @@ dictkeys_set_index(PyDictKeysObject *keys, Py_ssize_t i, Py_ssize_t ix)
         assert(ix <= 0x7fff);
         STORE_INDEX(keys, 16, i, ix);
     }
+#ifdef DK_TAGS_LOG_MINSIZE
+    else if (log2size <= DK_TAGS_LOG_MAXSIZE) {
+        assert(ix < (Py_ssize_t)DK_SLOT_INDEX_MASK - 1);
+        uint32_t slot = (uint32_t)LOAD_INDEX(keys, 32, i);
+        slot = (slot & ~DK_SLOT_INDEX_MASK) | ((size_t)ix & DK_SLOT_INDEX_MASK);
+        STORE_INDEX(keys, 32, i, slot);
+    }
+#endif
 #if SIZEOF_VOID_P > 4
     else if (log2size >= 32) {
         STORE_INDEX(keys, 64, i, ix);
@@ -539,6 +611,158 @@ dictkeys_set_index(PyDictKeysObject *keys, Py_ssize_t i, Py_ssize_t ix)
  */
 #define USABLE_FRACTION(n) (((n) << 1)/3)
 
+/* Where the probes for a hash start, and its tag. */
+typedef struct {
+    size_t group;
+    size_t stride;
+    uint8_t tag;
+} dk_probe;
+
+static inline dk_probe
+dictkeys_probe_start(PyDictKeysObject *keys, Py_hash_t hash)
+{
+    size_t h = (size_t)hash * DK_TAGS_MULTIPLIER;
+    int shift = 8 * SIZEOF_SIZE_T - DK_LOG_SIZE(keys) + 4;
+    assert(DK_LOG_SIZE(keys) > 4);
+    dk_probe p = {(h >> shift) * DK_GROUP_SIZE, 0,
+                  (uint8_t)((h >> (shift - 7)) & 0x7f)};
+    return p;
+}
+
+static inline void
+dictkeys_probe_next(PyDictKeysObject *keys, dk_probe *p)
+{
+    p->stride += DK_GROUP_SIZE;
+    p->group = (p->group + p->stride) & DK_MASK(keys);
+}
+
+/* Return a bit mask of the slots of a group whose tag is `tag`, or of those
+   which are free (unused or dummy), or of those which are unused.  The slot
+   of the lowest set bit is DK_GROUP_SLOT(mask). */
+#if defined(STRINGLIB_HAVE_SSE2)
+#define DK_GROUP_SLOT(mask) stringlib_ctz64(mask)
+
+/* The tags of a group, the top bytes of its 16 slots. */
+static inline __m128i
+dk_group_tags(const uint32_t *group)
+{
+    const __m128i *p = (const __m128i *)group;
+    __m128i lo = _mm_packs_epi32(_mm_srli_epi32(_mm_loadu_si128(p), 24),
+                                 _mm_srli_epi32(_mm_loadu_si128(p + 1), 24));
+    __m128i hi = _mm_packs_epi32(_mm_srli_epi32(_mm_loadu_si128(p + 2), 24),
+                                 _mm_srli_epi32(_mm_loadu_si128(p + 3), 24));
+    return _mm_packus_epi16(lo, hi);
+}
+
+static inline uint64_t
+dk_group_match(const uint32_t *group, uint8_t tag)
+{
+    __m128i eq = _mm_cmpeq_epi8(dk_group_tags(group), _mm_set1_epi8(tag));
+    return (uint32_t)_mm_movemask_epi8(eq);
+}
+
+static inline uint64_t
+dk_group_free(const uint32_t *group)
+{
+    return (uint32_t)_mm_movemask_epi8(dk_group_tags(group));
+}
+#elif defined(STRINGLIB_HAVE_NEON)
+/* A bit mask with a nibble per slot, keeping its highest bit. */
+#define DK_GROUP_SLOT(mask) (stringlib_ctz64(mask) >> 2)
+
+static inline uint64_t
+dk_group_mask(uint8x16_t eq)
+{
+    uint8x8_t narrow = vshrn_n_u16(vreinterpretq_u16_u8(eq), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(narrow), 0) &
+           0x8888888888888888u;
+}
+
+/* The tags of a group, the top bytes of its 16 slots. */
+static inline uint8x16_t
+dk_group_tags(const uint32_t *group)
+{
+    return vld4q_u8((const uint8_t *)group).val[3];
+}
+
+static inline uint64_t
+dk_group_match(const uint32_t *group, uint8_t tag)
+{
+    return dk_group_mask(vceqq_u8(dk_group_tags(group), vdupq_n_u8(tag)));
+}
+
+static inline uint64_t
+dk_group_free(const uint32_t *group)
+{
+    return dk_group_mask(vcltq_s8(vreinterpretq_s8_u8(dk_group_tags(group)),
+                                  vdupq_n_s8(0)));
+}
+#else
+#define DK_GROUP_SLOT(mask) _Py_bit_length(((mask) & -(mask)) - 1)
+
+static inline uint64_t
+dk_group_match(const uint32_t *group, uint8_t tag)
+{
+    uint64_t mask = 0;
+    for (int i = 0; i < DK_GROUP_SIZE; i++) {
+        mask |= (uint64_t)(dk_slot_tag(group[i]) == tag) << i;
+    }
+    return mask;
+}
+
+static inline uint64_t
+dk_group_free(const uint32_t *group)
+{
+    uint64_t mask = 0;
+    for (int i = 0; i < DK_GROUP_SIZE; i++) {
+        mask |= (uint64_t)(group[i] >> 31) << i;
+    }
+    return mask;
+}
+#endif
+
+static inline int
+dk_group_has_empty(const uint32_t *group)
+{
+    return dk_group_match(group, DK_TAG_EMPTY) != 0;
+}
+
+/* Set the tag of slot i, which now holds the entry of the given hash. */
+static inline void
+dictkeys_set_tag(PyDictKeysObject *keys, Py_ssize_t i, Py_hash_t hash)
+{
+    if (DK_HAS_TAGS(keys)) {
+        uint32_t *slot = dictkeys_slots(keys) + i;
+        uint8_t tag = dictkeys_probe_start(keys, hash).tag;
+        *slot = (*slot & DK_SLOT_INDEX_MASK) | ((uint32_t)tag << 24);
+    }
+}
+
+/* Find a free slot for hash in a table with tags. */
+static Py_ssize_t
+dictkeys_tags_find_free(PyDictKeysObject *keys, Py_hash_t hash)
+{
+    const uint32_t *slots = dictkeys_slots(keys);
+    dk_probe p = dictkeys_probe_start(keys, hash);
+    for (;;) {
+        uint64_t free = dk_group_free(slots + p.group);
+        if (free) {
+            return p.group + DK_GROUP_SLOT(free);
+        }
+        dictkeys_probe_next(keys, &p);
+    }
+}
+
+/* Mark slot i, which now holds DKIX_DUMMY, as dummy in the tags. */
+static inline void
+dictkeys_set_tag_dummy(PyDictKeysObject *keys, Py_ssize_t i)
+{
+    if (DK_HAS_TAGS(keys)) {
+        uint32_t *slot = dictkeys_slots(keys) + i;
+        *slot = (*slot & DK_SLOT_INDEX_MASK) | ((uint32_t)DK_TAG_DUMMY << 24);
+    }
+}
+
 /* Find the smallest dk_size >= minsize. */
 static inline uint8_t
 calculate_log2_keysize(Py_ssize_t minsize)
@@ -686,6 +910,21 @@ _PyDict_CheckConsistency(PyObject *op, int check_content)
         for (Py_ssize_t i=0; i < DK_SIZE(keys); i++) {
             Py_ssize_t ix = dictkeys_get_index(keys, i);
             CHECK(DKIX_DUMMY <= ix && ix <= usable);
+            if (DK_HAS_TAGS(keys)) {
+                uint8_t tag = dk_slot_tag(dictkeys_slots(keys)[i]);
+                if (ix == DKIX_EMPTY) {
+                    CHECK(tag == DK_TAG_EMPTY);
+                }
+                else if (ix == DKIX_DUMMY) {
+                    CHECK(tag == DK_TAG_DUMMY);
+                }
+                else {
+                    Py_hash_t hash = DK_IS_UNICODE(keys)
+                        ? unicode_get_hash(DK_UNICODE_ENTRIES(keys)[ix].me_key)
+                        : DK_ENTRIES(keys)[ix].me_hash;
+                    CHECK(tag == dictkeys_probe_start(keys, hash).tag);
+                }
+            }
         }
 
         if (keys->dk_kind == DICT_KEYS_GENERAL) {
@@ -866,7 +1105,7 @@ new_dict(PyInterpreterState *interp,
          Py_ssize_t used, int free_values_on_failure)
 {
     assert(keys != NULL);
-    PyDictObject *mp = _Py_FREELIST_POP(PyDictObject, dicts);
+    PyDictObject *mp = _Py_FREELIST_POP_GC(PyDictObject, dicts);
     if (mp == NULL) {
         mp = PyObject_GC_New(PyDictObject, &PyDict_Type);
         if (mp == NULL) {
@@ -886,10 +1125,38 @@ new_dict(PyInterpreterState *interp,
     return (PyObject *)mp;
 }
 
+/* Return the number of values to allocate for a new object or instance dict
+   using the shared keys of its class.
+
+   The number of usable entries shrinks by one for each new object, so that
+   the values of later objects are sized for the attributes their class
+   actually has rather than for SHARED_KEYS_MAX_SIZE.  Since
+   shared_keys_usable_size() never grows, the values of existing objects
+   remain large enough for every key that can still be added. */
+static size_t
+shared_keys_reserve_values(PyDictKeysObject *keys)
+{
+#ifdef Py_GIL_DISABLED
+    Py_ssize_t usable = _Py_atomic_load_ssize_relaxed(&keys->dk_usable);
+    if (usable > 1) {
+        LOCK_KEYS(keys);
+        if (keys->dk_usable > 1) {
+            _Py_atomic_store_ssize(&keys->dk_usable, keys->dk_usable - 1);
+        }
+        UNLOCK_KEYS(keys);
+    }
+#else
+    if (keys->dk_usable > 1) {
+        keys->dk_usable--;
+    }
+#endif
+    return shared_keys_usable_size(keys);
+}
+
 static PyObject *
 new_dict_with_shared_keys(PyInterpreterState *interp, PyDictKeysObject *keys)
 {
-    size_t size = shared_keys_usable_size(keys);
+    size_t size = shared_keys_reserve_values(keys);
     PyDictValues *values = new_values(size);
     if (values == NULL) {
         return PyErr_NoMemory();
@@ -973,6 +1240,25 @@ PyDict_New(void)
 static Py_ssize_t
 lookdict_index(PyDictKeysObject *k, Py_hash_t hash, Py_ssize_t index)
 {
+    if (DK_HAS_TAGS(k)) {
+        const uint32_t *slots = dictkeys_slots(k);
+        dk_probe p = dictkeys_probe_start(k, hash);
+        for (;;) {
+            const uint32_t *group = slots + p.group;
+            uint64_t match = dk_group_match(group, p.tag);
+            for (; match; match &= match - 1) {
+                size_t i = DK_GROUP_SLOT(match);
+                if (dk_slot_index(group[i]) == index) {
+                    return p.group + i;
+                }
+            }
+            if (dk_group_has_empty(group)) {
+                return DKIX_EMPTY;
+            }
+            dictkeys_probe_next(k, &p);
+        }
+    }
+
     size_t mask = DK_MASK(k);
     size_t perturb = (size_t)hash;
     size_t i = (size_t)hash & mask;
@@ -991,10 +1277,45 @@ lookdict_index(PyDictKeysObject *k, Py_hash_t hash, Py_ssize_t index)
     Py_UNREACHABLE();
 }
 
+/* Lookup in a table with tags:  only the slots whose tag matches are
+   checked.  check_lookup() may run Python code changing the tags, so the
+   slot indices are checked again. */
+static inline Py_ALWAYS_INLINE Py_ssize_t
+do_lookup_tags(PyDictObject *mp, PyDictKeysObject *dk, PyObject *key, Py_hash_t hash,
+               int (*check_lookup)(PyDictObject *, PyDictKeysObject *, void *, Py_ssize_t ix, PyObject *key, Py_hash_t))
+{
+    void *ep0 = _DK_ENTRIES(dk);
+    const uint32_t *slots = dictkeys_slots(dk);
+    dk_probe p = dictkeys_probe_start(dk, hash);
+    for (;;) {
+        const uint32_t *group = slots + p.group;
+        uint64_t match = dk_group_match(group, p.tag);
+        for (; match; match &= match - 1) {
+            Py_ssize_t ix = dk_slot_index(group[DK_GROUP_SLOT(match)]);
+            if (ix >= 0) {
+                int cmp = check_lookup(mp, dk, ep0, ix, key, hash);
+                if (cmp < 0) {
+                    return cmp;
+                } else if (cmp) {
+                    return ix;
+                }
+            }
+        }
+        if (dk_group_has_empty(group)) {
+            return DKIX_EMPTY;
+        }
+        dictkeys_probe_next(dk, &p);
+    }
+    Py_UNREACHABLE();
+}
+
 static inline Py_ALWAYS_INLINE Py_ssize_t
 do_lookup(PyDictObject *mp, PyDictKeysObject *dk, PyObject *key, Py_hash_t hash,
           int (*check_lookup)(PyDictObject *, PyDictKeysObject *, void *, Py_ssize_t ix, PyObject *key, Py_hash_t))
 {
+    if (DK_HAS_TAGS(dk)) {
+        return do_lookup_tags(mp, dk, key, hash, check_lookup);
+    }
     void *ep0 = _DK_ENTRIES(dk);
     size_t mask = DK_MASK(dk);
     size_t perturb = hash;
@@ -1672,6 +1993,9 @@ find_empty_slot(PyDictKeysObject *keys, Py_hash_t hash)
 {
     assert(keys != NULL);
 
+    if (DK_HAS_TAGS(keys)) {
+        return dictkeys_tags_find_free(keys, hash);
+    }
     const size_t mask = DK_MASK(keys);
     size_t i = hash & mask;
     Py_ssize_t ix = dictkeys_get_index(keys, i);
@@ -1701,10 +2025,11 @@ insert_combined_dict(PyInterpreterState *interp, PyDictObject *mp,
     }
 
     _PyDict_NotifyEvent(interp, PyDict_EVENT_ADDED, mp, key, value);
-    mp->ma_keys->dk_version = 0;
+    FT_ATOMIC_STORE_UINT32_RELAXED(mp->ma_keys->dk_version, 0);
 
     Py_ssize_t hashpos = find_empty_slot(mp->ma_keys, hash);
     dictkeys_set_index(mp->ma_keys, hashpos, mp->ma_keys->dk_nentries);
+    dictkeys_set_tag(mp->ma_keys, hashpos, hash);
 
     if (DK_IS_UNICODE(mp->ma_keys)) {
         PyDictUnicodeEntry *ep;
@@ -1743,10 +2068,11 @@ insert_split_key(PyDictKeysObject *keys, PyObject *key, Py_hash_t hash)
     ix = unicodekeys_lookup_unicode(keys, key, hash);
     if (ix == DKIX_EMPTY && keys->dk_usable > 0) {
         // Insert into new slot
-        keys->dk_version = 0;
+        FT_ATOMIC_STORE_UINT32_RELAXED(keys->dk_version, 0);
         Py_ssize_t hashpos = find_empty_slot(keys, hash);
         ix = keys->dk_nentries;
         dictkeys_set_index(keys, hashpos, ix);
+        dictkeys_set_tag(keys, hashpos, hash);
         PyDictUnicodeEntry *ep = &DK_UNICODE_ENTRIES(keys)[ix];
         STORE_SHARED_KEY(ep->me_key, Py_NewRef(key));
         split_keys_entry_added(keys);
@@ -1911,6 +2237,14 @@ Internal routine used by dictresize() to build a hashtable of entries.
 static void
 build_indices_generic(PyDictKeysObject *keys, PyDictKeyEntry *ep, Py_ssize_t n)
 {
+    if (DK_HAS_TAGS(keys)) {
+        for (Py_ssize_t ix = 0; ix != n; ix++, ep++) {
+            Py_ssize_t i = dictkeys_tags_find_free(keys, ep->me_hash);
+            dictkeys_set_index(keys, i, ix);
+            dictkeys_set_tag(keys, i, ep->me_hash);
+        }
+        return;
+    }
     size_t mask = DK_MASK(keys);
     for (Py_ssize_t ix = 0; ix != n; ix++, ep++) {
         Py_hash_t hash = ep->me_hash;
@@ -1926,6 +2260,16 @@ build_indices_generic(PyDictKeysObject *keys, PyDictKeyEntry *ep, Py_ssize_t n)
 static void
 build_indices_unicode(PyDictKeysObject *keys, PyDictUnicodeEntry *ep, Py_ssize_t n)
 {
+    if (DK_HAS_TAGS(keys)) {
+        for (Py_ssize_t ix = 0; ix != n; ix++, ep++) {
+            Py_hash_t hash = unicode_get_hash(ep->me_key);
+            assert(hash != -1);
+            Py_ssize_t i = dictkeys_tags_find_free(keys, hash);
+            dictkeys_set_index(keys, i, ix);
+            dictkeys_set_tag(keys, i, hash);
+        }
+        return;
+    }
     size_t mask = DK_MASK(keys);
     for (Py_ssize_t ix = 0; ix != n; ix++, ep++) {
         Py_hash_t hash = unicode_get_hash(ep->me_key);
@@ -2679,8 +3023,9 @@ delitem_common(PyDictObject *mp, Py_hash_t hash, Py_ssize_t ix,
         ASSERT_CONSISTENT(mp);
     }
     else {
-        mp->ma_keys->dk_version = 0;
+        FT_ATOMIC_STORE_UINT32_RELAXED(mp->ma_keys->dk_version, 0);
         dictkeys_set_index(mp->ma_keys, hashpos, DKIX_DUMMY);
+        dictkeys_set_tag_dummy(mp->ma_keys, hashpos);
         if (DK_IS_UNICODE(mp->ma_keys)) {
             PyDictUnicodeEntry *ep = &DK_UNICODE_ENTRIES(mp->ma_keys)[ix];
             old_key = ep->me_key;
@@ -4498,7 +4843,7 @@ dict_popitem_impl(PyDictObject *self)
             return NULL;
         }
     }
-    self->ma_keys->dk_version = 0;
+    FT_ATOMIC_STORE_UINT32_RELAXED(self->ma_keys->dk_version, 0);
 
     /* Pop last item */
     PyObject *key, *value;
@@ -4539,6 +4884,7 @@ dict_popitem_impl(PyDictObject *self)
     assert(j >= 0);
     assert(dictkeys_get_index(self->ma_keys, j) == i);
     dictkeys_set_index(self->ma_keys, j, DKIX_DUMMY);
+    dictkeys_set_tag_dummy(self->ma_keys, j);
 
     PyTuple_SET_ITEM(res, 0, key);
     PyTuple_SET_ITEM(res, 1, value);
@@ -6713,21 +7059,7 @@ _PyObject_InitInlineValues(PyObject *obj, PyTypeObject *tp)
     PyDictKeysObject *keys = CACHED_KEYS(tp);
     assert(keys != NULL);
     OBJECT_STAT_INC(inline_values);
-#ifdef Py_GIL_DISABLED
-    Py_ssize_t usable = _Py_atomic_load_ssize_relaxed(&keys->dk_usable);
-    if (usable > 1) {
-        LOCK_KEYS(keys);
-        if (keys->dk_usable > 1) {
-            _Py_atomic_store_ssize(&keys->dk_usable, keys->dk_usable - 1);
-        }
-        UNLOCK_KEYS(keys);
-    }
-#else
-    if (keys->dk_usable > 1) {
-        keys->dk_usable--;
-    }
-#endif
-    size_t size = shared_keys_usable_size(keys);
+    size_t size = shared_keys_reserve_values(keys);
     PyDictValues *values = _PyObject_InlineValues(obj);
     assert(size < 256);
     values->capacity = (uint8_t)size;
@@ -7390,20 +7722,60 @@ _PyDictKeys_DecRef(PyDictKeysObject *keys)
     dictkeys_decref(interp, keys, false);
 }
 
-uint32_t _PyDictKeys_GetVersionForCurrentState(PyInterpreterState *interp,
-                                               PyDictKeysObject *dictkeys)
+static uint32_t
+get_next_dict_keys_version(PyInterpreterState *interp)
 {
-    if (dictkeys->dk_version != 0) {
-        return dictkeys->dk_version;
-    }
+#ifdef Py_GIL_DISABLED
+    uint32_t v;
+    do {
+        v = _Py_atomic_load_uint32_relaxed(
+            &interp->dict_state.next_keys_version);
+        if (v == 0) {
+            return 0;
+        }
+    } while (!_Py_atomic_compare_exchange_uint32(
+        &interp->dict_state.next_keys_version, &v, v + 1));
+#else
     if (interp->dict_state.next_keys_version == 0) {
         return 0;
     }
     uint32_t v = interp->dict_state.next_keys_version++;
-    dictkeys->dk_version = v;
+#endif
     return v;
 }
 
+// In free-threaded builds the caller must ensure that the keys object is not
+// being mutated concurrently by another thread.
+uint32_t
+_PyDictKeys_GetVersionForCurrentState(PyInterpreterState *interp,
+                                      PyDictKeysObject *dictkeys)
+{
+    uint32_t dk_version = FT_ATOMIC_LOAD_UINT32_RELAXED(dictkeys->dk_version);
+    if (dk_version != 0) {
+        return dk_version;
+    }
+    dk_version = get_next_dict_keys_version(interp);
+    FT_ATOMIC_STORE_UINT32_RELAXED(dictkeys->dk_version, dk_version);
+    return dk_version;
+}
+
+uint32_t
+_PyDict_GetKeysVersionForCurrentState(PyInterpreterState *interp,
+                                      PyDictObject *dict)
+{
+    ASSERT_DICT_LOCKED((PyObject *) dict);
+    uint32_t dk_version =
+        _PyDictKeys_GetVersionForCurrentState(interp, dict->ma_keys);
+#ifdef Py_GIL_DISABLED
+    // Specialized code reads the keys of a versioned dict without locking
+    // it, so a resize must free the old keys with QSBR from now on.
+    if (!IS_DICT_SHARED(dict)) {
+        SET_DICT_SHARED(dict);
+    }
+#endif
+    return dk_version;
+}
+
 static inline int
 validate_watcher_id(PyInterpreterState *interp, int watcher_id)
 {
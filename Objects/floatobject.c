@@ -143,6 +143,18 @@ PyObject *_PyFloat_FromDouble_ConsumeInputs(_PyStackRef left, _PyStackRef right,
     return PyFloat_FromDouble(value);
 }
 
+int _PyFloat_StoreDouble_ConsumeInputs(_PyStackRef *target, _PyStackRef left, _PyStackRef right, double value)
+{
+    PyObject *result = _PyFloat_FromDouble_ConsumeInputs(left, right, value);
+    if (result == NULL) {
+        return -1;
+    }
+    _PyStackRef old = *target;
+    *target = PyStackRef_FromPyObjectSteal(result);
+    PyStackRef_CLOSE(old);
+    return 0;
+}
+
 #else // Py_GIL_DISABLED
 
 PyObject *_PyFloat_FromDouble_ConsumeInputs(_PyStackRef left, _PyStackRef right, double value)
@@ -167,6 +179,29 @@ PyObject *_PyFloat_FromDouble_ConsumeInputs(_PyStackRef left, _PyStackRef right,
     }
 }
 
+/* Store value in the local *target, which holds the same float as left.
+ * If the local and left hold the only references to that float, update it in
+ * place, so that `x = x + y` and `x += y` keep reusing one float object. */
+int _PyFloat_StoreDouble_ConsumeInputs(_PyStackRef *target, _PyStackRef left, _PyStackRef right, double value)
+{
+    assert(PyStackRef_Is(*target, left));
+    PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+    if (Py_REFCNT(left_o) == 2) {
+        ((PyFloatObject *)left_o)->ob_fval = value;
+        _Py_DECREF_NO_DEALLOC(left_o);
+        PyStackRef_CLOSE_SPECIALIZED(right, _PyFloat_ExactDealloc);
+        return 0;
+    }
+    PyObject *result = _PyFloat_FromDouble_ConsumeInputs(left, right, value);
+    if (result == NULL) {
+        return -1;
+    }
+    _PyStackRef old = *target;
+    *target = PyStackRef_FromPyObjectSteal(result);
+    PyStackRef_CLOSE_SPECIALIZED(old, _PyFloat_ExactDealloc);
+    return 0;
+}
+
 #endif // Py_GIL_DISABLED
 
 static PyObject *
@@ -4,6 +4,7 @@
 #include "pycore_ceval.h"         // _PyEval_SetOpcodeTrace()
 #include "pycore_code.h"          // CO_FAST_LOCAL, etc.
 #include "pycore_dict.h"          // _PyDict_LoadBuiltinsFromGlobals()
+#include "pycore_freelist.h"      // _Py_FREELIST_FREE(), _Py_FREELIST_POP()
 #include "pycore_function.h"      // _PyFunction_FromConstructor()
 #include "pycore_moduleobject.h"  // _PyModule_GetDict()
 #include "pycore_modsupport.h"    // _PyArg_CheckPositional()
@@ -1727,7 +1728,13 @@ frame_dealloc(PyFrameObject *f)
     Py_CLEAR(f->f_trace);
     Py_CLEAR(f->f_extra_locals);
     Py_CLEAR(f->f_locals_cache);
-    PyObject_GC_Del(f);
+    int size_class = f->f_size_class;
+    if (size_class >= 0) {
+        _Py_FREELIST_FREE(frames[size_class], f, PyObject_GC_Del);
+    }
+    else {
+        PyObject_GC_Del(f);
+    }
     Py_TRASHCAN_END;
 }
 
@@ -1880,10 +1887,28 @@ _PyFrame_New_NoTrack(PyCodeObject *code)
 {
     CALL_STAT_INC(frame_objects_created);
     int slots = code->co_nlocalsplus + code->co_stacksize;
-    PyFrameObject *f = PyObject_GC_NewVar(PyFrameObject, &PyFrame_Type, slots);
+    PyFrameObject *f = NULL;
+    // Small frames get the size of their class so that they can be reused.
+    int size_class = 0;
+    while (size_class < Py_FRAME_FREELIST_CLASSES
+           && (Py_FRAME_FREELIST_MIN_SLOTS << size_class) < slots)
+    {
+        size_class++;
+    }
+    if (size_class < Py_FRAME_FREELIST_CLASSES) {
+        slots = Py_FRAME_FREELIST_MIN_SLOTS << size_class;
+        f = _Py_FREELIST_POP_GC(PyFrameObject, frames[size_class]);
+    }
+    else {
+        size_class = -1;
+    }
     if (f == NULL) {
-        return NULL;
+        f = PyObject_GC_NewVar(PyFrameObject, &PyFrame_Type, slots);
+        if (f == NULL) {
+            return NULL;
+        }
     }
+    f->f_size_class = size_class;
     f->f_back = NULL;
     f->f_trace = NULL;
     f->f_trace_lines = 1;
@@ -6,6 +6,7 @@
 #include "pycore_bitutils.h"      // _Py_popcount32()
 #include "pycore_initconfig.h"    // _PyStatus_OK()
 #include "pycore_call.h"          // _PyObject_MakeTpCall
+#include "pycore_freelist.h"      // _Py_FREELIST_FREE(), _Py_FREELIST_POP()
 #include "pycore_long.h"          // _Py_SmallInts
 #include "pycore_object.h"        // _PyObject_Init()
 #include "pycore_runtime.h"       // _PY_NSMALLPOSINTS
@@ -28,21 +29,31 @@ class int "PyObject *" "&PyLong_Type"
 #define _MAX_STR_DIGITS_ERROR_FMT_TO_INT "Exceeds the limit (%d digits) for integer string conversion: value has %zd digits; use sys.set_int_max_str_digits() to increase the limit"
 #define _MAX_STR_DIGITS_ERROR_FMT_TO_STR "Exceeds the limit (%d digits) for integer string conversion; use sys.set_int_max_str_digits() to increase the limit"
 
-/* If defined, use algorithms from the _pylong.py module */
-#define WITH_PYLONG_MODULE 1
-
 // Forward declarations
 static PyLongObject* long_neg(PyLongObject *v);
 static PyLongObject *x_divrem(PyLongObject *, PyLongObject *, PyLongObject **);
+static PyLongObject *bz_divrem(PyLongObject *, PyLongObject *, PyLongObject **);
+static int long_divrem(PyLongObject *, PyLongObject *,
+                       PyLongObject **, PyLongObject **);
+static Py_ssize_t long_compare(PyLongObject *a, PyLongObject *b);
+static PyLongObject *long_add(PyLongObject *a, PyLongObject *b);
+static PyLongObject *long_sub(PyLongObject *a, PyLongObject *b);
+static PyLongObject *long_mul(PyLongObject *a, PyLongObject *b);
 static PyObject* long_long(PyObject *v);
 static PyObject* long_lshift_int64(PyLongObject *a, int64_t shiftby);
+static PyLongObject *k_mul(PyLongObject *a, PyLongObject *b);
+static PyLongObject *x_add(PyLongObject *a, PyLongObject *b);
+static PyLongObject *x_sub(PyLongObject *a, PyLongObject *b);
+static int ntt_mul_digits(const digit *a, Py_ssize_t size_a,
+                          const digit *b, Py_ssize_t size_b,
+                          digit *z, twodigits base);
 
 
 static inline void
 _Py_DECREF_INT(PyLongObject *op)
 {
     assert(PyLong_CheckExact(op));
-    _Py_DECREF_SPECIALIZED((PyObject *)op, (destructor)PyObject_Free);
+    _Py_DECREF_SPECIALIZED((PyObject *)op, _PyLong_ExactDealloc);
 }
 
 static inline int
@@ -80,6 +91,23 @@ maybe_small_long(PyLongObject *v)
 #define KARATSUBA_CUTOFF 70
 #define KARATSUBA_SQUARE_CUTOFF (2 * KARATSUBA_CUTOFF)
 
+/* Above NTT_CUTOFF digits, multiply with a number-theoretic transform
+ * instead (see ntt_mul_digits()), as long as the product has no more than
+ * NTT_MAX_SIZE digits.  Bigger products are split by Karatsuba first.
+ */
+#define NTT_CUTOFF 1200
+#define NTT_SQUARE_CUTOFF 1500
+#define NTT_MAX_SIZE ((Py_ssize_t)1 << 24)
+
+/* For int division, use the O(N**2) school algorithm (see x_divrem())
+ * unless both the divisor and the quotient contain at least BZ_DIV_CUTOFF
+ * digits.  Then use Burnikel and Ziegler's recursive algorithm (see
+ * bz_divrem()), which leaves divisors of at most BZ_DIV_LIMIT digits to the
+ * school algorithm.
+ */
+#define BZ_DIV_CUTOFF 80
+#define BZ_DIV_LIMIT 40
+
 /* For exponentiation, use the binary left-to-right algorithm unless the
  ^ exponent contains more than HUGE_EXP_CUTOFF bits.  In that case, do
  * (no more than) EXP_WINDOW_SIZE bits at a time.  The potential drawback is
@@ -220,15 +248,17 @@ _PyLong_FromMedium(sdigit x)
 {
     assert(!IS_SMALL_INT(x));
     assert(is_medium_int(x));
-    /* We could use a freelist here */
-    PyLongObject *v = PyObject_Malloc(sizeof(PyLongObject));
+    PyLongObject *v = _Py_FREELIST_POP(PyLongObject, ints);
     if (v == NULL) {
-        PyErr_NoMemory();
-        return NULL;
+        v = PyObject_Malloc(sizeof(PyLongObject));
+        if (v == NULL) {
+            PyErr_NoMemory();
+            return NULL;
+        }
+        _PyObject_Init((PyObject*)v, &PyLong_Type);
     }
     digit abs_x = x < 0 ? -x : x;
     _PyLong_SetSignAndDigitCount(v, x<0?-1:1, 1);
-    _PyObject_Init((PyObject*)v, &PyLong_Type);
     v->long_value.ob_digit[0] = abs_x;
     return (PyObject*)v;
 }
@@ -2035,71 +2065,280 @@ rem1(PyLongObject *a, digit n)
     );
 }
 
-#ifdef WITH_PYLONG_MODULE
-/* asymptotically faster long_to_decimal_string, using _pylong.py */
+/* Conversion to decimal of ints of more than TO_DECIMAL_DC_CUTOFF digits is
+   done by divide and conquer:  splitting n as hi * BASE**m + lo, the decimal
+   digits of n are those of hi times those of BASE**m, plus those of lo.  The
+   arithmetic is done on digits in base _PyLong_DECIMAL_BASE, with the NTT
+   for big products, and m is TO_DECIMAL_DC_LEAF * 2**k, so that the decimal
+   digits of the powers BASE**m are computed once, by repeated squaring.
+   This takes O(n log(n)**2) time, against O(n**2) for Knuth's method.
+*/
+#define TO_DECIMAL_DC_CUTOFF 600
+#define TO_DECIMAL_DC_LEAF 100
+/* Below DECIMAL_NTT_CUTOFF digits, decimal_mul() uses the school method. */
+#define DECIMAL_NTT_CUTOFF 150
+
+/* An upper bound for the number of digits required to express an int of
+   size_a digits in base _PyLong_DECIMAL_BASE:
+
+     #digits = 1 + floor(log2(a) / log2(_PyLong_DECIMAL_BASE))
+
+   But log2(a) < size_a * PyLong_SHIFT, and
+   log2(_PyLong_DECIMAL_BASE) = log2(10) * _PyLong_DECIMAL_SHIFT
+                              > 3.3 * _PyLong_DECIMAL_SHIFT
+
+     size_a * PyLong_SHIFT / (3.3 * _PyLong_DECIMAL_SHIFT) =
+         size_a + size_a / d < size_a + size_a / floor(d),
+   where d = (3.3 * _PyLong_DECIMAL_SHIFT) /
+             (PyLong_SHIFT - 3.3 * _PyLong_DECIMAL_SHIFT)
+*/
+static Py_ssize_t
+decimal_size_bound(Py_ssize_t size_a)
+{
+    int d = (33 * _PyLong_DECIMAL_SHIFT) /
+            (10 * PyLong_SHIFT - 33 * _PyLong_DECIMAL_SHIFT);
+    assert(size_a < PY_SSIZE_T_MAX/2);
+    return 1 + size_a + size_a / d;
+}
+
+/* Convert the array of base _PyLong_BASE digits pin[0:size_a] to an array
+   of base _PyLong_DECIMAL_BASE digits in pout, following Knuth (TAOCP,
+   Volume 2 (3rd edn), section 4.4, Method 1b).  pout must have room for
+   decimal_size_bound(size_a) digits.  Return the number of digits in pout
+   (0 for zero), or -1 if interrupted. */
+static Py_ssize_t
+digits_to_decimal(const digit *pin, Py_ssize_t size_a, digit *pout)
+{
+    Py_ssize_t size = 0, i, j;
+
+    for (i = size_a; --i >= 0; ) {
+        digit hi = pin[i];
+        for (j = 0; j < size; j++) {
+            twodigits z = (twodigits)pout[j] << PyLong_SHIFT | hi;
+            hi = (digit)(z / _PyLong_DECIMAL_BASE);
+            pout[j] = (digit)(z - (twodigits)hi *
+                              _PyLong_DECIMAL_BASE);
+        }
+        while (hi) {
+            pout[size++] = hi % _PyLong_DECIMAL_BASE;
+            hi /= _PyLong_DECIMAL_BASE;
+        }
+        /* check for keyboard interrupt */
+        SIGCHECK({
+                return -1;
+            });
+    }
+    return size;
+}
+
+/* Add the decimal digits b[0:size_b] to a[0:size_a], in place.  Return the
+   final carry. */
+static digit
+decimal_iadd(digit *a, Py_ssize_t size_a, const digit *b, Py_ssize_t size_b)
+{
+    Py_ssize_t i;
+    digit carry = 0;
+
+    assert(size_b <= size_a);
+    for (i = 0; i < size_b; i++) {
+        carry += a[i] + b[i];
+        a[i] = carry >= _PyLong_DECIMAL_BASE ?
+               carry - _PyLong_DECIMAL_BASE : carry;
+        carry = carry >= _PyLong_DECIMAL_BASE;
+    }
+    for (; carry && i < size_a; i++) {
+        carry += a[i];
+        a[i] = carry >= _PyLong_DECIMAL_BASE ?
+               carry - _PyLong_DECIMAL_BASE : carry;
+        carry = carry >= _PyLong_DECIMAL_BASE;
+    }
+    return carry;
+}
+
+/* Multiply the decimal digits a[0:size_a] and b[0:size_b] into
+   z[0:size_a+size_b].  Return 0 on success, or -1 with MemoryError set. */
 static int
-pylong_int_to_decimal_string(PyObject *aa,
-                             PyObject **p_output,
-                             _PyUnicodeWriter *writer,
-                             _PyBytesWriter *bytes_writer,
-                             char **bytes_str)
-{
-    PyObject *s = NULL;
-    PyObject *mod = PyImport_ImportModule("_pylong");
-    if (mod == NULL) {
-        return -1;
+decimal_mul(const digit *a, Py_ssize_t size_a,
+            const digit *b, Py_ssize_t size_b, digit *z)
+{
+    Py_ssize_t i, j;
+
+    if (size_a < DECIMAL_NTT_CUTOFF || size_b < DECIMAL_NTT_CUTOFF) {
+        memset(z, 0, (size_a + size_b) * sizeof(digit));
+        for (i = 0; i < size_a; i++) {
+            twodigits carry = 0, f = a[i];
+            digit *pz = z + i;
+            for (j = 0; j < size_b; j++) {
+                carry += pz[j] + f * b[j];
+                pz[j] = (digit)(carry % _PyLong_DECIMAL_BASE);
+                carry /= _PyLong_DECIMAL_BASE;
+            }
+            pz[size_b] = (digit)carry;
+        }
+        return 0;
     }
-    s = PyObject_CallMethod(mod, "int_to_decimal_string", "O", aa);
-    if (s == NULL) {
-        goto error;
+    if (size_a + size_b <= NTT_MAX_SIZE) {
+        return ntt_mul_digits(a, size_a, b, size_b, z, _PyLong_DECIMAL_BASE);
     }
-    if (!PyUnicode_Check(s)) {
-        PyErr_SetString(PyExc_TypeError,
-                        "_pylong.int_to_decimal_string did not return a str");
-        goto error;
+
+    /* Too big for one transform:  add up the products of slices. */
+    const Py_ssize_t slice = NTT_MAX_SIZE / 2;
+    digit *t = PyMem_New(digit, NTT_MAX_SIZE);
+    if (t == NULL) {
+        PyErr_NoMemory();
+        return -1;
     }
-    if (writer) {
-        Py_ssize_t size = PyUnicode_GET_LENGTH(s);
-        if (_PyUnicodeWriter_Prepare(writer, size, '9') == -1) {
-            goto error;
+    memset(z, 0, (size_a + size_b) * sizeof(digit));
+    for (i = 0; i < size_a; i += slice) {
+        Py_ssize_t n = Py_MIN(slice, size_a - i);
+        for (j = 0; j < size_b; j += slice) {
+            Py_ssize_t m = Py_MIN(slice, size_b - j);
+            if (ntt_mul_digits(a + i, n, b + j, m, t,
+                               _PyLong_DECIMAL_BASE) < 0) {
+                PyMem_Free(t);
+                return -1;
+            }
+            (void)decimal_iadd(z + i + j, size_a + size_b - i - j, t, n + m);
         }
-        if (_PyUnicodeWriter_WriteStr(writer, s) < 0) {
-            goto error;
+    }
+    PyMem_Free(t);
+    return 0;
+}
+
+/* The decimal digits of BASE**(TO_DECIMAL_DC_LEAF << k), for each k used. */
+typedef struct {
+    digit *digits[64];
+    Py_ssize_t size[64];
+} decimal_powers;
+
+static digit *
+decimal_power(decimal_powers *pows, int k, Py_ssize_t *psize)
+{
+    if (pows->digits[k] == NULL) {
+        digit *z;
+        Py_ssize_t size;
+        if (k == 0) {
+            digit *one = PyMem_New(digit, TO_DECIMAL_DC_LEAF + 1);
+            size = decimal_size_bound(TO_DECIMAL_DC_LEAF + 1);
+            z = PyMem_New(digit, size);
+            if (one == NULL || z == NULL) {
+                PyMem_Free(one);
+                PyMem_Free(z);
+                PyErr_NoMemory();
+                return NULL;
+            }
+            memset(one, 0, TO_DECIMAL_DC_LEAF * sizeof(digit));
+            one[TO_DECIMAL_DC_LEAF] = 1;
+            size = digits_to_decimal(one, TO_DECIMAL_DC_LEAF + 1, z);
+            PyMem_Free(one);
+            if (size < 0) {
+                PyMem_Free(z);
+                return NULL;
+            }
         }
-        goto success;
+        else {
+            Py_ssize_t half;
+            const digit *h = decimal_power(pows, k - 1, &half);
+            if (h == NULL) {
+                return NULL;
+            }
+            size = 2 * half;
+            z = PyMem_New(digit, size);
+            if (z == NULL) {
+                PyErr_NoMemory();
+                return NULL;
+            }
+            if (decimal_mul(h, half, h, half, z) < 0) {
+                PyMem_Free(z);
+                return NULL;
+            }
+            while (z[size - 1] == 0) {
+                size--;
+            }
+        }
+        pows->digits[k] = z;
+        pows->size[k] = size;
     }
-    else if (bytes_writer) {
-        Py_ssize_t size = PyUnicode_GET_LENGTH(s);
-        const void *data = PyUnicode_DATA(s);
-        int kind = PyUnicode_KIND(s);
-        *bytes_str = _PyBytesWriter_Prepare(bytes_writer, *bytes_str, size);
-        if (*bytes_str == NULL) {
-            goto error;
+    *psize = pows->size[k];
+    return pows->digits[k];
+}
+
+/* Return a new array with the decimal digits of pin[0:size_a], setting
+   *psize to their number, or NULL with an exception set. */
+static digit *
+digits_to_decimal_dc(const digit *pin, Py_ssize_t size_a,
+                     decimal_powers *pows, Py_ssize_t *psize)
+{
+    digit *lo, *hi, *z;
+    Py_ssize_t size_lo, size_hi, size_pow, size_z;
+    const digit *pow;
+
+    if (size_a <= TO_DECIMAL_DC_LEAF) {
+        z = PyMem_New(digit, decimal_size_bound(size_a));
+        if (z == NULL) {
+            PyErr_NoMemory();
+            return NULL;
         }
-        char *p = *bytes_str;
-        for (Py_ssize_t i=0; i < size; i++) {
-            Py_UCS4 ch = PyUnicode_READ(kind, data, i);
-            *p++ = (char) ch;
+        *psize = digits_to_decimal(pin, size_a, z);
+        if (*psize < 0) {
+            PyMem_Free(z);
+            return NULL;
         }
-        (*bytes_str) = p;
-        goto success;
+        return z;
     }
-    else {
-        *p_output = Py_NewRef(s);
-        goto success;
+
+    int k = 0;
+    while ((TO_DECIMAL_DC_LEAF << (k + 1)) < size_a) {
+        k++;
+    }
+    Py_ssize_t m = (Py_ssize_t)TO_DECIMAL_DC_LEAF << k;
+    pow = decimal_power(pows, k, &size_pow);
+    if (pow == NULL) {
+        return NULL;
+    }
+    hi = digits_to_decimal_dc(pin + m, size_a - m, pows, &size_hi);
+    if (hi == NULL) {
+        return NULL;
+    }
+    lo = digits_to_decimal_dc(pin, m, pows, &size_lo);
+    if (lo == NULL) {
+        PyMem_Free(hi);
+        return NULL;
+    }
+    if (size_hi == 0) {
+        PyMem_Free(hi);
+        *psize = size_lo;
+        return lo;
     }
 
-error:
-        Py_DECREF(mod);
-        Py_XDECREF(s);
-        return -1;
+    /* lo < BASE**m, so it has no more digits than pow. */
+    assert(size_lo <= size_pow);
+    size_z = size_hi + size_pow;
+    z = PyMem_New(digit, size_z);
+    if (z == NULL) {
+        PyErr_NoMemory();
+        goto error;
+    }
+    if (decimal_mul(hi, size_hi, pow, size_pow, z) < 0) {
+        PyMem_Free(z);
+        goto error;
+    }
+    digit carry = decimal_iadd(z, size_z, lo, size_lo);
+    assert(carry == 0);
+    (void)carry;
+    while (z[size_z - 1] == 0) {
+        size_z--;
+    }
+    PyMem_Free(hi);
+    PyMem_Free(lo);
+    *psize = size_z;
+    return z;
 
-success:
-        Py_DECREF(mod);
-        Py_DECREF(s);
-        return 0;
+  error:
+    PyMem_Free(hi);
+    PyMem_Free(lo);
+    return NULL;
 }
-#endif /* WITH_PYLONG_MODULE */
 
 /* Convert an integer to a base 10 string.  Returns a new non-shared
    string.  (Return value is non-shared so that callers can modify the
@@ -2117,7 +2356,6 @@ long_to_decimal_string_internal(PyObject *aa,
     Py_ssize_t size, strlen, size_a, i, j;
     digit *pout, *pin, rem, tenpow;
     int negative;
-    int d;
 
     // writer or bytes_writer can be used, but not both at the same time.
     assert(writer == NULL || bytes_writer == NULL);
@@ -2147,62 +2385,35 @@ long_to_decimal_string_internal(PyObject *aa,
         }
     }
 
-#if WITH_PYLONG_MODULE
-    if (size_a > 1000) {
-        /* Switch to _pylong.int_to_decimal_string(). */
-        return pylong_int_to_decimal_string(aa,
-                                         p_output,
-                                         writer,
-                                         bytes_writer,
-                                         bytes_str);
-    }
-#endif
-
-    /* quick and dirty upper bound for the number of digits
-       required to express a in base _PyLong_DECIMAL_BASE:
-
-         #digits = 1 + floor(log2(a) / log2(_PyLong_DECIMAL_BASE))
-
-       But log2(a) < size_a * PyLong_SHIFT, and
-       log2(_PyLong_DECIMAL_BASE) = log2(10) * _PyLong_DECIMAL_SHIFT
-                                  > 3.3 * _PyLong_DECIMAL_SHIFT
-
-         size_a * PyLong_SHIFT / (3.3 * _PyLong_DECIMAL_SHIFT) =
-             size_a + size_a / d < size_a + size_a / floor(d),
-       where d = (3.3 * _PyLong_DECIMAL_SHIFT) /
-                 (PyLong_SHIFT - 3.3 * _PyLong_DECIMAL_SHIFT)
-    */
-    d = (33 * _PyLong_DECIMAL_SHIFT) /
-        (10 * PyLong_SHIFT - 33 * _PyLong_DECIMAL_SHIFT);
-    assert(size_a < PY_SSIZE_T_MAX/2);
-    size = 1 + size_a + size_a / d;
-    scratch = _PyLong_New(size);
-    if (scratch == NULL)
-        return -1;
-
-    /* convert array of base _PyLong_BASE digits in pin to an array of
-       base _PyLong_DECIMAL_BASE digits in pout, following Knuth (TAOCP,
-       Volume 2 (3rd edn), section 4.4, Method 1b). */
     pin = a->long_value.ob_digit;
-    pout = scratch->long_value.ob_digit;
-    size = 0;
-    for (i = size_a; --i >= 0; ) {
-        digit hi = pin[i];
-        for (j = 0; j < size; j++) {
-            twodigits z = (twodigits)pout[j] << PyLong_SHIFT | hi;
-            hi = (digit)(z / _PyLong_DECIMAL_BASE);
-            pout[j] = (digit)(z - (twodigits)hi *
-                              _PyLong_DECIMAL_BASE);
+    if (size_a > TO_DECIMAL_DC_CUTOFF) {
+        decimal_powers pows = {{NULL}};
+        digit *dec = digits_to_decimal_dc(pin, size_a, &pows, &size);
+        for (i = 0; i < (Py_ssize_t)Py_ARRAY_LENGTH(pows.digits); i++) {
+            PyMem_Free(pows.digits[i]);
         }
-        while (hi) {
-            pout[size++] = hi % _PyLong_DECIMAL_BASE;
-            hi /= _PyLong_DECIMAL_BASE;
+        if (dec == NULL) {
+            return -1;
+        }
+        scratch = _PyLong_New(size);
+        if (scratch == NULL) {
+            PyMem_Free(dec);
+            return -1;
+        }
+        pout = scratch->long_value.ob_digit;
+        memcpy(pout, dec, size * sizeof(digit));
+        PyMem_Free(dec);
+    }
+    else {
+        scratch = _PyLong_New(decimal_size_bound(size_a));
+        if (scratch == NULL)
+            return -1;
+        pout = scratch->long_value.ob_digit;
+        size = digits_to_decimal(pin, size_a, pout);
+        if (size < 0) {
+            Py_DECREF(scratch);
+            return -1;
         }
-        /* check for keyboard interrupt */
-        SIGCHECK({
-                Py_DECREF(scratch);
-                return -1;
-            });
     }
     /* pout should have at least one digit, so that the case when a = 0
        works correctly */
@@ -2659,40 +2870,6 @@ long_from_binary_base(const char *start, const char *end, Py_ssize_t digits, int
     return 0;
 }
 
-#ifdef WITH_PYLONG_MODULE
-/* asymptotically faster str-to-long conversion for base 10, using _pylong.py */
-static int
-pylong_int_from_string(const char *start, const char *end, PyLongObject **res)
-{
-    PyObject *mod = PyImport_ImportModule("_pylong");
-    if (mod == NULL) {
-        goto error;
-    }
-    PyObject *s = PyUnicode_FromStringAndSize(start, end-start);
-    if (s == NULL) {
-        Py_DECREF(mod);
-        goto error;
-    }
-    PyObject *result = PyObject_CallMethod(mod, "int_from_string", "O", s);
-    Py_DECREF(s);
-    Py_DECREF(mod);
-    if (result == NULL) {
-        goto error;
-    }
-    if (!PyLong_Check(result)) {
-        Py_DECREF(result);
-        PyErr_SetString(PyExc_TypeError,
-                        "_pylong.int_from_string did not return an int");
-        goto error;
-    }
-    *res = (PyLongObject *)result;
-    return 0;
-error:
-    *res = NULL;
-    return 0;  // See the long_from_string_base() API comment.
-}
-#endif /* WITH_PYLONG_MODULE */
-
 /***
 long_from_non_binary_base: parameters and return values are the same as
 long_from_binary_base.
@@ -2915,6 +3092,160 @@ long_from_non_binary_base(const char *start, const char *end, Py_ssize_t digits,
     return 0;
 }
 
+/* Conversion from decimal of strings of more than FROM_DECIMAL_DC_CUTOFF
+   digits is done by divide and conquer, like the conversion to decimal:  the
+   digits are first gathered in base _PyLong_DECIMAL_BASE, then splitting
+   them as hi * _PyLong_DECIMAL_BASE**m + lo, the int is hi times the cached
+   power _PyLong_DECIMAL_BASE**m, plus lo, with m = FROM_DECIMAL_DC_LEAF * 2**k.
+   The multiplications use k_mul(), so the NTT for big ints.
+*/
+#define FROM_DECIMAL_DC_CUTOFF 5000
+#define FROM_DECIMAL_DC_LEAF 100
+
+/* Return a new int with the value of the base _PyLong_DECIMAL_BASE digits
+   dec[0:size], or NULL with an exception set. */
+static PyLongObject *
+digits_from_decimal(const digit *dec, Py_ssize_t size)
+{
+    Py_ssize_t size_z = 0, i, j;
+
+    /* _PyLong_DECIMAL_BASE < PyLong_BASE, so size digits are enough. */
+    PyLongObject *z = _PyLong_New(size);
+    if (z == NULL) {
+        return NULL;
+    }
+    digit *pz = z->long_value.ob_digit;
+    for (i = size; --i >= 0; ) {
+        twodigits c = dec[i];
+        for (j = 0; j < size_z; j++) {
+            c += (twodigits)pz[j] * _PyLong_DECIMAL_BASE;
+            pz[j] = (digit)(c & PyLong_MASK);
+            c >>= PyLong_SHIFT;
+        }
+        if (c) {
+            assert(size_z < size);
+            pz[size_z++] = (digit)c;
+        }
+    }
+    _PyLong_SetSignAndDigitCount(z, size_z != 0, size_z);
+    return z;
+}
+
+/* Return _PyLong_DECIMAL_BASE**(FROM_DECIMAL_DC_LEAF << k), computed once
+   in pows[k], as a borrowed reference, or NULL with an exception set. */
+static PyLongObject *
+decimal_base_power(PyLongObject **pows, int k)
+{
+    if (pows[k] == NULL) {
+        if (k == 0) {
+            digit *one = PyMem_New(digit, FROM_DECIMAL_DC_LEAF + 1);
+            if (one == NULL) {
+                PyErr_NoMemory();
+                return NULL;
+            }
+            memset(one, 0, FROM_DECIMAL_DC_LEAF * sizeof(digit));
+            one[FROM_DECIMAL_DC_LEAF] = 1;
+            pows[0] = digits_from_decimal(one, FROM_DECIMAL_DC_LEAF + 1);
+            PyMem_Free(one);
+        }
+        else {
+            PyLongObject *half = decimal_base_power(pows, k - 1);
+            if (half == NULL) {
+                return NULL;
+            }
+            pows[k] = k_mul(half, half);
+        }
+    }
+    return pows[k];
+}
+
+/* Return a new int with the value of the base _PyLong_DECIMAL_BASE digits
+   dec[0:size], by divide and conquer, or NULL with an exception set. */
+static PyLongObject *
+digits_from_decimal_dc(const digit *dec, Py_ssize_t size, PyLongObject **pows)
+{
+    if (size <= FROM_DECIMAL_DC_LEAF) {
+        return digits_from_decimal(dec, size);
+    }
+    SIGCHECK({
+            return NULL;
+        });
+
+    int k = 0;
+    while ((FROM_DECIMAL_DC_LEAF << (k + 1)) < size) {
+        k++;
+    }
+    Py_ssize_t m = (Py_ssize_t)FROM_DECIMAL_DC_LEAF << k;
+    PyLongObject *pow = decimal_base_power(pows, k);
+    if (pow == NULL) {
+        return NULL;
+    }
+    PyLongObject *hi = digits_from_decimal_dc(dec + m, size - m, pows);
+    if (hi == NULL) {
+        return NULL;
+    }
+    PyLongObject *z = k_mul(hi, pow);
+    Py_DECREF(hi);
+    if (z == NULL) {
+        return NULL;
+    }
+    PyLongObject *lo = digits_from_decimal_dc(dec, m, pows);
+    if (lo == NULL) {
+        Py_DECREF(z);
+        return NULL;
+    }
+    Py_SETREF(z, x_add(z, lo));
+    Py_DECREF(lo);
+    return z;
+}
+
+/* Convert the validated base 10 string [start, end), which has `digits`
+   digits and maybe underscores, by divide and conquer.  Parameters and
+   return values are the same as long_from_binary_base. */
+static int
+long_from_decimal_dc(const char *start, const char *end, Py_ssize_t digits,
+                     PyLongObject **res)
+{
+    Py_ssize_t size = (digits - 1) / _PyLong_DECIMAL_SHIFT + 1;
+    Py_ssize_t i;
+    const char *p = end;
+
+    *res = NULL;
+    if ((double)digits * (log(10.0) / log((double)PyLong_BASE))
+        > (double)MAX_LONG_DIGITS)
+    {
+        /* The same exception as in _PyLong_New(). */
+        PyErr_SetString(PyExc_OverflowError,
+                        "too many digits in integer");
+        return 0;
+    }
+    digit *dec = PyMem_New(digit, size);
+    if (dec == NULL) {
+        PyErr_NoMemory();
+        return 0;
+    }
+    for (i = 0; i < size; i++) {
+        digit d = 0, scale = 1;
+        for (int j = 0; j < _PyLong_DECIMAL_SHIFT && p > start; ) {
+            char c = *--p;
+            if (c != '_') {
+                d += (digit)(c - '0') * scale;
+                scale *= 10;
+                j++;
+            }
+        }
+        dec[i] = d;
+    }
+
+    PyLongObject *pows[64] = {NULL};
+    *res = digits_from_decimal_dc(dec, size, pows);
+    for (i = 0; i < (Py_ssize_t)Py_ARRAY_LENGTH(pows); i++) {
+        Py_XDECREF(pows[i]);
+    }
+    PyMem_Free(dec);
+    return 0;
+}
+
 /* *str points to the first digit in a string of base `base` digits. base is an
  * integer from 2 to 36 inclusive. Here we don't need to worry about prefixes
  * like 0x or leading +- signs. The string should be null terminated consisting
@@ -2923,13 +3254,14 @@ long_from_non_binary_base(const char *start, const char *end, Py_ssize_t digits,
  *
  * If base is a power of 2 then the complexity is linear in the number of
  * characters in the string. Otherwise a quadratic algorithm is used for
- * non-binary bases.
+ * non-binary bases, except for long decimal strings, which are converted by
+ * divide and conquer in long_from_decimal_dc().
  *
  * Return values:
  *
  *   - Returns -1 on syntax error (exception needs to be set, *res is untouched)
  *   - Returns 0 and sets *res to NULL for MemoryError, OverflowError, or
- *     _pylong.int_from_string() errors.
+ *     KeyboardInterrupt errors.
  *   - Returns 0 and sets *res to an unsigned, unnormalized PyLong (success!).
  *
  * Afterwards *str is set to point to the first non-digit (which may be *str!).
@@ -3008,12 +3340,10 @@ long_from_string_base(const char **str, int base, PyLongObject **res)
                 return 0;
             }
         }
-#if WITH_PYLONG_MODULE
-        if (digits > 6000 && base == 10) {
-            /* Switch to _pylong.int_from_string() */
-            return pylong_int_from_string(start, end, res);
+        if (digits > FROM_DECIMAL_DC_CUTOFF && base == 10) {
+            /* Use divide and conquer for big decimal strings. */
+            return long_from_decimal_dc(start, end, digits, res);
         }
-#endif
         /* Use the quadratic algorithm for non binary bases. */
         return long_from_non_binary_base(start, end, digits, base, res);
     }
@@ -3223,7 +3553,12 @@ long_divrem(PyLongObject *a, PyLongObject *b,
         }
     }
     else {
-        z = x_divrem(a, b, prem);
+        if (size_b >= BZ_DIV_CUTOFF && size_a - size_b >= BZ_DIV_CUTOFF) {
+            z = bz_divrem(a, b, prem);
+        }
+        else {
+            z = x_divrem(a, b, prem);
+        }
         *prem = maybe_small_long(*prem);
         if (z == NULL)
             return -1;
@@ -3277,7 +3612,12 @@ long_rem(PyLongObject *a, PyLongObject *b, PyLongObject **prem)
     }
     else {
         /* Slow path using divrem. */
-        Py_XDECREF(x_divrem(a, b, prem));
+        if (size_b >= BZ_DIV_CUTOFF && size_a - size_b >= BZ_DIV_CUTOFF) {
+            Py_XDECREF(bz_divrem(a, b, prem));
+        }
+        else {
+            Py_XDECREF(x_divrem(a, b, prem));
+        }
         *prem = maybe_small_long(*prem);
         if (*prem == NULL)
             return -1;
@@ -3427,6 +3767,359 @@ x_divrem(PyLongObject *v1, PyLongObject *w1, PyLongObject **prem)
     return long_normalize(a);
 }
 
+/* Division of big ints by Burnikel and Ziegler's recursive method
+   ["Fast Recursive Division", MPI-I-98-1-022, 1998]:  splitting the
+   dividend and the divisor in halves, a division of 2n digits by n digits
+   takes two divisions of 3n/2 digits by n digits, each of which takes a
+   division of n digits by n/2 digits and a multiplication.  This takes
+   O(M(n) log(n)) time, for M(n) the time of a multiplication, against
+   O(n**2) for x_divrem().  The thresholds can be tuned with
+   Tools/scripts/divmod_threshold.py. */
+
+/* Return a new int with the digits |a|[lo:hi], or NULL on error.  Digits
+   past the end of a are zeros. */
+static PyLongObject *
+digits_slice(PyLongObject *a, Py_ssize_t lo, Py_ssize_t hi)
+{
+    hi = Py_MIN(hi, _PyLong_DigitCount(a));
+    if (lo >= hi) {
+        return (PyLongObject *)_PyLong_GetZero();
+    }
+    PyLongObject *z = _PyLong_New(hi - lo);
+    if (z == NULL) {
+        return NULL;
+    }
+    memcpy(z->long_value.ob_digit, a->long_value.ob_digit + lo,
+           (hi - lo) * sizeof(digit));
+    return long_normalize(z);
+}
+
+/* Return a new int |hi| * PyLong_BASE**n + |lo|, where |lo| < PyLong_BASE**n,
+   or NULL on error. */
+static PyLongObject *
+digits_join(PyLongObject *hi, PyLongObject *lo, Py_ssize_t n)
+{
+    Py_ssize_t size_hi = _PyLong_DigitCount(hi);
+    Py_ssize_t size_lo = _PyLong_DigitCount(lo);
+
+    assert(size_lo <= n);
+    if (size_hi == 0) {
+        return (PyLongObject *)long_long((PyObject *)lo);
+    }
+    PyLongObject *z = _PyLong_New(n + size_hi);
+    if (z == NULL) {
+        return NULL;
+    }
+    digit *pz = z->long_value.ob_digit;
+    memcpy(pz, lo->long_value.ob_digit, size_lo * sizeof(digit));
+    memset(pz + size_lo, 0, (n - size_lo) * sizeof(digit));
+    memcpy(pz + n, hi->long_value.ob_digit, size_hi * sizeof(digit));
+    return z;
+}
+
+static int bz_div2n1n(PyLongObject *a, PyLongObject *b, Py_ssize_t n,
+                      PyLongObject **pq, PyLongObject **pr);
+
+/* Divide a12 * PyLong_BASE**n + a3 by b = b1 * PyLong_BASE**n + b2, giving
+   a quotient of at most n digits.  All ints are nonnegative, with
+   a3, b2 < PyLong_BASE**n, a12 < b * PyLong_BASE**n and b1 normalized (its
+   top bit set).  Set *pq and *pr to new references and return 0, or return
+   -1 on error. */
+static int
+bz_div3n2n(PyLongObject *a12, PyLongObject *a3, PyLongObject *b,
+           PyLongObject *b1, PyLongObject *b2, Py_ssize_t n,
+           PyLongObject **pq, PyLongObject **pr)
+{
+    PyLongObject *q = NULL, *r = NULL, *t;
+    Py_ssize_t size_a12 = _PyLong_DigitCount(a12);
+    Py_ssize_t size_b1 = _PyLong_DigitCount(b1);
+
+    if (size_a12 - n == size_b1 &&
+        memcmp(a12->long_value.ob_digit + n, b1->long_value.ob_digit,
+               size_b1 * sizeof(digit)) == 0)
+    {
+        /* a12 // PyLong_BASE**n == b1:  estimate the quotient as
+           PyLong_BASE**n - 1, with remainder a12 - b1 * PyLong_BASE**n + b1. */
+        q = _PyLong_New(n);
+        if (q == NULL) {
+            return -1;
+        }
+        for (Py_ssize_t i = 0; i < n; i++) {
+            q->long_value.ob_digit[i] = PyLong_MASK;
+        }
+        t = digits_slice(a12, 0, n);
+        if (t == NULL) {
+            goto error;
+        }
+        r = x_add(t, b1);
+        Py_DECREF(t);
+        if (r == NULL) {
+            goto error;
+        }
+    }
+    else if (bz_div2n1n(a12, b1, n, &q, &r) < 0) {
+        return -1;
+    }
+
+    /* r = r * PyLong_BASE**n + a3 - q * b2, which can be off by a few b. */
+    t = digits_join(r, a3, n);
+    Py_SETREF(r, t);
+    if (r == NULL) {
+        goto error;
+    }
+    t = long_mul(q, b2);
+    if (t == NULL) {
+        goto error;
+    }
+    Py_SETREF(r, long_sub(r, t));
+    Py_DECREF(t);
+    if (r == NULL) {
+        goto error;
+    }
+    while (_PyLong_IsNegative(r)) {
+        Py_SETREF(q, long_sub(q, (PyLongObject *)_PyLong_GetOne()));
+        if (q == NULL) {
+            goto error;
+        }
+        Py_SETREF(r, long_add(r, b));
+        if (r == NULL) {
+            goto error;
+        }
+    }
+    *pq = q;
+    *pr = r;
+    return 0;
+
+  error:
+    Py_XDECREF(q);
+    Py_XDECREF(r);
+    return -1;
+}
+
+/* Divide a by b, giving a quotient of at most n digits.  Both ints are
+   nonnegative, with b of n digits and normalized, and
+   a < b * PyLong_BASE**n.  Set *pq and *pr to new references and return 0,
+   or return -1 on error. */
+static int
+bz_div2n1n(PyLongObject *a, PyLongObject *b, Py_ssize_t n,
+           PyLongObject **pq, PyLongObject **pr)
+{
+    PyLongObject *a12 = NULL, *a3 = NULL, *b1 = NULL, *b2 = NULL;
+    PyLongObject *q1 = NULL, *q2 = NULL, *r = NULL, *t;
+    PyLongObject *zero = (PyLongObject *)_PyLong_GetZero();
+    int result = -1;
+
+    if (n <= BZ_DIV_LIMIT) {
+        return long_divrem(a, b, pq, pr);
+    }
+    if (n & 1) {
+        /* Make the number of digits even, multiplying a and b by
+           PyLong_BASE.  That leaves the quotient unchanged and b
+           normalized. */
+        PyLongObject *a2 = digits_join(a, zero, 1);
+        if (a2 == NULL) {
+            return -1;
+        }
+        PyLongObject *b3 = digits_join(b, zero, 1);
+        if (b3 == NULL) {
+            Py_DECREF(a2);
+            return -1;
+        }
+        result = bz_div2n1n(a2, b3, n + 1, pq, &r);
+        Py_DECREF(a2);
+        Py_DECREF(b3);
+        if (result < 0) {
+            return -1;
+        }
+        *pr = digits_slice(r, 1, n + 2);
+        Py_DECREF(r);
+        if (*pr == NULL) {
+            Py_CLEAR(*pq);
+            return -1;
+        }
+        return 0;
+    }
+
+    Py_ssize_t half = n >> 1;
+    if ((b1 = digits_slice(b, half, n)) == NULL ||
+        (b2 = digits_slice(b, 0, half)) == NULL ||
+        (a12 = digits_slice(a, n, 2 * n)) == NULL ||
+        (a3 = digits_slice(a, half, n)) == NULL)
+    {
+        goto done;
+    }
+    if (bz_div3n2n(a12, a3, b, b1, b2, half, &q1, &r) < 0) {
+        goto done;
+    }
+    Py_SETREF(a3, digits_slice(a, 0, half));
+    if (a3 == NULL) {
+        goto done;
+    }
+    t = r;
+    r = NULL;
+    result = bz_div3n2n(t, a3, b, b1, b2, half, &q2, &r);
+    Py_DECREF(t);
+    if (result < 0) {
+        goto done;
+    }
+    result = -1;
+    t = digits_join(q1, q2, half);
+    if (t == NULL) {
+        goto done;
+    }
+    *pq = t;
+    *pr = (PyLongObject *)Py_NewRef(r);
+    result = 0;
+
+  done:
+    Py_XDECREF(a12);
+    Py_XDECREF(a3);
+    Py_XDECREF(b1);
+    Py_XDECREF(b2);
+    Py_XDECREF(q1);
+    Py_XDECREF(q2);
+    Py_XDECREF(r);
+    return result;
+}
+
+/* Unsigned int division with remainder by Burnikel and Ziegler's method,
+   with the same interface as x_divrem().  The arguments should satisfy
+   BZ_DIV_CUTOFF <= _PyLong_DigitCount(w1) <= _PyLong_DigitCount(v1). */
+static PyLongObject *
+bz_divrem(PyLongObject *v1, PyLongObject *w1, PyLongObject **prem)
+{
+    PyLongObject *v, *w, *q = NULL, *r = NULL, *t, *qi;
+    Py_ssize_t size_v = _PyLong_DigitCount(v1);
+    Py_ssize_t size_w = _PyLong_DigitCount(w1);
+    Py_ssize_t i, n;
+    int d;
+
+    /* The base cases must not come back here through long_divrem(). */
+    Py_BUILD_ASSERT(BZ_DIV_LIMIT < BZ_DIV_CUTOFF);
+    *prem = NULL;
+    /* normalize: shift w1 left so that its top digit is >= PyLong_BASE/2,
+       and v1 by the same amount, as in x_divrem(). */
+    assert(size_v >= size_w && size_w >= 2);
+    w = _PyLong_New(size_w);
+    if (w == NULL) {
+        return NULL;
+    }
+    v = _PyLong_New(size_v + 1);
+    if (v == NULL) {
+        Py_DECREF(w);
+        return NULL;
+    }
+    d = PyLong_SHIFT - bit_length_digit(w1->long_value.ob_digit[size_w-1]);
+    (void)v_lshift(w->long_value.ob_digit, w1->long_value.ob_digit, size_w, d);
+    v->long_value.ob_digit[size_v] =
+        v_lshift(v->long_value.ob_digit, v1->long_value.ob_digit, size_v, d);
+    v = long_normalize(v);
+    size_v = _PyLong_DigitCount(v);
+    n = size_w;
+
+    if (size_v - n < n) {
+        /* The quotient has fewer digits than the divisor:  dividing
+           the top digits of v by the top digits of w estimates it within
+           a few units, as w is normalized.  Then fix it up. */
+        Py_ssize_t s = 2 * n - size_v;
+        PyLongObject *vt = digits_slice(v, s, size_v);
+        PyLongObject *wt = vt ? digits_slice(w, s, n) : NULL;
+        if (wt == NULL || long_divrem(vt, wt, &q, &r) < 0) {
+            Py_XDECREF(vt);
+            Py_XDECREF(wt);
+            goto error;
+        }
+        Py_DECREF(vt);
+        Py_DECREF(wt);
+        Py_SETREF(r, long_mul(q, w));
+        if (r == NULL) {
+            goto error;
+        }
+        Py_SETREF(r, long_sub(v, r));
+        if (r == NULL) {
+            goto error;
+        }
+        while (_PyLong_IsNegative(r)) {
+            Py_SETREF(q, long_sub(q, (PyLongObject *)_PyLong_GetOne()));
+            if (q == NULL) {
+                goto error;
+            }
+            Py_SETREF(r, long_add(r, w));
+            if (r == NULL) {
+                goto error;
+            }
+        }
+        while (long_compare(r, w) >= 0) {
+            Py_SETREF(q, long_add(q, (PyLongObject *)_PyLong_GetOne()));
+            if (q == NULL) {
+                goto error;
+            }
+            Py_SETREF(r, x_sub(r, w));
+            if (r == NULL) {
+                goto error;
+            }
+        }
+    }
+    else {
+        /* Divide the blocks of n digits of v from the top, each time
+           prefixed by the remainder of the previous block, so that the
+           quotient blocks have n digits. */
+        Py_ssize_t nblocks = (size_v - 1) / n + 1;
+        q = _PyLong_New(nblocks * n);
+        if (q == NULL) {
+            goto error;
+        }
+        memset(q->long_value.ob_digit, 0, nblocks * n * sizeof(digit));
+        r = (PyLongObject *)_PyLong_GetZero();
+        for (i = nblocks; --i >= 0; ) {
+            t = digits_slice(v, i * n, (i + 1) * n);
+            if (t == NULL) {
+                goto error;
+            }
+            Py_SETREF(t, digits_join(r, t, n));
+            if (t == NULL) {
+                goto error;
+            }
+            Py_CLEAR(r);
+            if (long_compare(t, w) < 0) {
+                /* A zero quotient block, as usual at the top. */
+                r = t;
+                continue;
+            }
+            int res = bz_div2n1n(t, w, n, &qi, &r);
+            Py_DECREF(t);
+            if (res < 0) {
+                goto error;
+            }
+            assert(_PyLong_DigitCount(qi) <= n);
+            memcpy(q->long_value.ob_digit + i * n, qi->long_value.ob_digit,
+                   _PyLong_DigitCount(qi) * sizeof(digit));
+            Py_DECREF(qi);
+        }
+        q = long_normalize(q);
+    }
+
+    /* unshift remainder */
+    t = _PyLong_New(_PyLong_DigitCount(r));
+    if (t == NULL) {
+        goto error;
+    }
+    (void)v_rshift(t->long_value.ob_digit, r->long_value.ob_digit,
+                   _PyLong_DigitCount(r), d);
+    Py_DECREF(r);
+    Py_DECREF(v);
+    Py_DECREF(w);
+    *prem = long_normalize(t);
+    return q;
+
+  error:
+    Py_XDECREF(q);
+    Py_XDECREF(r);
+    Py_DECREF(v);
+    Py_DECREF(w);
+    return NULL;
+}
+
 /* For a nonzero PyLong a, express a in the form x * 2**e, with 0.5 <=
    abs(x) < 1.0 and e >= 0; return x and put e in *e.  Here x is
    rounded to DBL_MANT_DIG significant bits using round-half-to-even.
@@ -3611,6 +4304,17 @@ long_richcompare(PyObject *self, PyObject *other, int op)
     Py_RETURN_RICHCOMPARE(result, 0, op);
 }
 
+void
+_PyLong_ExactDealloc(PyObject *self)
+{
+    assert(PyLong_CheckExact(self));
+    if (_PyLong_IsCompact((PyLongObject *)self)) {
+        _Py_FREELIST_FREE(ints, self, PyObject_Free);
+        return;
+    }
+    PyObject_Free(self);
+}
+
 static void
 long_dealloc(PyObject *self)
 {
@@ -3629,6 +4333,10 @@ long_dealloc(PyObject *self)
             }
         }
     }
+    if (PyLong_CheckExact(self) && _PyLong_IsCompact(pylong)) {
+        _Py_FREELIST_FREE(ints, self, PyObject_Free);
+        return;
+    }
     Py_TYPE(self)->tp_free(self);
 }
 
@@ -4006,6 +4714,7 @@ kmul_split(PyLongObject *n,
 }
 
 static PyLongObject *k_lopsided_mul(PyLongObject *a, PyLongObject *b);
+static PyLongObject *ntt_mul(PyLongObject *a, PyLongObject *b);
 
 /* Karatsuba multiplication.  Ignores the input signs, and returns the
  * absolute value of the product (or NULL if error).
@@ -4055,6 +4764,12 @@ k_mul(PyLongObject *a, PyLongObject *b)
             return x_mul(a, b);
     }
 
+    /* For huge operands, the NTT is faster, whatever the size of b. */
+    i = a == b ? NTT_SQUARE_CUTOFF : NTT_CUTOFF;
+    if (asize >= i && asize + bsize <= NTT_MAX_SIZE) {
+        return ntt_mul(a, b);
+    }
+
     /* If a is small compared to b, splitting on b gives a degenerate
      * case with ah==0, and Karatsuba may be (even much) less efficient
      * than "grade school" then.  However, we can still win, by viewing
@@ -4285,6 +5000,243 @@ k_lopsided_mul(PyLongObject *a, PyLongObject *b)
 }
 
 
+/* Number-theoretic transform multiplication.
+ *
+ * The digits of a product are the convolution of the digits of the factors,
+ * with carries propagated.  ntt_mul_digits() computes that convolution in
+ * O(n log n) time with a number-theoretic transform (an FFT in the integers
+ * modulo a prime p = c*2**k + 1, which has 2**k-th roots of unity) modulo
+ * each of three primes.  Every term of the convolution is less than
+ * min(size_a, size_b) * base**2 < 2**84, while the product of the primes is
+ * about 2**90.5, so the Chinese remainder theorem gives the exact terms.
+ * This is the first algorithm of Schoenhage and Strassen, with the three
+ * primes in place of their single big modulus.
+ *
+ * The digits may be in any base up to PyLong_BASE, so that the decimal
+ * conversion can use it too.
+ */
+
+#define NTT_P0 2013265921u              /* 15 * 2**27 + 1, primitive root 31 */
+#define NTT_P1 469762049u               /* 7 * 2**26 + 1, primitive root 3 */
+#define NTT_P2 1811939329u              /* 27 * 2**26 + 1, primitive root 13 */
+
+static uint32_t
+ntt_pow(uint32_t x, uint32_t e, uint32_t p)
+{
+    uint64_t r = 1, b = x;
+    for (; e; e >>= 1) {
+        if (e & 1) {
+            r = r * b % p;
+        }
+        b = b * b % p;
+    }
+    return (uint32_t)r;
+}
+
+/* Return x*w % p, for x < 2*p, given wp = floor(w * 2**32 / p) (Shoup's
+   trick: the quotient estimate is off by at most one). */
+static inline uint32_t
+ntt_mulmod(uint32_t x, uint32_t w, uint32_t wp, uint32_t p)
+{
+    uint32_t q = (uint32_t)(((uint64_t)x * wp) >> 32);
+    uint32_t r = x * w - q * p;
+    return r >= p ? r - p : r;
+}
+
+/* Compute the convolution of the digits of a and b modulo p, of length n (a
+   power of 2 at least size_a + size_b - 1), into fa.  fb, roots and rootsp
+   are work arrays of n values.  The transforms use the roots of unity
+   roots[len + j] = w**j for j < len, where w is a primitive (2*len)-th root,
+   so that the table holds the roots of every level in n values.  This is
+   inlined into one function per prime, so that "% p" is a division by a
+   constant. */
+static inline Py_ALWAYS_INLINE void
+ntt_convolve(const digit *a, Py_ssize_t size_a,
+             const digit *b, Py_ssize_t size_b, Py_ssize_t n,
+             uint32_t *fa, uint32_t *fb, uint32_t *roots, uint32_t *rootsp,
+             const uint32_t p, const uint32_t g)
+{
+    Py_ssize_t len, i, j;
+
+    for (len = 1; len < n; len <<= 1) {
+        uint32_t w = ntt_pow(g, (p - 1) / (2 * (uint32_t)len), p);
+        uint64_t r = 1;
+        for (j = 0; j < len; j++) {
+            roots[len + j] = (uint32_t)r;
+            rootsp[len + j] = (uint32_t)((r << 32) / p);
+            r = r * w % p;
+        }
+    }
+
+    for (i = 0; i < size_a; i++) {
+        fa[i] = a[i] % p;
+    }
+    memset(fa + size_a, 0, (n - size_a) * sizeof(uint32_t));
+    if (b != NULL) {
+        for (i = 0; i < size_b; i++) {
+            fb[i] = b[i] % p;
+        }
+        memset(fb + size_b, 0, (n - size_b) * sizeof(uint32_t));
+    }
+
+    /* Forward transforms, by decimation in frequency: the natural order in,
+       and the bit-reversed order out. */
+    for (int k = 0; k < (b != NULL ? 2 : 1); k++) {
+        uint32_t *f = k ? fb : fa;
+        for (len = n >> 1; len >= 1; len >>= 1) {
+            for (i = 0; i < n; i += 2 * len) {
+                uint32_t *f0 = f + i, *f1 = f + i + len;
+                for (j = 0; j < len; j++) {
+                    uint32_t u = f0[j], v = f1[j];
+                    uint32_t s = u + v;
+                    f0[j] = s >= p ? s - p : s;
+                    f1[j] = ntt_mulmod(u + p - v, roots[len + j],
+                                       rootsp[len + j], p);
+                }
+            }
+        }
+    }
+
+    /* Pointwise products, scaled by 1/n for the inverse transform. */
+    uint32_t ninv = ntt_pow((uint32_t)n, p - 2, p);
+    uint32_t ninvp = (uint32_t)(((uint64_t)ninv << 32) / p);
+    const uint32_t *fc = b != NULL ? fb : fa;
+    for (i = 0; i < n; i++) {
+        uint32_t x = (uint32_t)((uint64_t)fa[i] * fc[i] % p);
+        fa[i] = ntt_mulmod(x, ninv, ninvp, p);
+    }
+
+    /* Inverse transform, by decimation in time: the bit-reversed order in,
+       and the natural order out.  It needs w**-j, which is -w**(len-j). */
+    for (len = 1; len < n; len <<= 1) {
+        for (i = 0; i < n; i += 2 * len) {
+            uint32_t *f0 = fa + i, *f1 = fa + i + len;
+            uint32_t u = f0[0], v = f1[0];
+            uint32_t s = u + v;
+            f0[0] = s >= p ? s - p : s;
+            f1[0] = u >= v ? u - v : u + p - v;
+            for (j = 1; j < len; j++) {
+                u = f0[j];
+                v = ntt_mulmod(f1[j], roots[2 * len - j],
+                               rootsp[2 * len - j], p);
+                s = u + v;
+                f0[j] = u >= v ? u - v : u + p - v;
+                f1[j] = s >= p ? s - p : s;
+            }
+        }
+    }
+}
+
+static void
+ntt_convolve_p0(const digit *a, Py_ssize_t size_a,
+                const digit *b, Py_ssize_t size_b, Py_ssize_t n,
+                uint32_t *fa, uint32_t *fb, uint32_t *roots, uint32_t *rootsp)
+{
+    ntt_convolve(a, size_a, b, size_b, n, fa, fb, roots, rootsp, NTT_P0, 31);
+}
+
+static void
+ntt_convolve_p1(const digit *a, Py_ssize_t size_a,
+                const digit *b, Py_ssize_t size_b, Py_ssize_t n,
+                uint32_t *fa, uint32_t *fb, uint32_t *roots, uint32_t *rootsp)
+{
+    ntt_convolve(a, size_a, b, size_b, n, fa, fb, roots, rootsp, NTT_P1, 3);
+}
+
+static void
+ntt_convolve_p2(const digit *a, Py_ssize_t size_a,
+                const digit *b, Py_ssize_t size_b, Py_ssize_t n,
+                uint32_t *fa, uint32_t *fb, uint32_t *roots, uint32_t *rootsp)
+{
+    ntt_convolve(a, size_a, b, size_b, n, fa, fb, roots, rootsp, NTT_P2, 13);
+}
+
+/* Multiply the digits a[0:size_a] and b[0:size_b], in base `base`, into
+   z[0:size_a+size_b].  a and b may be the same array, for squaring.
+   size_a + size_b must be at most NTT_MAX_SIZE.  Return 0 on success, or -1
+   with MemoryError set. */
+static int
+ntt_mul_digits(const digit *a, Py_ssize_t size_a,
+               const digit *b, Py_ssize_t size_b,
+               digit *z, twodigits base)
+{
+    Py_ssize_t size_z = size_a + size_b;
+    Py_ssize_t n = 1, i;
+
+    assert(size_a > 0 && size_b > 0);
+    assert(size_z <= NTT_MAX_SIZE);
+    assert(base <= PyLong_BASE);
+    while (n < size_z - 1) {
+        n <<= 1;
+    }
+    uint32_t *work = PyMem_New(uint32_t, 6 * n);
+    if (work == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    uint32_t *r0 = work, *r1 = work + n, *fa = work + 2 * n;
+    uint32_t *fb = work + 3 * n, *roots = work + 4 * n, *rootsp = work + 5 * n;
+    const digit *bb = (a == b && size_a == size_b) ? NULL : b;
+
+    ntt_convolve_p0(a, size_a, bb, size_b, n, fa, fb, roots, rootsp);
+    memcpy(r0, fa, n * sizeof(uint32_t));
+    ntt_convolve_p1(a, size_a, bb, size_b, n, fa, fb, roots, rootsp);
+    memcpy(r1, fa, n * sizeof(uint32_t));
+    ntt_convolve_p2(a, size_a, bb, size_b, n, fa, fb, roots, rootsp);
+
+    /* Combine the residues (Garner's algorithm) into
+       x = x01 + P0*P1*t2, with x01 = r0 + P0*t1 < P0*P1 < 2**61, and
+       propagate the carries.  x + carry is held as hi * 2**32 + lo. */
+    const uint64_t p01 = (uint64_t)NTT_P0 * NTT_P1;
+    const uint32_t inv0 = ntt_pow(NTT_P0 % NTT_P1, NTT_P1 - 2, NTT_P1);
+    const uint32_t inv01 = ntt_pow((uint32_t)(p01 % NTT_P2), NTT_P2 - 2,
+                                   NTT_P2);
+    uint64_t carry = 0;
+    for (i = 0; i < size_z - 1; i++) {
+        uint32_t x0 = r0[i], x1 = r1[i], x2 = fa[i];
+        uint32_t t1 = (uint32_t)((uint64_t)(x1 + NTT_P1 - x0 % NTT_P1)
+                                 * inv0 % NTT_P1);
+        uint64_t x01 = x0 + (uint64_t)NTT_P0 * t1;
+        uint32_t t2 = (uint32_t)((uint64_t)(x2 + NTT_P2
+                                            - (uint32_t)(x01 % NTT_P2))
+                                 * inv01 % NTT_P2);
+        uint64_t lo = (p01 & 0xFFFFFFFFu) * t2 + x01;
+        uint64_t hi = (p01 >> 32) * t2;
+        uint64_t w0 = (lo & 0xFFFFFFFFu) + (carry & 0xFFFFFFFFu);
+        uint64_t w1 = (lo >> 32) + (carry >> 32) + hi + (w0 >> 32);
+        w0 = (w1 % base) << 32 | (w0 & 0xFFFFFFFFu);
+        z[i] = (digit)(w0 % base);
+        carry = (w1 / base) << 32 | (w0 / base);
+    }
+    assert(carry < base);
+    z[size_z - 1] = (digit)carry;
+    PyMem_Free(work);
+    return 0;
+}
+
+/* NTT multiplication of two ints of at least NTT_CUTOFF digits.  Ignores
+ * the input signs, and returns the absolute value of the product (or NULL
+ * if error).
+ */
+static PyLongObject *
+ntt_mul(PyLongObject *a, PyLongObject *b)
+{
+    Py_ssize_t size_a = _PyLong_DigitCount(a);
+    Py_ssize_t size_b = _PyLong_DigitCount(b);
+    PyLongObject *z = _PyLong_New(size_a + size_b);
+    if (z == NULL) {
+        return NULL;
+    }
+    if (ntt_mul_digits(a->long_value.ob_digit, size_a,
+                       b->long_value.ob_digit, size_b,
+                       z->long_value.ob_digit, PyLong_BASE) < 0) {
+        Py_DECREF(z);
+        return NULL;
+    }
+    return long_normalize(z);
+}
+
+
 static PyLongObject*
 long_mul(PyLongObject *a, PyLongObject *b)
 {
@@ -4359,46 +5311,6 @@ fast_floor_div(PyLongObject *a, PyLongObject *b)
     return PyLong_FromLong(div);
 }
 
-#ifdef WITH_PYLONG_MODULE
-/* asymptotically faster divmod, using _pylong.py */
-static int
-pylong_int_divmod(PyLongObject *v, PyLongObject *w,
-                  PyLongObject **pdiv, PyLongObject **pmod)
-{
-    PyObject *mod = PyImport_ImportModule("_pylong");
-    if (mod == NULL) {
-        return -1;
-    }
-    PyObject *result = PyObject_CallMethod(mod, "int_divmod", "OO", v, w);
-    Py_DECREF(mod);
-    if (result == NULL) {
-        return -1;
-    }
-    if (!PyTuple_Check(result)) {
-        Py_DECREF(result);
-        PyErr_SetString(PyExc_ValueError,
-                        "tuple is required from int_divmod()");
-        return -1;
-    }
-    PyObject *q = PyTuple_GET_ITEM(result, 0);
-    PyObject *r = PyTuple_GET_ITEM(result, 1);
-    if (!PyLong_Check(q) || !PyLong_Check(r)) {
-        Py_DECREF(result);
-        PyErr_SetString(PyExc_ValueError,
-                        "tuple of int is required from int_divmod()");
-        return -1;
-    }
-    if (pdiv != NULL) {
-        *pdiv = (PyLongObject *)Py_NewRef(q);
-    }
-    if (pmod != NULL) {
-        *pmod = (PyLongObject *)Py_NewRef(r);
-    }
-    Py_DECREF(result);
-    return 0;
-}
-#endif /* WITH_PYLONG_MODULE */
-
 /* The / and % operators are now defined in terms of divmod().
    The expression a mod b has the value a - b*floor(a/b).
    The long_divrem function gives the remainder after division of
@@ -4450,18 +5362,6 @@ l_divmod(PyLongObject *v, PyLongObject *w,
         }
         return 0;
     }
-#if WITH_PYLONG_MODULE
-    Py_ssize_t size_v = _PyLong_DigitCount(v); /* digits in numerator */
-    Py_ssize_t size_w = _PyLong_DigitCount(w); /* digits in denominator */
-    if (size_w > 300 && (size_v - size_w) > 150) {
-        /* Switch to _pylong.int_divmod().  If the quotient is small then
-          "schoolbook" division is linear-time so don't use in that case.
-          These limits are empirically determined and should be slightly
-          conservative so that _pylong is used in cases it is likely
-          to be faster. See Tools/scripts/divmod_threshold.py. */
-        return pylong_int_divmod(v, w, pdiv, pmod);
-    }
-#endif
     if (long_divrem(v, w, &div, &mod) < 0)
         return -1;
     if ((_PyLong_IsNegative(mod) && _PyLong_IsPositive(w)) ||
@@ -27,6 +27,7 @@
 #include "pycore_typeobject.h"    // _PyBufferWrapper_Type
 #include "pycore_typevarobject.h" // _PyTypeAlias_Type, _Py_initialize_generic
 #include "pycore_unionobject.h"   // _PyUnion_Type
+#include "pycore_unicodeobject.h" // _PyUnicode_InternImmortal()
 
 
 #ifdef Py_LIMITED_API
@@ -859,6 +860,69 @@ PyObject_Bytes(PyObject *v)
     return PyBytes_FromObject(v);
 }
 
+static void
+free_object(void *obj)
+{
+    PyObject *op = (PyObject *)obj;
+    PyTypeObject *tp = Py_TYPE(op);
+    tp->tp_free(op);
+    Py_DECREF(tp);
+}
+
+/* The kinds of freelists of struct _Py_freelists, by the name used by
+   sys._set_freelist_limit().  A kind can cover several freelists sharing a
+   limit, like the freelists of tuples of each size. */
+typedef struct {
+    const char *name;
+    size_t offset;              // of the first freelist
+    Py_ssize_t count;           // number of freelists
+    Py_ssize_t default_limit;
+    freefunc dofree;
+    int keep_on_collect;        // only cleared at finalization
+} freelist_kind;
+
+#define FREELIST_KIND(NAME, DOFREE) \
+    {#NAME, offsetof(struct _Py_freelists, NAME), 1, \
+     Py_ ## NAME ## _MAXFREELIST, DOFREE, 0}
+
+static const freelist_kind freelist_kinds[] = {
+    FREELIST_KIND(floats, free_object),
+    {"tuples", offsetof(struct _Py_freelists, tuples), PyTuple_MAXSAVESIZE,
+     Py_tuple_MAXFREELIST, free_object, 0},
+    FREELIST_KIND(lists, free_object),
+    FREELIST_KIND(dicts, free_object),
+    FREELIST_KIND(dictkeys, PyMem_Free),
+    FREELIST_KIND(slices, free_object),
+    FREELIST_KIND(contexts, free_object),
+    FREELIST_KIND(async_gens, free_object),
+    FREELIST_KIND(async_gen_asends, free_object),
+    FREELIST_KIND(futureiters, free_object),
+    // We use object stacks during GC, so emptying the free-list is
+    // counterproductive.
+    {"object_stack_chunks", offsetof(struct _Py_freelists, object_stack_chunks),
+     1, Py_object_stack_chunks_MAXFREELIST, PyMem_RawFree, 1},
+    FREELIST_KIND(unicode_writers, PyMem_Free),
+    FREELIST_KIND(ints, free_object),
+    FREELIST_KIND(methods, free_object),
+    {"frames", offsetof(struct _Py_freelists, frames), Py_FRAME_FREELIST_CLASSES,
+     Py_frames_MAXFREELIST, free_object, 0},
+    FREELIST_KIND(cells, free_object),
+    {"bytes", offsetof(struct _Py_freelists, bytes), PyBytes_MAXSAVESIZE,
+     Py_bytes_MAXFREELIST, free_object, 0},
+};
+
+#undef FREELIST_KIND
+
+#define NUM_FREELIST_KINDS Py_ARRAY_LENGTH(freelist_kinds)
+
+static struct _Py_freelist *
+get_freelist(struct _Py_freelists *freelists, const freelist_kind *kind,
+             Py_ssize_t i)
+{
+    assert(0 <= i && i < kind->count);
+    return (struct _Py_freelist *)((char *)freelists + kind->offset) + i;
+}
+
 static void
 clear_freelist(struct _Py_freelist *freelist, int is_finalization,
                freefunc dofree)
@@ -874,40 +938,181 @@ clear_freelist(struct _Py_freelist *freelist, int is_finalization,
     }
 }
 
-static void
-free_object(void *obj)
-{
-    PyObject *op = (PyObject *)obj;
-    PyTypeObject *tp = Py_TYPE(op);
-    tp->tp_free(op);
-    Py_DECREF(tp);
-}
-
 void
 _PyObject_ClearFreeLists(struct _Py_freelists *freelists, int is_finalization)
 {
     // In the free-threaded build, freelists are per-PyThreadState and cleared in PyThreadState_Clear()
     // In the default build, freelists are per-interpreter and cleared in finalize_interp_types()
-    clear_freelist(&freelists->floats, is_finalization, free_object);
-    for (Py_ssize_t i = 0; i < PyTuple_MAXSAVESIZE; i++) {
-        clear_freelist(&freelists->tuples[i], is_finalization, free_object);
-    }
-    clear_freelist(&freelists->lists, is_finalization, free_object);
-    clear_freelist(&freelists->dicts, is_finalization, free_object);
-    clear_freelist(&freelists->dictkeys, is_finalization, PyMem_Free);
-    clear_freelist(&freelists->slices, is_finalization, free_object);
-    clear_freelist(&freelists->contexts, is_finalization, free_object);
-    clear_freelist(&freelists->async_gens, is_finalization, free_object);
-    clear_freelist(&freelists->async_gen_asends, is_finalization, free_object);
-    clear_freelist(&freelists->futureiters, is_finalization, free_object);
-    if (is_finalization) {
-        // Only clear object stack chunks during finalization. We use object
-        // stacks during GC, so emptying the free-list is counterproductive.
-        clear_freelist(&freelists->object_stack_chunks, 1, PyMem_RawFree);
+    for (size_t k = 0; k < NUM_FREELIST_KINDS; k++) {
+        const freelist_kind *kind = &freelist_kinds[k];
+        if (kind->keep_on_collect && !is_finalization) {
+            continue;
+        }
+        for (Py_ssize_t i = 0; i < kind->count; i++) {
+            clear_freelist(get_freelist(freelists, kind, i), is_finalization,
+                           kind->dofree);
+        }
+    }
+}
+
+void
+_PyObject_InitFreeLists(struct _Py_freelists *freelists,
+                        const struct _Py_freelists *limits)
+{
+    for (size_t k = 0; k < NUM_FREELIST_KINDS; k++) {
+        const freelist_kind *kind = &freelist_kinds[k];
+        for (Py_ssize_t i = 0; i < kind->count; i++) {
+            Py_ssize_t limit = kind->default_limit;
+            if (limits != NULL) {
+                limit = get_freelist((struct _Py_freelists *)limits,
+                                     kind, i)->maxsize;
+            }
+            get_freelist(freelists, kind, i)->maxsize = limit;
+        }
+    }
+}
+
+void
+_PyObject_MergeFreeListStats(PyInterpreterState *interp,
+                             struct _Py_freelists *freelists)
+{
+    struct _Py_freelists *totals = &interp->object_state.freelists;
+    assert(freelists != totals);
+    for (size_t k = 0; k < NUM_FREELIST_KINDS; k++) {
+        const freelist_kind *kind = &freelist_kinds[k];
+        for (Py_ssize_t i = 0; i < kind->count; i++) {
+            struct _Py_freelist *src = get_freelist(freelists, kind, i);
+            struct _Py_freelist *dst = get_freelist(totals, kind, i);
+            _Py_atomic_add_ssize(&dst->hits, src->hits);
+            _Py_atomic_add_ssize(&dst->misses, src->misses);
+            _Py_atomic_add_ssize(&dst->overflows, src->overflows);
+            src->hits = src->misses = src->overflows = 0;
+        }
+    }
+}
+
+static void
+set_freelist_limit(struct _Py_freelists *freelists, const freelist_kind *kind,
+                   Py_ssize_t limit)
+{
+    for (Py_ssize_t i = 0; i < kind->count; i++) {
+        struct _Py_freelist *fl = get_freelist(freelists, kind, i);
+        fl->maxsize = limit;
+        while (fl->size > limit) {
+            kind->dofree(_PyFreeList_PopNoStats(fl));
+        }
+    }
+}
+
+int
+_PyObject_SetFreeListLimit(PyInterpreterState *interp, const char *name,
+                           Py_ssize_t limit)
+{
+    const freelist_kind *kind = NULL;
+    for (size_t k = 0; k < NUM_FREELIST_KINDS; k++) {
+        if (strcmp(freelist_kinds[k].name, name) == 0) {
+            kind = &freelist_kinds[k];
+            break;
+        }
+    }
+    if (kind == NULL) {
+        PyErr_Format(PyExc_ValueError, "unknown freelist: '%s'", name);
+        return -1;
+    }
+    if (limit < 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "freelist limit must be non-negative");
+        return -1;
+    }
+
+#ifdef Py_GIL_DISABLED
+    // The freelists of the other threads can only be changed while they are
+    // stopped.  New threads copy the limits of the interpreter.
+    _PyEval_StopTheWorld(interp);
+    HEAD_LOCK(&_PyRuntime);
+    set_freelist_limit(&interp->object_state.freelists, kind, limit);
+    for (PyThreadState *p = interp->threads.head; p != NULL; p = p->next) {
+        set_freelist_limit(&((_PyThreadStateImpl *)p)->freelists, kind, limit);
+    }
+    HEAD_UNLOCK(&_PyRuntime);
+    _PyEval_StartTheWorld(interp);
+#else
+    set_freelist_limit(&interp->object_state.freelists, kind, limit);
+#endif
+    return 0;
+}
+
+enum { STAT_LIMIT, STAT_SIZE, STAT_HITS, STAT_MISSES, STAT_OVERFLOWS,
+       NUM_FREELIST_STATS };
+
+static void
+add_freelist_stats(Py_ssize_t stats[][NUM_FREELIST_STATS],
+                   struct _Py_freelists *freelists)
+{
+    for (size_t k = 0; k < NUM_FREELIST_KINDS; k++) {
+        const freelist_kind *kind = &freelist_kinds[k];
+        for (Py_ssize_t i = 0; i < kind->count; i++) {
+            struct _Py_freelist *fl = get_freelist(freelists, kind, i);
+            stats[k][STAT_SIZE] += Py_MAX(fl->size, 0);
+            stats[k][STAT_HITS] += _Py_atomic_load_ssize_relaxed(&fl->hits);
+            stats[k][STAT_MISSES] +=
+                _Py_atomic_load_ssize_relaxed(&fl->misses);
+            stats[k][STAT_OVERFLOWS] +=
+                _Py_atomic_load_ssize_relaxed(&fl->overflows);
+        }
     }
-    clear_freelist(&freelists->unicode_writers, is_finalization, PyMem_Free);
 }
 
+PyObject *
+_PyObject_GetFreeListStats(PyInterpreterState *interp)
+{
+    Py_ssize_t stats[NUM_FREELIST_KINDS][NUM_FREELIST_STATS] = {{0}};
+    for (size_t k = 0; k < NUM_FREELIST_KINDS; k++) {
+        stats[k][STAT_LIMIT] =
+            get_freelist(&interp->object_state.freelists,
+                         &freelist_kinds[k], 0)->maxsize;
+    }
+#ifdef Py_GIL_DISABLED
+    // Objects can't be allocated while the world is stopped: gather the
+    // numbers first.
+    _PyEval_StopTheWorld(interp);
+    HEAD_LOCK(&_PyRuntime);
+    add_freelist_stats(stats, &interp->object_state.freelists);
+    for (PyThreadState *p = interp->threads.head; p != NULL; p = p->next) {
+        add_freelist_stats(stats, &((_PyThreadStateImpl *)p)->freelists);
+    }
+    HEAD_UNLOCK(&_PyRuntime);
+    _PyEval_StartTheWorld(interp);
+#else
+    add_freelist_stats(stats, &interp->object_state.freelists);
+#endif
+
+    PyObject *result = PyDict_New();
+    if (result == NULL) {
+        return NULL;
+    }
+    for (size_t k = 0; k < NUM_FREELIST_KINDS; k++) {
+        PyObject *item = Py_BuildValue(
+            "{snsnsnsnsn}",
+            "limit", stats[k][STAT_LIMIT],
+            "size", stats[k][STAT_SIZE],
+            "hits", stats[k][STAT_HITS],
+            "misses", stats[k][STAT_MISSES],
+            "overflows", stats[k][STAT_OVERFLOWS]);
+        if (item == NULL
+            || PyDict_SetItemString(result, freelist_kinds[k].name, item) < 0)
+        {
+            Py_XDECREF(item);
+            Py_DECREF(result);
+            return NULL;
+        }
+        Py_DECREF(item);
+    }
+    return result;
+}
+
+#undef NUM_FREELIST_KINDS
+
 /*
 def _PyObject_FunctionStr(x):
     try:
@@ -2507,6 +2712,61 @@ _Py_SetImmortal(PyObject *op)
     _Py_SetImmortalUntracked(op);
 }
 
+static int
+immortalize_referent(PyObject *op, void *arg)
+{
+    // Tracked containers are reached by the caller's walk of the GC heap.
+    if (!_PyObject_IS_GC(op) || !_PyObject_GC_IS_TRACKED(op)) {
+        *(Py_ssize_t *)arg += _PyObject_Immortalize(op);
+    }
+    return 0;
+}
+
+/* Make op immortal and stop tracking it, along with the objects it refers to
+   that the collector does not track (atomic objects and untracked
+   containers).  Returns the number of objects that became immortal.
+
+   Strings which are not interned are left mortal: they can only be made
+   immortal through the interned dict, which releases them at finalization.
+   In the free-threaded build objects queued for a refcount merge by another
+   thread are also left alone. */
+Py_ssize_t
+_PyObject_Immortalize(PyObject *op)
+{
+    if (PyUnicode_CheckExact(op)) {
+        if (PyUnicode_CHECK_INTERNED(op) != SSTATE_INTERNED_MORTAL) {
+            return 0;
+        }
+        Py_INCREF(op);
+        _PyUnicode_InternImmortal(_PyInterpreterState_GET(), &op);
+        return 1;
+    }
+#ifdef Py_GIL_DISABLED
+    if (_Py_REF_IS_QUEUED(_Py_atomic_load_ssize_relaxed(&op->ob_ref_shared))) {
+        return 0;
+    }
+#endif
+    int is_gc = _PyObject_IS_GC(op);
+    if (is_gc && _PyObject_GC_IS_TRACKED(op)) {
+        _PyObject_GC_UNTRACK(op);
+    }
+    if (_Py_IsImmortal(op)) {
+        return 0;
+    }
+#ifdef Py_REF_DEBUG
+    /* Decrefs of immortal objects are not counted, so drop the references
+       the object currently holds from the RefTotal. */
+    _Py_AddRefTotal(_PyThreadState_GET(), -Py_REFCNT(op));
+#endif
+    _Py_SetImmortalUntracked(op);
+    Py_ssize_t count = 1;
+    if (is_gc) {
+        traverseproc traverse = Py_TYPE(op)->tp_traverse;
+        (void)traverse(op, immortalize_referent, &count);
+    }
+    return count;
+}
+
 void
 _PyObject_SetDeferredRefcount(PyObject *op)
 {
@@ -1,6 +1,7 @@
 /* Python's malloc wrappers (see pymem.h) */
 
 #include "Python.h"
+#include "pycore_ceval.h"         // _PY_EVAL_PURGE_MEMORY_BIT
 #include "pycore_code.h"          // stats
 #include "pycore_object.h"        // _PyDebugAllocatorStats() definition
 #include "pycore_obmalloc.h"
@@ -357,6 +358,56 @@ void _PyMem_DebugFree(void *ctx, void *p);
 #  endif
 #endif
 
+#ifdef ARENAS_USE_MMAP
+/* With PyConfig.huge_pages, arenas are carved out of HUGE_PAGE_SIZE chunks
+   that are aligned on a huge page boundary and advised with MADV_HUGEPAGE,
+   so that the kernel can back each chunk with a single transparent huge
+   page.  A 1 MiB arena on its own never qualifies.  Arenas are still
+   unmapped one by one: the kernel splits the huge page when that happens. */
+#define HUGE_PAGE_SIZE (2 << 20)                /* 2 MiB */
+static_assert(HUGE_PAGE_SIZE % ARENA_SIZE == 0,
+              "arenas must tile a huge page");
+
+static void *
+arena_alloc_huge(size_t size)
+{
+    struct _pymem_allocators *allocators = &_PyRuntime.allocators;
+    void *ptr = NULL;
+
+    /* Arenas can be allocated with the GIL released or during a
+       stop-the-world pause: don't detach the thread state while waiting. */
+    PyMutex_LockFlags(&allocators->huge_pages.mutex, _Py_LOCK_DONT_DETACH);
+    if (allocators->huge_pages.end - allocators->huge_pages.next < size) {
+        /* Over-allocate, then trim the mapping to an aligned chunk. */
+        size_t map_size = 2 * HUGE_PAGE_SIZE;
+        char *map = mmap(NULL, map_size, PROT_READ|PROT_WRITE,
+                         MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+        if (map == MAP_FAILED) {
+            goto done;
+        }
+        char *chunk = (char *)_Py_SIZE_ROUND_UP(map, HUGE_PAGE_SIZE);
+        if (chunk != map) {
+            munmap(map, chunk - map);
+        }
+        if (chunk + HUGE_PAGE_SIZE != map + map_size) {
+            munmap(chunk + HUGE_PAGE_SIZE,
+                   (map + map_size) - (chunk + HUGE_PAGE_SIZE));
+        }
+#ifdef MADV_HUGEPAGE
+        /* Only needed when THP is in "madvise" mode; failure is harmless. */
+        (void)madvise(chunk, HUGE_PAGE_SIZE, MADV_HUGEPAGE);
+#endif
+        allocators->huge_pages.next = (uintptr_t)chunk;
+        allocators->huge_pages.end = (uintptr_t)chunk + HUGE_PAGE_SIZE;
+    }
+    ptr = (void *)allocators->huge_pages.next;
+    allocators->huge_pages.next += size;
+done:
+    PyMutex_Unlock(&allocators->huge_pages.mutex);
+    return ptr;
+}
+#endif
+
 void *
 _PyMem_ArenaAlloc(void *Py_UNUSED(ctx), size_t size)
 {
@@ -365,6 +416,11 @@ _PyMem_ArenaAlloc(void *Py_UNUSED(ctx), size_t size)
                         MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
 #elif defined(ARENAS_USE_MMAP)
     void *ptr;
+    /* Only pymalloc arenas: _PyObject_VirtualAlloc() callers can ask for
+       less than a page, which could not be unmapped on its own. */
+    if (_PyRuntime.allocators.huge_pages.enabled && size == ARENA_SIZE) {
+        return arena_alloc_huge(size);
+    }
     ptr = mmap(NULL, size, PROT_READ|PROT_WRITE,
                MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
     if (ptr == MAP_FAILED)
@@ -740,16 +796,37 @@ _PyMem_DebugEnabled(void)
     return _PyRuntime.allocators.is_debug_enabled;
 }
 
+void
+_PyMem_EnableHugePages(void)
+{
+    _PyRuntime.allocators.huge_pages.enabled = 1;
+#ifdef WITH_MIMALLOC
+    /* mimalloc segments are already aligned on their (larger) size.  This
+       makes mimalloc try MAP_HUGETLB first and otherwise advise them with
+       MADV_HUGEPAGE; such segments are then never decommitted. */
+    mi_option_enable(mi_option_allow_large_os_pages);
+#endif
+}
+
 #ifdef WITH_PYMALLOC
+#ifndef Py_GIL_DISABLED
+static void *_PyObject_RegionMalloc(void *ctx, size_t nbytes);
+#endif
+
 static int
 _PyMem_PymallocEnabled(void)
 {
+    PyMemAllocatorEx *alloc = &_PyObject;
     if (_PyMem_DebugEnabled()) {
-        return (_PyMem_Debug.obj.alloc.malloc == _PyObject_Malloc);
+        alloc = &_PyMem_Debug.obj.alloc;
     }
-    else {
-        return (_PyObject.malloc == _PyObject_Malloc);
+#ifndef Py_GIL_DISABLED
+    /* The allocation region functions are pymalloc too. */
+    if (alloc->malloc == _PyObject_RegionMalloc) {
+        return 1;
     }
+#endif
+    return (alloc->malloc == _PyObject_Malloc);
 }
 
 #ifdef WITH_MIMALLOC
@@ -1946,15 +2023,12 @@ pymalloc_pool_extend(poolp pool, uint size)
     pool->nextpool = next;
 }
 
-/* called when pymalloc_alloc can not allocate a block from usedpool.
- * This function takes new pool and allocate a block from it.
+/* Take a free pool from the most used arena, allocating a new arena if
+ * there is none.  Return NULL if no memory is available.
  */
-static void*
-allocate_from_new_pool(OMState *state, uint size)
+static poolp
+take_free_pool(OMState *state)
 {
-    /* There isn't a pool of the right size class immediately
-     * available:  use a free pool.
-     */
     if (UNLIKELY(usable_arenas == NULL)) {
         /* No arena has a free pool:  allocate a new arena. */
 #ifdef WITH_MEMORY_LIMITS
@@ -2043,6 +2117,22 @@ allocate_from_new_pool(OMState *state, uint size)
             }
         }
     }
+    return pool;
+}
+
+/* called when pymalloc_alloc can not allocate a block from usedpool.
+ * This function takes new pool and allocate a block from it.
+ */
+static void*
+allocate_from_new_pool(OMState *state, uint size)
+{
+    /* There isn't a pool of the right size class immediately
+     * available:  use a free pool.
+     */
+    poolp pool = take_free_pool(state);
+    if (UNLIKELY(pool == NULL)) {
+        return NULL;
+    }
 
     /* Frontlink to used pools. */
     pymem_block *bp;
@@ -2354,6 +2444,102 @@ insert_to_freepool(OMState *state, poolp pool)
            || ao->prevarena->nextarena == ao);
 }
 
+/* Returning free memory to the OS.
+
+   pymalloc frees an arena only when all of its pools are free, so a few
+   live blocks are enough to keep a whole arena resident.  The pages of the
+   free pools of such arenas are released with MADV_DONTNEED instead.  The
+   first page of each pool is kept: it holds the pool header, which links the
+   pool in its arena's freepools list.  Released pools are marked with
+   PURGED_SIZE_IDX so that later purges skip them and allocate_from_new_pool()
+   reinitializes them (their free list is gone). */
+
+#define PURGED_SIZE_IDX (DUMMY_SIZE_IDX - 1)
+
+static Py_ssize_t
+pymalloc_purge(OMState *state)
+{
+    Py_ssize_t released = 0;
+#if defined(ARENAS_USE_MMAP) && defined(MADV_DONTNEED)
+    size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+    for (struct arena_object *ao = usable_arenas; ao != NULL;
+         ao = ao->nextarena)
+    {
+        for (poolp pool = ao->freepools; pool != NULL; pool = pool->nextpool) {
+            if (pool->szidx == PURGED_SIZE_IDX) {
+                continue;
+            }
+            uintptr_t start = _Py_SIZE_ROUND_UP((uintptr_t)pool + POOL_OVERHEAD,
+                                                page_size);
+            uintptr_t end = (uintptr_t)pool + POOL_SIZE;
+            if (start < end
+                && madvise((void *)start, end - start, MADV_DONTNEED) == 0)
+            {
+                released += end - start;
+            }
+            pool->szidx = PURGED_SIZE_IDX;
+        }
+    }
+#endif
+    return released;
+}
+
+#ifdef WITH_MIMALLOC
+static bool
+purge_page_segment(mi_heap_t *heap, mi_page_queue_t *pq, mi_page_t *page,
+                   void *stats, void *arg)
+{
+    mi_segment_try_purge(_mi_page_segment(page), true, (mi_stats_t *)stats);
+    return true;
+}
+
+/* mimalloc already decommits the free spans of a segment, but only once
+   their purge delay has expired *and* the owning thread calls into the
+   allocator again.  Free the empty pages of the thread's heaps and force
+   the pending purges of their segments and of the arenas. */
+static Py_ssize_t
+mimalloc_purge(void)
+{
+#ifdef Py_GIL_DISABLED
+    _PyThreadStateImpl *tstate = (_PyThreadStateImpl *)_PyThreadState_GET();
+    mi_heap_t *heaps = tstate->mimalloc.heaps;
+    int nheaps = _Py_MIMALLOC_HEAP_COUNT;
+    if (!tstate->mimalloc.initialized) {
+        return 0;
+    }
+#else
+    mi_heap_t *heaps = mi_heap_get_default();
+    int nheaps = 1;
+#endif
+    mi_stats_t *stats = &heaps[0].tld->stats;
+    int64_t purged = stats->purged.allocated;
+    for (int i = 0; i < nheaps; i++) {
+        mi_heap_collect(&heaps[i], false);
+        mi_heap_visit_pages(&heaps[i], &purge_page_segment, stats, NULL);
+    }
+    _mi_arena_collect(true, stats);
+    return (Py_ssize_t)(stats->purged.allocated - purged);
+}
+#endif
+
+Py_ssize_t
+_PyMem_PurgeFreeMemory(void)
+{
+    Py_ssize_t released = 0;
+#ifdef WITH_MIMALLOC
+    if (_PyMem_MimallocEnabled()) {
+        released = mimalloc_purge();
+    }
+#endif
+    if (_PyMem_PymallocEnabled()) {
+        released = pymalloc_purge(get_state());
+    }
+    _Py_atomic_add_ssize(&_PyRuntime.allocators.purger.purges, 1);
+    _Py_atomic_add_ssize(&_PyRuntime.allocators.purger.bytes_released,
+                         released);
+    return released;
+}
+
 /* Free a memory block allocated by pymalloc_alloc().
    Return 1 if it was freed.
    Return 0 if the block was not allocated by pymalloc_alloc(). */
@@ -2520,6 +2706,293 @@ _PyObject_Realloc(void *ctx, void *ptr, size_t nbytes)
     return PyMem_RawRealloc(ptr, nbytes);
 }
 
+/* Allocation regions, see "Allocation regions" in pycore_obmalloc.h. */
+
+#define REGION_SIZE_IDX 0x10000
+#define POOL_IS_REGION(pool) (((pool)->szidx & REGION_SIZE_IDX) != 0)
+
+/* The free-threaded build allocates objects with mimalloc: regions have no
+   effect there. */
+#ifndef Py_GIL_DISABLED
+
+/* Start a region pool of the given size class. */
+static poolp
+region_new_pool(OMState *state, uint size)
+{
+    poolp pool = take_free_pool(state);
+    if (UNLIKELY(pool == NULL)) {
+        return NULL;
+    }
+    pool->ref.count = 0;
+    pool->freeblock = NULL;
+    pool->szidx = size | REGION_SIZE_IDX;
+    pool->nextoffset = POOL_OVERHEAD;
+    pool->maxnextoffset = POOL_SIZE - INDEX2SIZE(size);
+
+    /* Frontlink to the region pools. */
+    poolp head = &state->region.pools;
+    pool->nextpool = head->nextpool;
+    pool->prevpool = head;
+    head->nextpool->prevpool = pool;
+    head->nextpool = pool;
+    state->region.current[size] = pool;
+    return pool;
+}
+
+static void *
+region_alloc(OMState *state, size_t nbytes)
+{
+#ifdef WITH_VALGRIND
+    if (UNLIKELY(running_on_valgrind)) {
+        return NULL;
+    }
+#endif
+    if (UNLIKELY(nbytes == 0 || nbytes > SMALL_REQUEST_THRESHOLD)) {
+        return NULL;
+    }
+    uint size = (uint)(nbytes - 1) >> ALIGNMENT_SHIFT;
+    poolp pool = state->region.current[size];
+    if (UNLIKELY(pool == NULL || pool->nextoffset > pool->maxnextoffset)) {
+        /* The full pool stays in the region until its blocks are freed. */
+        pool = state->region.empty[size];
+        if (pool != NULL) {
+            state->region.empty[size] = (poolp)pool->freeblock;
+            pool->freeblock = NULL;
+            state->region.current[size] = pool;
+        }
+        else {
+            pool = region_new_pool(state, size);
+            if (pool == NULL) {
+                return NULL;
+            }
+        }
+    }
+    pymem_block *bp = (pymem_block *)pool + pool->nextoffset;
+    pool->nextoffset += INDEX2SIZE(size);
+    ++pool->ref.count;
+    return bp;
+}
+
+/* Return an empty region pool to its arena. */
+static void
+region_release_pool(OMState *state, poolp pool)
+{
+    assert(POOL_IS_REGION(pool) && pool->ref.count == 0);
+    /* Make allocate_from_new_pool() initialize the pool header. */
+    pool->szidx = DUMMY_SIZE_IDX;
+    insert_to_freepool(state, pool);
+}
+
+static void
+region_free_block(OMState *state, poolp pool, void *p)
+{
+    assert(pool->ref.count > 0);            /* else it was empty */
+    *(pymem_block **)p = pool->freeblock;
+    pool->freeblock = (pymem_block *)p;
+    if (LIKELY(--pool->ref.count != 0)) {
+        return;
+    }
+    /* All blocks are dead: bump-allocate from the start again. */
+    uint size = pool->szidx & ~REGION_SIZE_IDX;
+    pool->nextoffset = POOL_OVERHEAD;
+    if (state->region.current[size] == pool) {
+        pool->freeblock = NULL;
+    }
+    else {
+        pool->freeblock = (pymem_block *)state->region.empty[size];
+        state->region.empty[size] = pool;
+    }
+}
+
+static void *
+_PyObject_RegionMalloc(void *ctx, size_t nbytes)
+{
+    OMState *state = get_state();
+    if (state->region.depth > 0) {
+        void *ptr = region_alloc(state, nbytes);
+        if (ptr != NULL) {
+            return ptr;
+        }
+    }
+    return _PyObject_Malloc(ctx, nbytes);
+}
+
+static void *
+_PyObject_RegionCalloc(void *ctx, size_t nelem, size_t elsize)
+{
+    assert(elsize == 0 || nelem <= (size_t)PY_SSIZE_T_MAX / elsize);
+    size_t nbytes = nelem * elsize;
+
+    OMState *state = get_state();
+    if (state->region.depth > 0) {
+        void *ptr = region_alloc(state, nbytes);
+        if (ptr != NULL) {
+            memset(ptr, 0, nbytes);
+            return ptr;
+        }
+    }
+    return _PyObject_Calloc(ctx, nelem, elsize);
+}
+
+static void
+_PyObject_RegionFree(void *ctx, void *p)
+{
+    if (p == NULL) {
+        return;
+    }
+    OMState *state = get_state();
+    poolp pool = POOL_ADDR(p);
+    if (address_in_range(state, p, pool) && POOL_IS_REGION(pool)) {
+        region_free_block(state, pool, p);
+        return;
+    }
+    _PyObject_Free(ctx, p);
+}
+
+static void *
+_PyObject_RegionRealloc(void *ctx, void *p, size_t nbytes)
+{
+    if (p == NULL) {
+        return _PyObject_RegionMalloc(ctx, nbytes);
+    }
+    OMState *state = get_state();
+    poolp pool = POOL_ADDR(p);
+    if (!address_in_range(state, p, pool) || !POOL_IS_REGION(pool)) {
+        return _PyObject_Realloc(ctx, p, nbytes);
+    }
+    /* Same policy as pymalloc_realloc(). */
+    size_t size = INDEX2SIZE(pool->szidx & ~REGION_SIZE_IDX);
+    if (nbytes <= size) {
+        if (4 * nbytes > 3 * size) {
+            return p;
+        }
+        size = nbytes;
+    }
+    void *bp = _PyObject_RegionMalloc(ctx, nbytes);
+    if (bp != NULL) {
+        memcpy(bp, p, size);
+        region_free_block(state, pool, p);
+    }
+    return bp;
+}
+
+/* Return the allocator of the object domain that calls pymalloc directly,
+   under the debug hooks if they are installed, or NULL if pymalloc is not
+   the object allocator. */
+static PyMemAllocatorEx *
+get_pymalloc_obj_allocator(void)
+{
+    PyMemAllocatorEx *alloc = &_PyObject;
+    if (alloc->malloc == _PyMem_DebugMalloc) {
+        alloc = &_PyMem_Debug.obj.alloc;
+    }
+    if (alloc->malloc == _PyObject_Malloc
+        || alloc->malloc == _PyObject_RegionMalloc)
+    {
+        return alloc;
+    }
+    return NULL;
+}
+
+void
+_PyObject_EnterRegion(void)
+{
+    OMState *state = get_state();
+    if (state->region.depth++ > 0) {
+        return;
+    }
+    poolp head = &state->region.pools;
+    head->nextpool = head->prevpool = head;
+
+    PyMutex_Lock(&ALLOCATORS_MUTEX);
+    if (_PyRuntime.obmalloc.active_regions++ == 0) {
+        PyMemAllocatorEx *alloc = get_pymalloc_obj_allocator();
+        if (alloc != NULL) {
+            alloc->malloc = _PyObject_RegionMalloc;
+            alloc->calloc = _PyObject_RegionCalloc;
+            alloc->realloc = _PyObject_RegionRealloc;
+            alloc->free = _PyObject_RegionFree;
+        }
+    }
+    PyMutex_Unlock(&ALLOCATORS_MUTEX);
+}
+
+Py_ssize_t
+_PyObject_ExitRegion(void)
+{
+    OMState *state = get_state();
+    if (state->region.depth == 0) {
+        return -1;
+    }
+    if (--state->region.depth > 0) {
+        return 0;
+    }
+
+    PyMutex_Lock(&ALLOCATORS_MUTEX);
+    if (--_PyRuntime.obmalloc.active_regions == 0) {
+        /* The region functions stay correct if another allocator wrapped
+           them in the meantime: they fall back to pymalloc outside regions. */
+        PyMemAllocatorEx *alloc = get_pymalloc_obj_allocator();
+        if (alloc != NULL) {
+            alloc->malloc = _PyObject_Malloc;
+            alloc->calloc = _PyObject_Calloc;
+            alloc->realloc = _PyObject_Realloc;
+            alloc->free = _PyObject_Free;
+        }
+    }
+    PyMutex_Unlock(&ALLOCATORS_MUTEX);
+
+    Py_ssize_t escaped = 0;
+    poolp head = &state->region.pools;
+    poolp pool = head->nextpool;
+    while (pool != head) {
+        poolp next = pool->nextpool;
+        /* The list is dropped as a whole: detach every pool from it. */
+        pool->nextpool = pool->prevpool = pool;
+        if (pool->ref.count == 0) {
+            region_release_pool(state, pool);
+            pool = next;
+            continue;
+        }
+        /* Hand the pool over to pymalloc.  Its free list holds the dead
+           blocks and its tail is still unused, as in any used pool. */
+        escaped += pool->ref.count;
+        pool->szidx &= ~REGION_SIZE_IDX;
+        if (pool->freeblock == NULL) {
+            if (pool->nextoffset > pool->maxnextoffset) {
+                /* Full: pymalloc_free() links it to usedpools. */
+                assert(pool->ref.count == NUMBLOCKS(pool->szidx));
+                pool = next;
+                continue;
+            }
+            pool->freeblock = (pymem_block *)pool + pool->nextoffset;
+            pool->nextoffset += INDEX2SIZE(pool->szidx);
+            *(pymem_block **)(pool->freeblock) = NULL;
+        }
+        insert_to_usedpool(state, pool);
+        pool = next;
+    }
+    head->nextpool = head->prevpool = head;
+    memset(state->region.current, 0, sizeof(state->region.current));
+    memset(state->region.empty, 0, sizeof(state->region.empty));
+    return escaped;
+}
+
+#else   /* Py_GIL_DISABLED */
+
+void
+_PyObject_EnterRegion(void)
+{
+}
+
+Py_ssize_t
+_PyObject_ExitRegion(void)
+{
+    return 0;
+}
+
+#endif  /* Py_GIL_DISABLED */
+
 #else   /* ! WITH_PYMALLOC */
 
 /*==========================================================================*/
@@ -2550,9 +3023,97 @@ _Py_FinalizeAllocatedBlocks(_PyRuntimeState *Py_UNUSED(runtime))
     return;
 }
 
+Py_ssize_t
+_PyMem_PurgeFreeMemory(void)
+{
+    _Py_atomic_add_ssize(&_PyRuntime.allocators.purger.purges, 1);
+    return 0;
+}
+
+void
+_PyObject_EnterRegion(void)
+{
+}
+
+Py_ssize_t
+_PyObject_ExitRegion(void)
+{
+    return 0;
+}
+
 #endif /* WITH_PYMALLOC */
 
 
+/* The memory purger: a thread without a thread state that periodically sets
+   _PY_EVAL_PURGE_MEMORY_BIT on the threads of the main interpreter.  Each
+   thread then purges its own allocator state in _Py_HandlePending(), where it
+   holds the GIL (or, in the free-threaded build, owns its mimalloc heaps).
+   Threads that are blocked purge when they next run Python code. */
+
+#define purger _PyRuntime.allocators.purger
+
+static void
+purger_thread(void *Py_UNUSED(arg))
+{
+    PyInterpreterState *interp = _PyInterpreterState_Main();
+    while (!PyEvent_WaitTimed(&purger.stop, purger.interval, 0)) {
+        _Py_set_eval_breaker_bit_all(interp, _PY_EVAL_PURGE_MEMORY_BIT);
+    }
+}
+
+int
+_PyMem_StartPurger(PyTime_t interval)
+{
+    assert(interval > 0);
+    PyThread_ident_t ident;
+    int res = 0;
+    PyMutex_Lock(&purger.control);
+    if (purger.active) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "the memory purger is already running");
+        res = -1;
+        goto done;
+    }
+    purger.interval = interval;
+    purger.stop = (PyEvent){0};
+    if (PyThread_start_joinable_thread(purger_thread, NULL,
+                                       &ident, &purger.handle)) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "can't start the memory purger thread");
+        res = -1;
+        goto done;
+    }
+    _Py_atomic_store_int(&purger.active, 1);
+done:
+    PyMutex_Unlock(&purger.control);
+    return res;
+}
+
+void
+_PyMem_StopPurger(void)
+{
+    PyMutex_Lock(&purger.control);
+    if (purger.active) {
+        _Py_atomic_store_int(&purger.active, 0);
+        _PyEvent_Notify(&purger.stop);
+        Py_BEGIN_ALLOW_THREADS
+        PyThread_join_thread(purger.handle);
+        Py_END_ALLOW_THREADS
+    }
+    PyMutex_Unlock(&purger.control);
+}
+
+void
+_PyMem_PurgerAfterFork_Child(void)
+{
+    // The purger thread does not exist in the child.
+    purger.control = (PyMutex){0};
+    purger.active = 0;
+}
+
+#undef purger
+
+
 /*==========================================================================*/
 /* A x-platform debugging allocator.  This doesn't manage memory directly,
  * it wraps a real allocator, adding extra debugging info to the memory blocks.
@@ -3339,10 +3900,10 @@ pymalloc_print_stats(FILE *out)
         assert(base <= (uintptr_t) allarenas[i].pool_address);
         for (; base < (uintptr_t) allarenas[i].pool_address; base += POOL_SIZE) {
             poolp p = (poolp)base;
-            const uint sz = p->szidx;
+            const uint sz = p->szidx & ~REGION_SIZE_IDX;
             uint freeblocks;
 
-            if (p->ref.count == 0) {
+            if (p->ref.count == 0 && !POOL_IS_REGION(p)) {
                 /* currently unused */
 #ifdef Py_DEBUG
                 assert(pool_is_in_list(p, allarenas[i].freepools));
@@ -3354,7 +3915,7 @@ pymalloc_print_stats(FILE *out)
             freeblocks = NUMBLOCKS(sz) - p->ref.count;
             numfreeblocks[sz] += freeblocks;
 #ifdef Py_DEBUG
-            if (freeblocks > 0)
+            if (freeblocks > 0 && !POOL_IS_REGION(p))
                 assert(pool_is_in_list(p, usedpools[sz + sz]));
 #endif
         }
@@ -19,6 +19,146 @@
 /* 10xxxxxx */
 #define IS_CONTINUATION_BYTE(ch) ((ch) >= 0x80 && (ch) < 0xC0)
 
+#include "simd.h"
+
+#ifdef STRINGLIB_HAVE_SIMD
+/* Copy ASCII characters from s to p a vector at a time, widening them to
+   STRINGLIB_CHAR.  Stop at the first non-ASCII byte, or when fewer than a
+   vector of bytes is left.  Return the number of characters copied. */
+Py_LOCAL_INLINE(Py_ssize_t)
+STRINGLIB(utf8_decode_ascii)(const char *s, const char *end,
+                             STRINGLIB_CHAR *p)
+{
+    const char *start = s;
+    while (end - s >= STRINGLIB_SIMD_WIDTH) {
+#ifdef STRINGLIB_HAVE_SSE2
+        __m128i v = _mm_loadu_si128((const __m128i *)s);
+        if (_mm_movemask_epi8(v) != 0) {
+            goto prefix;
+        }
+# if STRINGLIB_SIZEOF_CHAR == 1
+        _mm_storeu_si128((__m128i *)p, v);
+# else
+        const __m128i zero = _mm_setzero_si128();
+        __m128i lo = _mm_unpacklo_epi8(v, zero);
+        __m128i hi = _mm_unpackhi_epi8(v, zero);
+#  if STRINGLIB_SIZEOF_CHAR == 2
+        _mm_storeu_si128((__m128i *)p, lo);
+        _mm_storeu_si128((__m128i *)(p + 8), hi);
+#  else
+        _mm_storeu_si128((__m128i *)p, _mm_unpacklo_epi16(lo, zero));
+        _mm_storeu_si128((__m128i *)(p + 4), _mm_unpackhi_epi16(lo, zero));
+        _mm_storeu_si128((__m128i *)(p + 8), _mm_unpacklo_epi16(hi, zero));
+        _mm_storeu_si128((__m128i *)(p + 12), _mm_unpackhi_epi16(hi, zero));
+#  endif
+# endif
+#else  /* STRINGLIB_HAVE_NEON */
+        uint8x16_t v = vld1q_u8((const uint8_t *)s);
+        if (vmaxvq_u8(v) >= 0x80) {
+            goto prefix;
+        }
+# if STRINGLIB_SIZEOF_CHAR == 1
+        vst1q_u8((uint8_t *)p, v);
+# else
+        uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+        uint16x8_t hi = vmovl_high_u8(v);
+#  if STRINGLIB_SIZEOF_CHAR == 2
+        vst1q_u16((uint16_t *)p, lo);
+        vst1q_u16((uint16_t *)(p + 8), hi);
+#  else
+        vst1q_u32((uint32_t *)p, vmovl_u16(vget_low_u16(lo)));
+        vst1q_u32((uint32_t *)(p + 4), vmovl_high_u16(lo));
+        vst1q_u32((uint32_t *)(p + 8), vmovl_u16(vget_low_u16(hi)));
+        vst1q_u32((uint32_t *)(p + 12), vmovl_high_u16(hi));
+#  endif
+# endif
+#endif
+        s += STRINGLIB_SIMD_WIDTH;
+        p += STRINGLIB_SIMD_WIDTH;
+    }
+    return s - start;
+
+prefix:
+    /* The vector at s holds a non-ASCII byte: copy the ASCII ones before
+       it so that the caller resumes at a multibyte sequence. */
+    while ((unsigned char)*s < 0x80) {
+        *p++ = (unsigned char)*s++;
+    }
+    return s - start;
+}
+
+/* Copy ASCII characters from data to p a vector at a time, narrowing them
+   to bytes, until fewer than a vector of characters is left or the next
+   vector holds a non-ASCII character.  Return the number of characters
+   copied. */
+Py_LOCAL_INLINE(Py_ssize_t)
+STRINGLIB(utf8_encode_ascii)(const STRINGLIB_CHAR *data, Py_ssize_t size,
+                             char *p)
+{
+    Py_ssize_t i = 0;
+    for (; size - i >= STRINGLIB_SIMD_WIDTH; i += STRINGLIB_SIMD_WIDTH) {
+        const STRINGLIB_CHAR *d = data + i;
+#ifdef STRINGLIB_HAVE_SSE2
+# if STRINGLIB_SIZEOF_CHAR == 1
+        __m128i v = _mm_loadu_si128((const __m128i *)d);
+        if (_mm_movemask_epi8(v) != 0) {
+            break;
+        }
+# else
+        const __m128i zero = _mm_setzero_si128();
+#  if STRINGLIB_SIZEOF_CHAR == 2
+        __m128i a = _mm_loadu_si128((const __m128i *)d);
+        __m128i b = _mm_loadu_si128((const __m128i *)(d + 8));
+        __m128i high = _mm_and_si128(_mm_or_si128(a, b),
+                                     _mm_set1_epi16((short)0xFF80));
+#  else
+        __m128i a = _mm_packs_epi32(_mm_loadu_si128((const __m128i *)d),
+                                    _mm_loadu_si128((const __m128i *)(d + 4)));
+        __m128i b = _mm_packs_epi32(_mm_loadu_si128((const __m128i *)(d + 8)),
+                                    _mm_loadu_si128((const __m128i *)(d + 12)));
+        /* Signed saturation maps characters above 0x7FFF to 0x7FFF, and
+           no character is negative, so the range check still works. */
+        __m128i high = _mm_and_si128(_mm_or_si128(a, b),
+                                     _mm_set1_epi16((short)0xFF80));
+#  endif
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(high, zero)) != 0xFFFF) {
+            break;
+        }
+        __m128i v = _mm_packus_epi16(a, b);
+# endif
+        _mm_storeu_si128((__m128i *)(p + i), v);
+#else  /* STRINGLIB_HAVE_NEON */
+# if STRINGLIB_SIZEOF_CHAR == 1
+        uint8x16_t v = vld1q_u8((const uint8_t *)d);
+        if (vmaxvq_u8(v) >= 0x80) {
+            break;
+        }
+# elif STRINGLIB_SIZEOF_CHAR == 2
+        uint16x8_t a = vld1q_u16((const uint16_t *)d);
+        uint16x8_t b = vld1q_u16((const uint16_t *)(d + 8));
+        if (vmaxvq_u16(vorrq_u16(a, b)) >= 0x80) {
+            break;
+        }
+        uint8x16_t v = vcombine_u8(vmovn_u16(a), vmovn_u16(b));
+# else
+        uint32x4_t a = vld1q_u32((const uint32_t *)d);
+        uint32x4_t b = vld1q_u32((const uint32_t *)(d + 4));
+        uint32x4_t c = vld1q_u32((const uint32_t *)(d + 8));
+        uint32x4_t e = vld1q_u32((const uint32_t *)(d + 12));
+        if (vmaxvq_u32(vorrq_u32(vorrq_u32(a, b), vorrq_u32(c, e))) >= 0x80) {
+            break;
+        }
+        uint16x8_t ab = vcombine_u16(vmovn_u32(a), vmovn_u32(b));
+        uint16x8_t ce = vcombine_u16(vmovn_u32(c), vmovn_u32(e));
+        uint8x16_t v = vcombine_u8(vmovn_u16(ab), vmovn_u16(ce));
+# endif
+        vst1q_u8((uint8_t *)(p + i), v);
+#endif
+    }
+    return i;
+}
+#endif  /* STRINGLIB_HAVE_SIMD */
+
 Py_LOCAL_INLINE(Py_UCS4)
 STRINGLIB(utf8_decode)(const char **inptr, const char *end,
                        STRINGLIB_CHAR *dest,
@@ -32,6 +172,15 @@ STRINGLIB(utf8_decode)(const char **inptr, const char *end,
         ch = (unsigned char)*s;
 
         if (ch < 0x80) {
+#ifdef STRINGLIB_HAVE_SIMD
+            Py_ssize_t n = STRINGLIB(utf8_decode_ascii)(s, end, p);
+            s += n;
+            p += n;
+            if (s == end) {
+                break;
+            }
+            ch = (unsigned char)*s;
+#endif
             /* Fast path for runs of ASCII characters. Given that common UTF-8
                input will consist of an overwhelming majority of ASCII
                characters, we try to optimize for this case by checking
@@ -267,6 +416,10 @@ STRINGLIB(utf8_encoder)(_PyBytesWriter *writer,
 {
     Py_ssize_t i;                /* index into data of next input character */
     char *p;                     /* next free byte in output buffer */
+#ifdef STRINGLIB_HAVE_SIMD
+    Py_ssize_t simd_skip = STRINGLIB_SIMD_WIDTH;
+#endif
+    Py_ssize_t limit = size;     /* end of the current scalar stretch */
 #if STRINGLIB_SIZEOF_CHAR > 1
     PyObject *error_handler_obj = NULL;
     PyObject *exc = NULL;
@@ -292,7 +445,27 @@ STRINGLIB(utf8_encoder)(_PyBytesWriter *writer,
     if (p == NULL)
         return NULL;
 
-    for (i = 0; i < size;) {
+    i = 0;
+#ifdef STRINGLIB_HAVE_SIMD
+vectors:
+    {
+        /* Copy ASCII a vector at a time, then encode the characters from
+           the vector which stopped it one at a time.  The scalar stretch
+           grows while vectors keep failing, so that text with only short
+           ASCII runs does not pay for the check. */
+        Py_ssize_t n = STRINGLIB(utf8_encode_ascii)(data + i, size - i, p);
+        if (n) {
+            i += n;
+            p += n;
+            simd_skip = STRINGLIB_SIMD_WIDTH;
+        }
+        else if (simd_skip < 64 * STRINGLIB_SIMD_WIDTH) {
+            simd_skip *= 2;
+        }
+        limit = Py_MIN(size, i + simd_skip);
+    }
+#endif
+    while (i < limit) {
         Py_UCS4 ch = data[i++];
 
         if (ch < 0x80) {
@@ -453,6 +626,11 @@ STRINGLIB(utf8_encoder)(_PyBytesWriter *writer,
 #endif /* STRINGLIB_SIZEOF_CHAR > 2 */
 #endif /* STRINGLIB_SIZEOF_CHAR > 1 */
     }
+#ifdef STRINGLIB_HAVE_SIMD
+    if (i < size) {
+        goto vectors;
+    }
+#endif
 
 #if STRINGLIB_SIZEOF_CHAR > 1
     Py_XDECREF(error_handler_obj);
@@ -40,6 +40,19 @@
 #define STRINGLIB_BLOOM(mask, ch)     \
     ((mask &  (1UL << ((ch) & (STRINGLIB_BLOOM_WIDTH -1)))))
 
+/* Short needles are searched for a vector of haystack positions at a time:
+   compare the blocks starting at s[i] and s[i+m-1] with the first and last
+   characters of the needle, and only compare the rest of the needle where
+   both match. */
+#include "simd.h"
+
+#ifdef STRINGLIB_HAVE_SIMD
+#  define STRINGLIB_SIMD_FIND
+/* Longer needles are left to the two-way algorithm, which can skip over
+   most of the haystack. */
+#  define STRINGLIB_SIMD_MAX_NEEDLE 256
+#endif
+
 #ifdef STRINGLIB_FAST_MEMCHR
 #  define MEMCHR_CUT_OFF 15
 #else
@@ -736,6 +749,253 @@ STRINGLIB(default_rfind)(const STRINGLIB_CHAR* s, Py_ssize_t n,
 }
 
 
+#ifdef STRINGLIB_SIMD_FIND
+
+/* The scan functions look for the first block at or after s[i] that holds
+   a candidate position, and return its index with a mask of the candidates
+   in *mask: the candidate at s[i+k] sets bit (k << SIMD_SHIFT), where
+   SIMD_SHIFT is the log2 of the number of mask bits per character.  If no
+   block up to s[limit] has a candidate, they return the index of the next
+   block. */
+
+#ifdef STRINGLIB_HAVE_SSE2
+
+#if STRINGLIB_SIZEOF_CHAR == 1
+#  define SIMD_LANES 0xFFFFFFFFFFFFFFFFULL
+#  define SIMD_SHIFT 0
+#elif STRINGLIB_SIZEOF_CHAR == 2
+#  define SIMD_LANES 0x5555555555555555ULL
+#  define SIMD_SHIFT 1
+#else
+#  define SIMD_LANES 0x1111111111111111ULL
+#  define SIMD_SHIFT 2
+#endif
+
+static Py_ssize_t
+STRINGLIB(simd_scan_sse2)(const STRINGLIB_CHAR *s, Py_ssize_t i,
+                          Py_ssize_t limit, Py_ssize_t mlast,
+                          STRINGLIB_CHAR first, STRINGLIB_CHAR last,
+                          uint64_t *mask)
+{
+#if STRINGLIB_SIZEOF_CHAR == 1
+    const __m128i vfirst = _mm_set1_epi8((char)first);
+    const __m128i vlast = _mm_set1_epi8((char)last);
+#  define SIMD_CMPEQ _mm_cmpeq_epi8
+#elif STRINGLIB_SIZEOF_CHAR == 2
+    const __m128i vfirst = _mm_set1_epi16((short)first);
+    const __m128i vlast = _mm_set1_epi16((short)last);
+#  define SIMD_CMPEQ _mm_cmpeq_epi16
+#else
+    const __m128i vfirst = _mm_set1_epi32((int)first);
+    const __m128i vlast = _mm_set1_epi32((int)last);
+#  define SIMD_CMPEQ _mm_cmpeq_epi32
+#endif
+    for (; i <= limit; i += 16 / STRINGLIB_SIZEOF_CHAR) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(s + i));
+        __m128i b = _mm_loadu_si128((const __m128i *)(s + i + mlast));
+        __m128i eq = _mm_and_si128(SIMD_CMPEQ(a, vfirst),
+                                   SIMD_CMPEQ(b, vlast));
+        unsigned int bits = (unsigned int)_mm_movemask_epi8(eq);
+        if (bits != 0) {
+            *mask = bits & SIMD_LANES;
+            return i;
+        }
+    }
+#undef SIMD_CMPEQ
+    return i;
+}
+
+#ifdef STRINGLIB_HAVE_AVX2
+STRINGLIB_AVX2_TARGET static Py_ssize_t
+STRINGLIB(simd_scan_avx2)(const STRINGLIB_CHAR *s, Py_ssize_t i,
+                          Py_ssize_t limit, Py_ssize_t mlast,
+                          STRINGLIB_CHAR first, STRINGLIB_CHAR last,
+                          uint64_t *mask)
+{
+#if STRINGLIB_SIZEOF_CHAR == 1
+    const __m256i vfirst = _mm256_set1_epi8((char)first);
+    const __m256i vlast = _mm256_set1_epi8((char)last);
+#  define SIMD_CMPEQ _mm256_cmpeq_epi8
+#elif STRINGLIB_SIZEOF_CHAR == 2
+    const __m256i vfirst = _mm256_set1_epi16((short)first);
+    const __m256i vlast = _mm256_set1_epi16((short)last);
+#  define SIMD_CMPEQ _mm256_cmpeq_epi16
+#else
+    const __m256i vfirst = _mm256_set1_epi32((int)first);
+    const __m256i vlast = _mm256_set1_epi32((int)last);
+#  define SIMD_CMPEQ _mm256_cmpeq_epi32
+#endif
+    for (; i <= limit; i += 32 / STRINGLIB_SIZEOF_CHAR) {
+        __m256i a = _mm256_loadu_si256((const __m256i *)(s + i));
+        __m256i b = _mm256_loadu_si256((const __m256i *)(s + i + mlast));
+        __m256i eq = _mm256_and_si256(SIMD_CMPEQ(a, vfirst),
+                                      SIMD_CMPEQ(b, vlast));
+        unsigned int bits = (unsigned int)_mm256_movemask_epi8(eq);
+        if (bits != 0) {
+            *mask = bits & SIMD_LANES;
+            return i;
+        }
+    }
+#undef SIMD_CMPEQ
+    return i;
+}
+#endif  /* STRINGLIB_HAVE_AVX2 */
+
+#else  /* STRINGLIB_HAVE_NEON */
+
+/* The comparison result is narrowed to 4 bits per byte. */
+#if STRINGLIB_SIZEOF_CHAR == 1
+#  define SIMD_LANES 0x1111111111111111ULL
+#  define SIMD_SHIFT 2
+#  define SIMD_VEC uint8x16_t
+#  define SIMD_LOAD(p) vld1q_u8((const uint8_t *)(p))
+#  define SIMD_SPLAT(c) vdupq_n_u8((uint8_t)(c))
+#  define SIMD_CMPEQ vceqq_u8
+#  define SIMD_AND vandq_u8
+#  define SIMD_AS_U16 vreinterpretq_u16_u8
+#elif STRINGLIB_SIZEOF_CHAR == 2
+#  define SIMD_LANES 0x0101010101010101ULL
+#  define SIMD_SHIFT 3
+#  define SIMD_VEC uint16x8_t
+#  define SIMD_LOAD(p) vld1q_u16((const uint16_t *)(p))
+#  define SIMD_SPLAT(c) vdupq_n_u16((uint16_t)(c))
+#  define SIMD_CMPEQ vceqq_u16
+#  define SIMD_AND vandq_u16
+#  define SIMD_AS_U16(v) (v)
+#else
+#  define SIMD_LANES 0x0001000100010001ULL
+#  define SIMD_SHIFT 4
+#  define SIMD_VEC uint32x4_t
+#  define SIMD_LOAD(p) vld1q_u32((const uint32_t *)(p))
+#  define SIMD_SPLAT(c) vdupq_n_u32((uint32_t)(c))
+#  define SIMD_CMPEQ vceqq_u32
+#  define SIMD_AND vandq_u32
+#  define SIMD_AS_U16 vreinterpretq_u16_u32
+#endif
+
+static Py_ssize_t
+STRINGLIB(simd_scan_neon)(const STRINGLIB_CHAR *s, Py_ssize_t i,
+                          Py_ssize_t limit, Py_ssize_t mlast,
+                          STRINGLIB_CHAR first, STRINGLIB_CHAR last,
+                          uint64_t *mask)
+{
+    const SIMD_VEC vfirst = SIMD_SPLAT(first);
+    const SIMD_VEC vlast = SIMD_SPLAT(last);
+    for (; i <= limit; i += 16 / STRINGLIB_SIZEOF_CHAR) {
+        SIMD_VEC a = SIMD_LOAD(s + i);
+        SIMD_VEC b = SIMD_LOAD(s + i + mlast);
+        SIMD_VEC eq = SIMD_AND(SIMD_CMPEQ(a, vfirst), SIMD_CMPEQ(b, vlast));
+        uint8x8_t narrow = vshrn_n_u16(SIMD_AS_U16(eq), 4);
+        uint64_t bits = vget_lane_u64(vreinterpret_u64_u8(narrow), 0);
+        if (bits != 0) {
+            *mask = bits & SIMD_LANES;
+            return i;
+        }
+    }
+    return i;
+}
+
+#undef SIMD_VEC
+#undef SIMD_LOAD
+#undef SIMD_SPLAT
+#undef SIMD_CMPEQ
+#undef SIMD_AND
+#undef SIMD_AS_U16
+
+#endif  /* STRINGLIB_HAVE_NEON */
+
+
+static Py_ssize_t
+STRINGLIB(simd_find)(const STRINGLIB_CHAR* s, Py_ssize_t n,
+                     const STRINGLIB_CHAR* p, Py_ssize_t m,
+                     Py_ssize_t maxcount, int mode)
+{
+    Py_ssize_t (*scan)(const STRINGLIB_CHAR *, Py_ssize_t, Py_ssize_t,
+                       Py_ssize_t, STRINGLIB_CHAR, STRINGLIB_CHAR,
+                       uint64_t *);
+    Py_ssize_t width;
+#if defined(STRINGLIB_HAVE_AVX2)
+    if (stringlib_have_avx2()) {
+        scan = STRINGLIB(simd_scan_avx2);
+        width = 32 / STRINGLIB_SIZEOF_CHAR;
+    }
+    else {
+        scan = STRINGLIB(simd_scan_sse2);
+        width = 16 / STRINGLIB_SIZEOF_CHAR;
+    }
+#elif defined(STRINGLIB_HAVE_SSE2)
+    scan = STRINGLIB(simd_scan_sse2);
+    width = 16 / STRINGLIB_SIZEOF_CHAR;
+#else
+    scan = STRINGLIB(simd_scan_neon);
+    width = 16 / STRINGLIB_SIZEOF_CHAR;
+#endif
+
+    const Py_ssize_t mlast = m - 1;
+    const STRINGLIB_CHAR first = p[0];
+    const STRINGLIB_CHAR last = p[mlast];
+    /* The last block start whose loads stay within the haystack. */
+    const Py_ssize_t limit = n - mlast - width;
+    Py_ssize_t i = 0, next = 0, count = 0, hits = 0, res;
+    uint64_t mask;
+
+    while ((i = scan(s, i, limit, mlast, first, last, &mask)) <= limit) {
+        do {
+            Py_ssize_t j = i + (stringlib_ctz64(mask) >> SIMD_SHIFT);
+            mask &= mask - 1;
+            if (j < next) {
+                /* overlaps the previous match */
+                continue;
+            }
+            if (memcmp(s + j + 1, p + 1,
+                       (m - 2) * sizeof(STRINGLIB_CHAR)) == 0) {
+                /* got a match! */
+                if (mode != FAST_COUNT) {
+                    return j;
+                }
+                count++;
+                if (count == maxcount) {
+                    return maxcount;
+                }
+                next = j + m;
+                continue;
+            }
+            /* If checking false candidates costs much more than scanning,
+               switch to the two-way algorithm for its linear worst case. */
+            hits += m;
+            if (hits > 8 * j + 4096) {
+                if (mode == FAST_SEARCH) {
+                    res = STRINGLIB(_two_way_find)(s + j, n - j, p, m);
+                    return res == -1 ? -1 : res + j;
+                }
+                else {
+                    res = STRINGLIB(_two_way_count)(s + j, n - j, p, m,
+                                                    maxcount - count);
+                    return res + count;
+                }
+            }
+        } while (mask != 0);
+        i += width;
+    }
+
+    /* Search the tail that is too short for a full block. */
+    i = Py_MAX(i, next);
+    if (n - i < m) {
+        return mode == FAST_COUNT ? count : -1;
+    }
+    res = STRINGLIB(default_find)(s + i, n - i, p, m, maxcount - count, mode);
+    if (mode == FAST_COUNT) {
+        return res + count;
+    }
+    return res == -1 ? -1 : res + i;
+}
+
+#undef SIMD_LANES
+#undef SIMD_SHIFT
+
+#endif  /* STRINGLIB_SIMD_FIND */
+
+
 static inline Py_ssize_t
 STRINGLIB(count_char)(const STRINGLIB_CHAR *s, Py_ssize_t n,
                       const STRINGLIB_CHAR p0, Py_ssize_t maxcount)
@@ -797,6 +1057,11 @@ FASTSEARCH(const STRINGLIB_CHAR* s, Py_ssize_t n,
     }
 
     if (mode != FAST_RSEARCH) {
+#ifdef STRINGLIB_SIMD_FIND
+        if (m <= STRINGLIB_SIMD_MAX_NEEDLE) {
+            return STRINGLIB(simd_find)(s, n, p, m, maxcount, mode);
+        }
+#endif
         if (n < 2500 || (m < 100 && n < 30000) || m < 6) {
             return STRINGLIB(default_find)(s, n, p, m, maxcount, mode);
         }
@@ -0,0 +1,62 @@
+/* stringlib: SIMD instruction sets used by the string routines */
+
+#ifndef STRINGLIB_SIMD_H
+#define STRINGLIB_SIMD_H
+
+/* SSE2 and NEON are part of the x86-64 and AArch64 baselines, so code using
+   them needs no runtime check.  AVX2 code is compiled for the AVX2 target
+   with STRINGLIB_AVX2_TARGET and may only run when stringlib_have_avx2()
+   returns true. */
+
+#if defined(__x86_64__) || defined(_M_X64)
+#  include <emmintrin.h>
+#  define STRINGLIB_HAVE_SSE2
+#  if defined(__AVX2__)
+#    include <immintrin.h>
+#    define STRINGLIB_HAVE_AVX2
+#    define STRINGLIB_AVX2_TARGET
+#  elif defined(__GNUC__) && _Py__has_builtin(__builtin_cpu_supports)
+#    include <immintrin.h>
+#    define STRINGLIB_HAVE_AVX2
+#    define STRINGLIB_AVX2_TARGET __attribute__((target("avx2")))
+#  endif
+#elif (defined(__aarch64__) && !defined(__AARCH64EB__)) || defined(_M_ARM64)
+#  include <arm_neon.h>
+#  define STRINGLIB_HAVE_NEON
+#endif
+#ifdef _MSC_VER
+#  include <intrin.h>             // _BitScanForward64()
+#endif
+
+#if defined(STRINGLIB_HAVE_SSE2) || defined(STRINGLIB_HAVE_NEON)
+#  define STRINGLIB_HAVE_SIMD
+/* Number of bytes in a vector register of the baseline instruction set. */
+#  define STRINGLIB_SIMD_WIDTH 16
+
+static inline int
+stringlib_ctz64(uint64_t x)
+{
+    assert(x != 0);
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64(&index, x);
+    return (int)index;
+#else
+    return __builtin_ctzll(x);
+#endif
+}
+#endif
+
+#ifdef STRINGLIB_HAVE_AVX2
+static inline int
+stringlib_have_avx2(void)
+{
+#ifdef __AVX2__
+    return 1;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+#endif
+
+#endif  /* STRINGLIB_SIMD_H */
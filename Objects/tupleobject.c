@@ -41,7 +41,7 @@ tuple_alloc(Py_ssize_t size)
     assert(size != 0);    // The empty tuple is statically allocated.
     Py_ssize_t index = size - 1;
     if (index < PyTuple_MAXSAVESIZE) {
-        PyTupleObject *op = _Py_FREELIST_POP(PyTupleObject, tuples[index]);
+        PyTupleObject *op = _Py_FREELIST_POP_GC(PyTupleObject, tuples[index]);
         if (op != NULL) {
             return op;
         }
@@ -1143,7 +1143,7 @@ maybe_freelist_push(PyTupleObject *op)
     }
     Py_ssize_t index = Py_SIZE(op) - 1;
     if (index < PyTuple_MAXSAVESIZE) {
-        return _Py_FREELIST_PUSH(tuples[index], op, Py_tuple_MAXFREELIST);
+        return _Py_FREELIST_PUSH(tuples[index], op);
     }
     return 0;
 }
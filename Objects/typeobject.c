@@ -4376,6 +4376,18 @@ type_new_impl(type_new_ctx *ctx)
         goto error;
     }
 
+    // Classes inheriting a __dict__ slot from a static type, like exceptions,
+    // can't have a managed dict, but their instances can still share the keys
+    // of their dicts.
+    PyHeapTypeObject *et = (PyHeapTypeObject *)type;
+    if (type->tp_dictoffset > 0 && et->ht_cached_keys == NULL) {
+        et->ht_cached_keys = _PyDict_NewKeysForClass(et);
+        if (et->ht_cached_keys == NULL) {
+            PyErr_NoMemory();
+            goto error;
+        }
+    }
+
     // Put the proper slots in place
     fixup_slot_dispatchers(type);
 
@@ -4988,8 +4988,26 @@ PyUnicode_DecodeUTF8(const char *s,
 # error C 'size_t' size should be either 4 or 8!
 #endif
 
+#ifdef STRINGLIB_HAVE_AVX2
+STRINGLIB_AVX2_TARGET static Py_ssize_t
+ascii_decode_avx2(const char *start, const char *end, Py_UCS1 *dest)
+{
+    const char *p = start;
+    while (end - p >= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)p);
+        if (_mm256_movemask_epi8(v) != 0) {
+            break;
+        }
+        _mm256_storeu_si256((__m256i *)dest, v);
+        p += 32;
+        dest += 32;
+    }
+    return p - start;
+}
+#endif
+
 static Py_ssize_t
-ascii_decode(const char *start, const char *end, Py_UCS1 *dest)
+ascii_decode_words(const char *start, const char *end, Py_UCS1 *dest)
 {
     const char *p = start;
 
@@ -5043,6 +5061,151 @@ ascii_decode(const char *start, const char *end, Py_UCS1 *dest)
     return p - start;
 }
 
+static Py_ssize_t
+ascii_decode(const char *start, const char *end, Py_UCS1 *dest)
+{
+    Py_ssize_t n = 0;
+#ifdef STRINGLIB_HAVE_SIMD
+    /* Copy whole vectors while they only hold ASCII characters, and leave
+       the rest to the word-at-a-time loops. */
+# ifdef STRINGLIB_HAVE_AVX2
+    if (stringlib_have_avx2()) {
+        n = ascii_decode_avx2(start, end, dest);
+    }
+# endif
+    n += asciilib_utf8_decode_ascii(start + n, end, dest + n);
+#endif
+    return n + ascii_decode_words(start + n, end, dest + n);
+}
+
+
+#ifdef STRINGLIB_HAVE_AVX2
+STRINGLIB_AVX2_TARGET static Py_ssize_t
+utf8_count_chars_avx2(const char **inptr, const char *end,
+                      unsigned char *maxbyte)
+{
+    const char *s = *inptr;
+    Py_ssize_t count = 0;
+    const __m256i cont = _mm256_set1_epi8((char)0xBF);
+    __m256i vmax = _mm256_setzero_si256();
+    for (; end - s >= 32; s += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)s);
+        vmax = _mm256_max_epu8(vmax, v);
+        /* Continuation bytes are 0x80-0xBF: as signed bytes, <= 0xBF. */
+        unsigned int lead = _mm256_movemask_epi8(_mm256_cmpgt_epi8(v, cont));
+        count += _Py_popcount32(lead);
+    }
+    __m128i vmax128 = _mm_max_epu8(_mm256_castsi256_si128(vmax),
+                                   _mm256_extracti128_si256(vmax, 1));
+    unsigned char bytes[16];
+    _mm_storeu_si128((__m128i *)bytes, vmax128);
+    for (int i = 0; i < 16; i++) {
+        *maxbyte = Py_MAX(*maxbyte, bytes[i]);
+    }
+    *inptr = s;
+    return count;
+}
+#endif
+
+/* Return the number of code points in the UTF-8 data in [s, end), and store
+   its largest byte in *maxbyte.  The result only makes sense for valid
+   UTF-8: the number of code points is the number of bytes which are not
+   continuation bytes, and the largest byte gives the largest code point
+   class, and so the kind of the decoded string. */
+static Py_ssize_t
+utf8_count_chars(const char *s, const char *end, unsigned char *maxbyte)
+{
+    Py_ssize_t count = 0;
+    unsigned char max = 0;
+#ifdef STRINGLIB_HAVE_AVX2
+    if (stringlib_have_avx2()) {
+        count = utf8_count_chars_avx2(&s, end, &max);
+    }
+#endif
+#if defined(STRINGLIB_HAVE_SSE2)
+    const __m128i cont = _mm_set1_epi8((char)0xBF);
+    __m128i vmax = _mm_setzero_si128();
+    for (; end - s >= 16; s += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)s);
+        vmax = _mm_max_epu8(vmax, v);
+        unsigned int lead = _mm_movemask_epi8(_mm_cmpgt_epi8(v, cont));
+        count += _Py_popcount32(lead);
+    }
+    unsigned char bytes[16];
+    _mm_storeu_si128((__m128i *)bytes, vmax);
+    for (int i = 0; i < 16; i++) {
+        max = Py_MAX(max, bytes[i]);
+    }
+#elif defined(STRINGLIB_HAVE_NEON)
+    const int8x16_t cont = vdupq_n_s8((int8_t)0xBF);
+    uint8x16_t vmax = vdupq_n_u8(0);
+    for (; end - s >= 16; s += 16) {
+        uint8x16_t v = vld1q_u8((const uint8_t *)s);
+        vmax = vmaxq_u8(vmax, v);
+        uint8x16_t lead = vcgtq_s8(vreinterpretq_s8_u8(v), cont);
+        count += vaddvq_u8(vshrq_n_u8(lead, 7));
+    }
+    max = Py_MAX(max, vmaxvq_u8(vmax));
+#endif
+    for (; s < end; s++) {
+        unsigned char ch = (unsigned char)*s;
+        max = Py_MAX(max, ch);
+        count += (signed char)ch > (signed char)0xBF;
+    }
+    *maxbyte = max;
+    return count;
+}
+
+/* Decode valid UTF-8 data straight into a string of the right kind and
+   length, after a first pass has measured it.  The first ascii_len bytes
+   are known to be ASCII.  Return 0 and set *result on success, 1 if the
+   data is not valid or is truncated (the caller then decodes it with
+   _PyUnicodeWriter, which reports the errors), and -1 on memory error. */
+static int
+unicode_decode_utf8_exact(const char *start, Py_ssize_t ascii_len,
+                          const char *end, PyObject **result)
+{
+    const char *s = start + ascii_len;
+    unsigned char maxbyte;
+    Py_ssize_t length = ascii_len + utf8_count_chars(s, end, &maxbyte);
+    /* Lead bytes 0xC4-0xEF start characters in U+0100-U+FFFF, and 0xF0-0xF4
+       start characters in U+10000-U+10FFFF.  Continuation bytes are below
+       0xC0. */
+    Py_UCS4 maxchar = maxbyte >= 0xF0 ? MAX_UNICODE
+                      : maxbyte >= 0xC4 ? 0xFFFF : 0xFF;
+    PyObject *v = PyUnicode_New(length, maxchar);
+    if (v == NULL) {
+        return -1;
+    }
+
+    int kind = PyUnicode_KIND(v);
+    void *data = PyUnicode_DATA(v);
+    Py_ssize_t pos = ascii_len;
+    Py_UCS4 ch;
+    if (kind == PyUnicode_1BYTE_KIND) {
+        memcpy(data, start, ascii_len);
+        ch = ucs1lib_utf8_decode(&s, end, data, &pos);
+    }
+    else if (kind == PyUnicode_2BYTE_KIND) {
+        _PyUnicode_CONVERT_BYTES(Py_UCS1, Py_UCS2,
+                                 start, start + ascii_len, data);
+        ch = ucs2lib_utf8_decode(&s, end, data, &pos);
+    }
+    else {
+        assert(kind == PyUnicode_4BYTE_KIND);
+        _PyUnicode_CONVERT_BYTES(Py_UCS1, Py_UCS4,
+                                 start, start + ascii_len, data);
+        ch = ucs4lib_utf8_decode(&s, end, data, &pos);
+    }
+    if (ch != 0 || s != end || pos != length) {
+        Py_DECREF(v);
+        return 1;
+    }
+    assert(_PyUnicode_CheckConsistency(v, 1));
+    *result = v;
+    return 0;
+}
+
 
 static int
 unicode_decode_utf8_impl(_PyUnicodeWriter *writer,
@@ -5201,6 +5364,25 @@ unicode_decode_utf8(const char *s, Py_ssize_t size,
         }
         return u;
     }
+
+    /* The writer grows the string kind by kind, copying it each time.  When
+       the first non-ASCII character is above U+00FF, measure the data first
+       and decode it straight into a string of the final kind instead. */
+    PyObject *v = NULL;
+    int res = 1;
+    if ((unsigned char)s[decoded] >= 0xC4) {
+        res = unicode_decode_utf8_exact(s, decoded, end, &v);
+    }
+    if (res <= 0) {
+        Py_DECREF(u);
+        if (res < 0) {
+            return NULL;
+        }
+        if (consumed) {
+            *consumed = size;
+        }
+        return v;
+    }
     s += decoded;
     size -= decoded;
 
@@ -663,6 +663,12 @@ static int test_init_from_config(void)
     putenv("PYTHONMALLOCSTATS=0");
     config.malloc_stats = 1;
 
+    putenv("PYTHON_HUGE_PAGES=");
+    config.huge_pages = 1;
+
+    putenv("PYTHON_TRACE_CACHE=");
+    config.trace_cache = 1;
+
     putenv("PYTHONPYCACHEPREFIX=env_pycache_prefix");
     config_set_string(&config, &config.pycache_prefix, L"conf_pycache_prefix");
 
@@ -43,11 +43,15 @@
 
 #include <stdbool.h>              // bool
 
-#ifdef Py_DEBUG
+#if defined(Py_DEBUG) && !Py_TAIL_CALL_INTERP
    /* For debugging the interpreter: */
 #  define LLTRACE  1      /* Low-level trace feature */
 #endif
 
+#if Py_TAIL_CALL_INTERP && defined(_Py_TIER2) && !defined(_Py_JIT)
+#  error "The tail-calling interpreter does not support the tier 2 interpreter."
+#endif
+
 #if !defined(Py_BUILD_CORE)
 #  error "ceval.c must be build with Py_BUILD_CORE define for best performance"
 #endif
@@ -234,12 +238,12 @@ lltrace_resume_frame(_PyInterpreterFrame *frame)
 }
 
 static int
-maybe_lltrace_resume_frame(_PyInterpreterFrame *frame, _PyInterpreterFrame *skip_frame, PyObject *globals)
+maybe_lltrace_resume_frame(_PyInterpreterFrame *frame, PyObject *globals)
 {
     if (globals == NULL) {
         return 0;
     }
-    if (frame == skip_frame) {
+    if (frame->owner == FRAME_OWNED_BY_CSTACK) {
         return 0;
     }
     int r = PyDict_Contains(globals, &_Py_ID(__lltrace__));
@@ -785,13 +789,24 @@ _PyObjectArray_Free(PyObject **array, PyObject **scratch)
 /* This setting is reversed below following _PyEval_EvalFrameDefault */
 #endif
 
+#if Py_TAIL_CALL_INTERP
+#include "opcode_targets.h"
+#include "generated_cases.c.h"
+
+/* Leave _PyEval_EvalFrameDefault() for the chain of tail calls.  This only
+ * returns once the entry frame is popped, by INTERPRETER_EXIT or exit_unwind. */
+#define ENTER_LABEL(name) return _TAIL_CALL_##name(TAIL_CALL_ARGS)
+#else
+#define ENTER_LABEL(name) goto name
+#endif
+
 PyObject* _Py_HOT_FUNCTION
 _PyEval_EvalFrameDefault(PyThreadState *tstate, _PyInterpreterFrame *frame, int throwflag)
 {
     _Py_EnsureTstateNotNULL(tstate);
     CALL_STAT_INC(pyeval_calls);
 
-#if USE_COMPUTED_GOTOS
+#if USE_COMPUTED_GOTOS && !Py_TAIL_CALL_INTERP
 /* Import the static jump table */
 #include "opcode_targets.h"
 #endif
@@ -799,8 +814,21 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, _PyInterpreterFrame *frame, int
 #ifdef Py_STATS
     int lastopcode = 0;
 #endif
+#if Py_TAIL_CALL_INTERP
+    /* Only used to enter the first label: from there on, the interpreter
+     * state is passed along in the arguments of the tail calls. */
+    int opcode = 0;
+    int oparg = 0;
+    _Py_CODEUNIT *next_instr = NULL;
+    _PyStackRef *stack_pointer = NULL;
+#else
     uint8_t opcode;    /* Current opcode */
     int oparg;         /* Current opcode argument, if any */
+    /* Local "register" variables.
+     * These are cached values from the frame and code object.  */
+    _Py_CODEUNIT *next_instr;
+    _PyStackRef *stack_pointer;
+#endif
 #ifdef LLTRACE
     int lltrace = 0;
 #endif
@@ -831,13 +859,13 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, _PyInterpreterFrame *frame, int
     if (_Py_EnterRecursiveCallTstate(tstate, "")) {
         tstate->c_recursion_remaining--;
         tstate->py_recursion_remaining--;
-        goto exit_unwind;
+        ENTER_LABEL(exit_unwind);
     }
 
     /* support for generator.throw() */
     if (throwflag) {
         if (_Py_EnterRecursivePy(tstate)) {
-            goto exit_unwind;
+            ENTER_LABEL(exit_unwind);
         }
         /* Because this avoids the RESUME,
          * we need to update instrumentation */
@@ -847,7 +875,7 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, _PyInterpreterFrame *frame, int
             _Py_CODEUNIT *bytecode =
                 _PyEval_GetExecutableCode(tstate, _PyFrame_GetCode(frame));
             if (bytecode == NULL) {
-                goto error;
+                ENTER_LABEL(resume_with_error);
             }
             ptrdiff_t off = frame->instr_ptr - _PyFrame_GetBytecode(frame);
             frame->tlbc_index = ((_PyThreadStateImpl *)tstate)->tlbc_index;
@@ -857,45 +885,18 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, _PyInterpreterFrame *frame, int
         _Py_Instrument(_PyFrame_GetCode(frame), tstate->interp);
         monitor_throw(tstate, frame, frame->instr_ptr);
         /* TO DO -- Monitor throw entry. */
-        goto resume_with_error;
+        ENTER_LABEL(resume_with_error);
     }
 
-    /* Local "register" variables.
-     * These are cached values from the frame and code object.  */
-    _Py_CODEUNIT *next_instr;
-    _PyStackRef *stack_pointer;
-
 #if defined(_Py_TIER2) && !defined(_Py_JIT)
     /* Tier 2 interpreter state */
     _PyExecutorObject *current_executor = NULL;
     const _PyUOpInstruction *next_uop = NULL;
 #endif
 
-start_frame:
-    if (_Py_EnterRecursivePy(tstate)) {
-        goto exit_unwind;
-    }
-
-    next_instr = frame->instr_ptr;
-resume_frame:
-    stack_pointer = _PyFrame_GetStackPointer(frame);
-
-#ifdef LLTRACE
-    lltrace = maybe_lltrace_resume_frame(frame, &entry_frame, GLOBALS());
-    if (lltrace < 0) {
-        goto exit_unwind;
-    }
-#endif
-
-#ifdef Py_DEBUG
-    /* _PyEval_EvalFrameDefault() must not be called with an exception set,
-       because it can clear it (directly or indirectly) and so the
-       caller loses its exception */
-    assert(!_PyErr_Occurred(tstate));
-#endif
-
-    DISPATCH();
+    ENTER_LABEL(start_frame);
 
+#if !Py_TAIL_CALL_INTERP
     {
     /* Start instructions */
 #if !USE_COMPUTED_GOTOS
@@ -907,132 +908,18 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, _PyInterpreterFrame *frame, int
 #include "generated_cases.c.h"
 
 
-#if USE_COMPUTED_GOTOS
-        _unknown_opcode:
-#else
+#if !USE_COMPUTED_GOTOS
         EXTRA_CASES  // From pycore_opcode_metadata.h, a 'case' for each unused opcode
+            JUMP_TO_LABEL(unknown_opcode);
 #endif
-            /* Tell C compilers not to hold the opcode variable in the loop.
-               next_instr points the current instruction without TARGET(). */
-            opcode = next_instr->op.code;
-            _PyErr_Format(tstate, PyExc_SystemError,
-                          "%U:%d: unknown opcode %d",
-                          _PyFrame_GetCode(frame)->co_filename,
-                          PyUnstable_InterpreterFrame_GetLine(frame),
-                          opcode);
-            goto error;
 
         } /* End instructions */
 
         /* This should never be reached. Every opcode should end with DISPATCH()
            or goto error. */
         Py_UNREACHABLE();
-
-pop_4_error:
-    STACK_SHRINK(1);
-pop_3_error:
-    STACK_SHRINK(1);
-pop_2_error:
-    STACK_SHRINK(1);
-pop_1_error:
-    STACK_SHRINK(1);
-error:
-        /* Double-check exception status. */
-#ifdef NDEBUG
-        if (!_PyErr_Occurred(tstate)) {
-            _PyErr_SetString(tstate, PyExc_SystemError,
-                             "error return without exception set");
-        }
-#else
-        assert(_PyErr_Occurred(tstate));
-#endif
-
-        /* Log traceback info. */
-        assert(frame != &entry_frame);
-        if (!_PyFrame_IsIncomplete(frame)) {
-            PyFrameObject *f = _PyFrame_GetFrameObject(frame);
-            if (f != NULL) {
-                PyTraceBack_Here(f);
-            }
-        }
-        _PyEval_MonitorRaise(tstate, frame, next_instr-1);
-exception_unwind:
-        {
-            /* We can't use frame->instr_ptr here, as RERAISE may have set it */
-            int offset = INSTR_OFFSET()-1;
-            int level, handler, lasti;
-            if (get_exception_handler(_PyFrame_GetCode(frame), offset, &level, &handler, &lasti) == 0) {
-                // No handlers, so exit.
-                assert(_PyErr_Occurred(tstate));
-
-                /* Pop remaining stack entries. */
-                _PyStackRef *stackbase = _PyFrame_Stackbase(frame);
-                while (stack_pointer > stackbase) {
-                    PyStackRef_XCLOSE(POP());
-                }
-                assert(STACK_LEVEL() == 0);
-                _PyFrame_SetStackPointer(frame, stack_pointer);
-                monitor_unwind(tstate, frame, next_instr-1);
-                goto exit_unwind;
-            }
-
-            assert(STACK_LEVEL() >= level);
-            _PyStackRef *new_top = _PyFrame_Stackbase(frame) + level;
-            while (stack_pointer > new_top) {
-                PyStackRef_XCLOSE(POP());
-            }
-            if (lasti) {
-                int frame_lasti = _PyInterpreterFrame_LASTI(frame);
-                PyObject *lasti = PyLong_FromLong(frame_lasti);
-                if (lasti == NULL) {
-                    goto exception_unwind;
-                }
-                PUSH(PyStackRef_FromPyObjectSteal(lasti));
-            }
-
-            /* Make the raw exception data
-                available to the handler,
-                so a program can emulate the
-                Python main loop. */
-            PyObject *exc = _PyErr_GetRaisedException(tstate);
-            PUSH(PyStackRef_FromPyObjectSteal(exc));
-            next_instr = _PyFrame_GetBytecode(frame) + handler;
-
-            if (monitor_handled(tstate, frame, next_instr, exc) < 0) {
-                goto exception_unwind;
-            }
-            /* Resume normal execution */
-#ifdef LLTRACE
-            if (lltrace >= 5) {
-                lltrace_resume_frame(frame);
-            }
-#endif
-            DISPATCH();
-        }
-    }
-
-exit_unwind:
-    assert(_PyErr_Occurred(tstate));
-    _Py_LeaveRecursiveCallPy(tstate);
-    assert(frame != &entry_frame);
-    // GH-99729: We need to unlink the frame *before* clearing it:
-    _PyInterpreterFrame *dying = frame;
-    frame = tstate->current_frame = dying->previous;
-    _PyEval_FrameClearAndPop(tstate, dying);
-    frame->return_offset = 0;
-    if (frame == &entry_frame) {
-        /* Restore previous frame and exit */
-        tstate->current_frame = frame->previous;
-        tstate->c_recursion_remaining += PY_EVAL_C_STACK_UNITS;
-        return NULL;
     }
 
-resume_with_error:
-    next_instr = frame->instr_ptr;
-    stack_pointer = _PyFrame_GetStackPointer(frame);
-    goto error;
-
-
 #ifdef _Py_TIER2
 
 // Tier 2 is also here!
@@ -1061,6 +948,23 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, _PyInterpreterFrame *frame, int
 #undef ENABLE_SPECIALIZATION_FT
 #define ENABLE_SPECIALIZATION_FT 0
 
+/* The body of an inlined call runs in the space that its frame would have
+ * taken, above the caller's stack (see inline_call() in optimizer_analysis.c).
+ * Only there may the stack grow past the frame's, up to inlined_stack_limit. */
+#ifdef NDEBUG
+#define ENTER_INLINED_CALL(STACKSIZE) ((void)(STACKSIZE))
+#define LEAVE_INLINED_CALL() ((void)0)
+#else
+#define ENTER_INLINED_CALL(STACKSIZE) \
+    (assert(inlined_stack_limit == 0), \
+     inlined_stack_limit = STACK_LEVEL() + (int)(STACKSIZE))
+#define LEAVE_INLINED_CALL() (inlined_stack_limit = 0)
+#undef WITHIN_STACK_BOUNDS
+#define WITHIN_STACK_BOUNDS() \
+   (frame->owner == FRAME_OWNED_BY_CSTACK || (STACK_LEVEL() >= 0 && \
+    (STACK_LEVEL() <= STACK_SIZE() || STACK_LEVEL() <= inlined_stack_limit)))
+#endif
+
 #ifdef Py_DEBUG
     #define DPRINTF(level, ...) \
         if (lltrace >= (level)) { printf(__VA_ARGS__); }
@@ -1070,6 +974,9 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, _PyInterpreterFrame *frame, int
 
     ; // dummy statement after a label, before a declaration
     uint16_t uopcode;
+#ifndef NDEBUG
+    int inlined_stack_limit = 0;
+#endif
 #ifdef Py_STATS
     int lastuop = 0;
     uint64_t trace_uop_execution_counter = 0;
@@ -1173,6 +1080,7 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, _PyInterpreterFrame *frame, int
 
 #endif // _Py_TIER2
 
+#endif // !Py_TAIL_CALL_INTERP
 }
 
 #ifdef DO_NOT_OPTIMIZE_INTERP_LOOP
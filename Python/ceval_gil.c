@@ -1269,6 +1269,18 @@ _Py_HandlePending(PyThreadState *tstate)
         _PyThreadState_Attach(tstate);
     }
 
+    /* Sampling profiler */
+    if ((breaker & _PY_EVAL_SAMPLE_BIT) != 0) {
+        _Py_unset_eval_breaker_bit(tstate, _PY_EVAL_SAMPLE_BIT);
+        _PySamplingProfiler_TakeSample(tstate);
+    }
+
+    /* Memory purger */
+    if ((breaker & _PY_EVAL_PURGE_MEMORY_BIT) != 0) {
+        _Py_unset_eval_breaker_bit(tstate, _PY_EVAL_PURGE_MEMORY_BIT);
+        _PyMem_PurgeFreeMemory();
+    }
+
     /* Pending signals */
     if ((breaker & _PY_SIGNALS_PENDING_BIT) != 0) {
         if (handle_signals(tstate) != 0) {
@@ -70,12 +70,70 @@
 #define INSTRUCTION_STATS(op) ((void)0)
 #endif
 
-#if USE_COMPUTED_GOTOS
+/* Tail-calling interpreter.
+
+   With Py_TAIL_CALL_INTERP, each instruction and each label (see the label()
+   definitions at the end of bytecodes.c) is compiled to a function of its
+   own, rather than to a case in one huge _PyEval_EvalFrameDefault().
+   Dispatching to the next instruction is a guaranteed tail call through
+   INSTRUCTION_TABLE, so the C stack does not grow, and every handler gets
+   its own register allocation.  The interpreter state that lives in local
+   variables of _PyEval_EvalFrameDefault() in the other dispatch modes is
+   passed along in arguments instead (TAIL_CALL_PARAMS).
+
+   A call can only be made a tail call if it cannot refer to the caller's
+   locals, so an instruction must not keep the address of a local alive
+   across DISPATCH() or an ERROR_IF(): GCC rejects such calls outright
+   under musttail.  Instructions that pass an out-parameter or an argument
+   array to a C function keep it in a nested block that ends before the
+   next jump.
+*/
+#if Py_TAIL_CALL_INTERP
+#  if defined(__has_attribute) && __has_attribute(musttail)
+#    define Py_MUSTTAIL __attribute__((musttail))
+#  else
+#    error "The tail-calling interpreter requires the musttail attribute."
+#  endif
+#  if defined(__has_attribute) && __has_attribute(preserve_none)
+#    define Py_PRESERVE_NONE_CC __attribute__((preserve_none))
+#  else
+#    define Py_PRESERVE_NONE_CC
+#  endif
+#  ifdef Py_STATS
+#    define TAIL_CALL_PARAMS _PyInterpreterFrame *frame, _PyStackRef *stack_pointer, \
+                             PyThreadState *tstate, _Py_CODEUNIT *next_instr, \
+                             int opcode, int oparg, int lastopcode
+#    define TAIL_CALL_ARGS frame, stack_pointer, tstate, next_instr, \
+                           opcode, oparg, lastopcode
+#  else
+#    define TAIL_CALL_PARAMS _PyInterpreterFrame *frame, _PyStackRef *stack_pointer, \
+                             PyThreadState *tstate, _Py_CODEUNIT *next_instr, \
+                             int opcode, int oparg
+#    define TAIL_CALL_ARGS frame, stack_pointer, tstate, next_instr, \
+                           opcode, oparg
+#  endif
+   Py_PRESERVE_NONE_CC typedef PyObject *(*py_tail_call_funcptr)(TAIL_CALL_PARAMS);
+
+#  define TARGET(op) Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_##op(TAIL_CALL_PARAMS)
+#  define LABEL(name) TARGET(name)
+#  define DISPATCH_GOTO() \
+        do { \
+            Py_MUSTTAIL return (INSTRUCTION_TABLE[opcode])(TAIL_CALL_ARGS); \
+        } while (0)
+#  define JUMP_TO_LABEL(name) \
+        do { \
+            Py_MUSTTAIL return (_TAIL_CALL_##name)(TAIL_CALL_ARGS); \
+        } while (0)
+#elif USE_COMPUTED_GOTOS
 #  define TARGET(op) TARGET_##op:
+#  define LABEL(name) name:
 #  define DISPATCH_GOTO() goto *opcode_targets[opcode]
+#  define JUMP_TO_LABEL(name) goto name
 #else
 #  define TARGET(op) case op: TARGET_##op:
+#  define LABEL(name) name:
 #  define DISPATCH_GOTO() goto dispatch_opcode
+#  define JUMP_TO_LABEL(name) goto name
 #endif
 
 /* PRE_DISPATCH_GOTO() does lltrace if enabled. Normally a no-op */
@@ -89,9 +147,9 @@
 #if LLTRACE
 #define LLTRACE_RESUME_FRAME() \
 do { \
-    lltrace = maybe_lltrace_resume_frame(frame, &entry_frame, GLOBALS()); \
+    lltrace = maybe_lltrace_resume_frame(frame, GLOBALS()); \
     if (lltrace < 0) { \
-        goto exit_unwind; \
+        JUMP_TO_LABEL(exit_unwind); \
     } \
 } while (0)
 #else
@@ -128,11 +186,11 @@ do { \
         assert((NEW_FRAME)->previous == frame);         \
         frame = tstate->current_frame = (NEW_FRAME);     \
         CALL_STAT_INC(inlined_py_calls);                \
-        goto start_frame;                               \
+        JUMP_TO_LABEL(start_frame);                     \
     } while (0)
 
 // Use this instead of 'goto error' so Tier 2 can go to a different label
-#define GOTO_ERROR(LABEL) goto LABEL
+#define GOTO_ERROR(LABEL) JUMP_TO_LABEL(LABEL)
 
 /* Tuple access macros */
 
@@ -192,7 +250,13 @@ GETITEM(PyObject *v, Py_ssize_t i) {
 */
 
 #define PREDICT_ID(op)          PRED_##op
+#if Py_TAIL_CALL_INTERP
+/* There are no labels to jump to, so GO_TO_INSTRUCTION() restarts the
+ * target instruction from frame->instr_ptr instead. */
+#define PREDICTED(op)
+#else
 #define PREDICTED(op)           PREDICT_ID(op):
+#endif
 
 
 /* Stack manipulation macros */
@@ -238,7 +302,7 @@ GETITEM(PyObject *v, Py_ssize_t i) {
 #endif
 
 #define WITHIN_STACK_BOUNDS() \
-   (frame == &entry_frame || (STACK_LEVEL() >= 0 && STACK_LEVEL() <= STACK_SIZE()))
+   (frame->owner == FRAME_OWNED_BY_CSTACK || (STACK_LEVEL() >= 0 && STACK_LEVEL() <= STACK_SIZE()))
 
 /* Data access macros */
 #define FRAME_CO_CONSTS (_PyFrame_GetCode(frame)->co_consts)
@@ -259,7 +323,17 @@ GETITEM(PyObject *v, Py_ssize_t i) {
                                      GETLOCAL(i) = value; \
                                      PyStackRef_XCLOSE(tmp); } while (0)
 
+#if Py_TAIL_CALL_INTERP
+/* op may already have been expanded to its opcode number (by DEOPT_IF),
+ * so look the function up in the (constant) table rather than pasting. */
+#define GO_TO_INSTRUCTION(op) \
+    do { \
+        next_instr = frame->instr_ptr; \
+        Py_MUSTTAIL return (INSTRUCTION_TABLE[op])(TAIL_CALL_ARGS); \
+    } while (0)
+#else
 #define GO_TO_INSTRUCTION(op) goto PREDICT_ID(op)
+#endif
 
 #ifdef Py_STATS
 #define UPDATE_MISS_STATS(INSTNAME)                              \
@@ -344,7 +418,7 @@ do { \
         stack_pointer = _PyFrame_GetStackPointer(frame); \
         if (next_instr == NULL) { \
             next_instr = (dest)+1; \
-            goto error; \
+            JUMP_TO_LABEL(error); \
         } \
     } \
 } while (0);
@@ -388,7 +462,7 @@ do {                                                   \
     tstate->previous_executor = NULL;                  \
     frame = tstate->current_frame;                     \
     if (next_instr == NULL) {                          \
-        goto resume_with_error;                        \
+        JUMP_TO_LABEL(resume_with_error);              \
     }                                                  \
     stack_pointer = _PyFrame_GetStackPointer(frame);   \
     DISPATCH();                                        \
@@ -452,3 +526,15 @@ do { \
 #else
 #define CONVERSION_FAILED(NAME) (0)
 #endif
+
+/* Specialized instructions that mutate, or read several fields of, a shared
+ * object take its per-object lock. They never block: if the lock is
+ * contended they deoptimize and let the generic instruction take the
+ * critical section. */
+#ifdef Py_GIL_DISABLED
+#  define LOCK_OBJECT(op) PyMutex_LockFast(&(_PyObject_CAST(op))->ob_mutex._bits)
+#  define UNLOCK_OBJECT(op) PyMutex_Unlock(&(_PyObject_CAST(op))->ob_mutex)
+#else
+#  define LOCK_OBJECT(op) (1)
+#  define UNLOCK_OBJECT(op) ((void)0)
+#endif
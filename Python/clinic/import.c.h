@@ -618,6 +618,88 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(_imp__get_trace_cache__doc__,
+"_get_trace_cache($module, code, loaded, /)\n"
+"--\n"
+"\n"
+"Return the trace cache of code and its nested code objects.\n"
+"\n"
+"The result maps each code object with hot loops to their offsets.  It holds\n"
+"the loops that have executors, and those listed in loaded, a cache returned\n"
+"by an earlier call.  It is saved by the import system for -X trace_cache.");
+
+#define _IMP__GET_TRACE_CACHE_METHODDEF    \
+    {"_get_trace_cache", _PyCFunction_CAST(_imp__get_trace_cache), METH_FASTCALL, _imp__get_trace_cache__doc__},
+
+static PyObject *
+_imp__get_trace_cache_impl(PyObject *module, PyCodeObject *code,
+                           PyObject *loaded);
+
+static PyObject *
+_imp__get_trace_cache(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyCodeObject *code;
+    PyObject *loaded;
+
+    if (!_PyArg_CheckPositional("_get_trace_cache", nargs, 2, 2)) {
+        goto exit;
+    }
+    if (!PyObject_TypeCheck(args[0], &PyCode_Type)) {
+        _PyArg_BadArgument("_get_trace_cache", "argument 1", (&PyCode_Type)->tp_name, args[0]);
+        goto exit;
+    }
+    code = (PyCodeObject *)args[0];
+    if (!PyDict_Check(args[1])) {
+        _PyArg_BadArgument("_get_trace_cache", "argument 2", "dict", args[1]);
+        goto exit;
+    }
+    loaded = args[1];
+    return_value = _imp__get_trace_cache_impl(module, code, loaded);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_imp__load_trace_cache__doc__,
+"_load_trace_cache($module, code, cache, /)\n"
+"--\n"
+"\n"
+"Prime the loops of code that a dict from _get_trace_cache() lists as hot.");
+
+#define _IMP__LOAD_TRACE_CACHE_METHODDEF    \
+    {"_load_trace_cache", _PyCFunction_CAST(_imp__load_trace_cache), METH_FASTCALL, _imp__load_trace_cache__doc__},
+
+static PyObject *
+_imp__load_trace_cache_impl(PyObject *module, PyCodeObject *code,
+                            PyObject *cache);
+
+static PyObject *
+_imp__load_trace_cache(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyCodeObject *code;
+    PyObject *cache;
+
+    if (!_PyArg_CheckPositional("_load_trace_cache", nargs, 2, 2)) {
+        goto exit;
+    }
+    if (!PyObject_TypeCheck(args[0], &PyCode_Type)) {
+        _PyArg_BadArgument("_load_trace_cache", "argument 1", (&PyCode_Type)->tp_name, args[0]);
+        goto exit;
+    }
+    code = (PyCodeObject *)args[0];
+    if (!PyDict_Check(args[1])) {
+        _PyArg_BadArgument("_load_trace_cache", "argument 2", "dict", args[1]);
+        goto exit;
+    }
+    cache = args[1];
+    return_value = _imp__load_trace_cache_impl(module, code, cache);
+
+exit:
+    return return_value;
+}
+
 #ifndef _IMP_CREATE_DYNAMIC_METHODDEF
     #define _IMP_CREATE_DYNAMIC_METHODDEF
 #endif /* !defined(_IMP_CREATE_DYNAMIC_METHODDEF) */
@@ -625,4 +707,4 @@ exit:
 #ifndef _IMP_EXEC_DYNAMIC_METHODDEF
     #define _IMP_EXEC_DYNAMIC_METHODDEF
 #endif /* !defined(_IMP_EXEC_DYNAMIC_METHODDEF) */
-/*[clinic end generated code: output=d0e278351d6adbb1 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=2141642b1f88f13c input=a9049054013a1b77]*/
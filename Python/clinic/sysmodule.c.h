@@ -6,6 +6,7 @@ preserve
 #  include "pycore_gc.h"          // PyGC_Head
 #  include "pycore_runtime.h"     // _Py_ID()
 #endif
+#include "pycore_abstract.h"      // _PyNumber_Index()
 #include "pycore_modsupport.h"    // _PyArg_UnpackKeywords()
 #include "pycore_tuple.h"         // _PyTuple_FromArray()
 
@@ -1019,6 +1020,276 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(sys__enter_allocation_region__doc__,
+"_enter_allocation_region($module, /)\n"
+"--\n"
+"\n"
+"Start an allocation region.\n"
+"\n"
+"Until the matching _exit_allocation_region() call, small objects are\n"
+"bump-allocated from memory that is recycled in bulk once they are all\n"
+"freed.  Regions nest; only the outermost one has an effect.");
+
+#define SYS__ENTER_ALLOCATION_REGION_METHODDEF    \
+    {"_enter_allocation_region", (PyCFunction)sys__enter_allocation_region, METH_NOARGS, sys__enter_allocation_region__doc__},
+
+static PyObject *
+sys__enter_allocation_region_impl(PyObject *module);
+
+static PyObject *
+sys__enter_allocation_region(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return sys__enter_allocation_region_impl(module);
+}
+
+PyDoc_STRVAR(sys__exit_allocation_region__doc__,
+"_exit_allocation_region($module, /)\n"
+"--\n"
+"\n"
+"End an allocation region.\n"
+"\n"
+"Return the number of memory blocks allocated in the outermost region\n"
+"that are still alive.  These objects escaped the region: their memory is\n"
+"released when the last of them is freed.");
+
+#define SYS__EXIT_ALLOCATION_REGION_METHODDEF    \
+    {"_exit_allocation_region", (PyCFunction)sys__exit_allocation_region, METH_NOARGS, sys__exit_allocation_region__doc__},
+
+static PyObject *
+sys__exit_allocation_region_impl(PyObject *module);
+
+static PyObject *
+sys__exit_allocation_region(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return sys__exit_allocation_region_impl(module);
+}
+
+PyDoc_STRVAR(sys__purge_memory__doc__,
+"_purge_memory($module, /)\n"
+"--\n"
+"\n"
+"Return the free memory held by the allocator of this thread to the OS.\n"
+"\n"
+"Return the number of bytes released.");
+
+#define SYS__PURGE_MEMORY_METHODDEF    \
+    {"_purge_memory", (PyCFunction)sys__purge_memory, METH_NOARGS, sys__purge_memory__doc__},
+
+static Py_ssize_t
+sys__purge_memory_impl(PyObject *module);
+
+static PyObject *
+sys__purge_memory(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+    Py_ssize_t _return_value;
+
+    _return_value = sys__purge_memory_impl(module);
+    if ((_return_value == -1) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyLong_FromSsize_t(_return_value);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(sys__start_memory_purger__doc__,
+"_start_memory_purger($module, /, interval=1.0)\n"
+"--\n"
+"\n"
+"Return free memory to the OS every *interval* seconds.\n"
+"\n"
+"Every thread of the main interpreter purges the memory held by its\n"
+"allocator the next time it checks for pending events, so threads that\n"
+"are not running Python code purge when they resume.");
+
+#define SYS__START_MEMORY_PURGER_METHODDEF    \
+    {"_start_memory_purger", _PyCFunction_CAST(sys__start_memory_purger), METH_FASTCALL|METH_KEYWORDS, sys__start_memory_purger__doc__},
+
+static PyObject *
+sys__start_memory_purger_impl(PyObject *module, double interval);
+
+static PyObject *
+sys__start_memory_purger(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 1
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(interval), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"interval", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "_start_memory_purger",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[1];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 0;
+    double interval = 1.0;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
+            /*minpos*/ 0, /*maxpos*/ 1, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    if (PyFloat_CheckExact(args[0])) {
+        interval = PyFloat_AS_DOUBLE(args[0]);
+    }
+    else
+    {
+        interval = PyFloat_AsDouble(args[0]);
+        if (interval == -1.0 && PyErr_Occurred()) {
+            goto exit;
+        }
+    }
+skip_optional_pos:
+    return_value = sys__start_memory_purger_impl(module, interval);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(sys__stop_memory_purger__doc__,
+"_stop_memory_purger($module, /)\n"
+"--\n"
+"\n"
+"Stop the memory purger.\n"
+"\n"
+"If the memory purger is not running, this function has no effect.");
+
+#define SYS__STOP_MEMORY_PURGER_METHODDEF    \
+    {"_stop_memory_purger", (PyCFunction)sys__stop_memory_purger, METH_NOARGS, sys__stop_memory_purger__doc__},
+
+static PyObject *
+sys__stop_memory_purger_impl(PyObject *module);
+
+static PyObject *
+sys__stop_memory_purger(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return sys__stop_memory_purger_impl(module);
+}
+
+PyDoc_STRVAR(sys__get_memory_purger_stats__doc__,
+"_get_memory_purger_stats($module, /)\n"
+"--\n"
+"\n"
+"Return a dict describing the memory purger.\n"
+"\n"
+"\"running\" and \"interval\" describe the purger thread; \"interval\" is None\n"
+"when it is not running.  \"purges\" and\n"
+"\"bytes_released\" count all purges, including sys._purge_memory() calls.");
+
+#define SYS__GET_MEMORY_PURGER_STATS_METHODDEF    \
+    {"_get_memory_purger_stats", (PyCFunction)sys__get_memory_purger_stats, METH_NOARGS, sys__get_memory_purger_stats__doc__},
+
+static PyObject *
+sys__get_memory_purger_stats_impl(PyObject *module);
+
+static PyObject *
+sys__get_memory_purger_stats(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return sys__get_memory_purger_stats_impl(module);
+}
+
+PyDoc_STRVAR(sys__get_freelist_stats__doc__,
+"_get_freelist_stats($module, /)\n"
+"--\n"
+"\n"
+"Return a dict describing the freelists of the current interpreter.\n"
+"\n"
+"Each kind of freelist maps to a dict with its \"limit\", its current \"size\",\n"
+"and the number of allocations served by the freelist (\"hits\") or not\n"
+"(\"misses\"), and of deallocations that found it full (\"overflows\").  Kinds\n"
+"made of several freelists, like \"tuples\" with one per size, report their\n"
+"totals.");
+
+#define SYS__GET_FREELIST_STATS_METHODDEF    \
+    {"_get_freelist_stats", (PyCFunction)sys__get_freelist_stats, METH_NOARGS, sys__get_freelist_stats__doc__},
+
+static PyObject *
+sys__get_freelist_stats_impl(PyObject *module);
+
+static PyObject *
+sys__get_freelist_stats(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return sys__get_freelist_stats_impl(module);
+}
+
+PyDoc_STRVAR(sys__set_freelist_limit__doc__,
+"_set_freelist_limit($module, name, limit, /)\n"
+"--\n"
+"\n"
+"Set the maximum number of items of the freelists of the given kind.\n"
+"\n"
+"Items beyond the new limit are freed.  A limit of 0 disables the freelist.");
+
+#define SYS__SET_FREELIST_LIMIT_METHODDEF    \
+    {"_set_freelist_limit", _PyCFunction_CAST(sys__set_freelist_limit), METH_FASTCALL, sys__set_freelist_limit__doc__},
+
+static PyObject *
+sys__set_freelist_limit_impl(PyObject *module, const char *name,
+                             Py_ssize_t limit);
+
+static PyObject *
+sys__set_freelist_limit(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    const char *name;
+    Py_ssize_t limit;
+
+    if (!_PyArg_CheckPositional("_set_freelist_limit", nargs, 2, 2)) {
+        goto exit;
+    }
+    if (!PyUnicode_Check(args[0])) {
+        _PyArg_BadArgument("_set_freelist_limit", "argument 1", "str", args[0]);
+        goto exit;
+    }
+    Py_ssize_t name_length;
+    name = PyUnicode_AsUTF8AndSize(args[0], &name_length);
+    if (name == NULL) {
+        goto exit;
+    }
+    if (strlen(name) != (size_t)name_length) {
+        PyErr_SetString(PyExc_ValueError, "embedded null character");
+        goto exit;
+    }
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[1]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        limit = ival;
+    }
+    return_value = sys__set_freelist_limit_impl(module, name, limit);
+
+exit:
+    return return_value;
+}
+
 PyDoc_STRVAR(sys_getunicodeinternedsize__doc__,
 "getunicodeinternedsize($module, /, *, _only_immortal=False)\n"
 "--\n"
@@ -1481,6 +1752,170 @@ sys_is_stack_trampoline_active(PyObject *module, PyObject *Py_UNUSED(ignored))
     return sys_is_stack_trampoline_active_impl(module);
 }
 
+PyDoc_STRVAR(sys__start_sampling_profiler__doc__,
+"_start_sampling_profiler($module, /, interval=0.001)\n"
+"--\n"
+"\n"
+"Start sampling the stacks of running threads every *interval* seconds.\n"
+"\n"
+"Samples are taken when the sampled thread next checks for pending events,\n"
+"so only threads that are running Python code are sampled.  Use\n"
+"sys._dump_sampling_profile() to retrieve the samples.");
+
+#define SYS__START_SAMPLING_PROFILER_METHODDEF    \
+    {"_start_sampling_profiler", _PyCFunction_CAST(sys__start_sampling_profiler), METH_FASTCALL|METH_KEYWORDS, sys__start_sampling_profiler__doc__},
+
+static PyObject *
+sys__start_sampling_profiler_impl(PyObject *module, double interval);
+
+static PyObject *
+sys__start_sampling_profiler(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 1
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(interval), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"interval", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "_start_sampling_profiler",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[1];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 0;
+    double interval = 0.001;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
+            /*minpos*/ 0, /*maxpos*/ 1, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    if (PyFloat_CheckExact(args[0])) {
+        interval = PyFloat_AS_DOUBLE(args[0]);
+    }
+    else
+    {
+        interval = PyFloat_AsDouble(args[0]);
+        if (interval == -1.0 && PyErr_Occurred()) {
+            goto exit;
+        }
+    }
+skip_optional_pos:
+    return_value = sys__start_sampling_profiler_impl(module, interval);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(sys__stop_sampling_profiler__doc__,
+"_stop_sampling_profiler($module, /)\n"
+"--\n"
+"\n"
+"Stop the sampling profiler.\n"
+"\n"
+"The samples taken so far are kept until they are dumped.  If the\n"
+"sampling profiler is not running, this function has no effect.");
+
+#define SYS__STOP_SAMPLING_PROFILER_METHODDEF    \
+    {"_stop_sampling_profiler", (PyCFunction)sys__stop_sampling_profiler, METH_NOARGS, sys__stop_sampling_profiler__doc__},
+
+static PyObject *
+sys__stop_sampling_profiler_impl(PyObject *module);
+
+static PyObject *
+sys__stop_sampling_profiler(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return sys__stop_sampling_profiler_impl(module);
+}
+
+PyDoc_STRVAR(sys__dump_sampling_profile__doc__,
+"_dump_sampling_profile($module, /, clear=True)\n"
+"--\n"
+"\n"
+"Return the samples taken by the sampling profiler as folded stacks.\n"
+"\n"
+"The result maps each stack, formatted as semicolon-separated\n"
+"\"function (filename:lineno)\" frames with the outermost frame first,\n"
+"to the number of times it was sampled.  If *clear* is true, the\n"
+"samples are discarded.");
+
+#define SYS__DUMP_SAMPLING_PROFILE_METHODDEF    \
+    {"_dump_sampling_profile", _PyCFunction_CAST(sys__dump_sampling_profile), METH_FASTCALL|METH_KEYWORDS, sys__dump_sampling_profile__doc__},
+
+static PyObject *
+sys__dump_sampling_profile_impl(PyObject *module, int clear);
+
+static PyObject *
+sys__dump_sampling_profile(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 1
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(clear), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"clear", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "_dump_sampling_profile",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[1];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 0;
+    int clear = 1;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
+            /*minpos*/ 0, /*maxpos*/ 1, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    clear = PyObject_IsTrue(args[0]);
+    if (clear < 0) {
+        goto exit;
+    }
+skip_optional_pos:
+    return_value = sys__dump_sampling_profile_impl(module, clear);
+
+exit:
+    return return_value;
+}
+
 PyDoc_STRVAR(sys__getframemodulename__doc__,
 "_getframemodulename($module, /, depth=0)\n"
 "--\n"
@@ -1668,4 +2103,4 @@ exit:
 #ifndef SYS_GETANDROIDAPILEVEL_METHODDEF
     #define SYS_GETANDROIDAPILEVEL_METHODDEF
 #endif /* !defined(SYS_GETANDROIDAPILEVEL_METHODDEF) */
-/*[clinic end generated code: output=6d4f6cd20419b675 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=cca33fbf1856d928 input=a9049054013a1b77]*/
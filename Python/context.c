@@ -422,7 +422,7 @@ class _contextvars.Context "PyContext *" "&PyContext_Type"
 static inline PyContext *
 _context_alloc(void)
 {
-    PyContext *ctx = _Py_FREELIST_POP(PyContext, contexts);
+    PyContext *ctx = _Py_FREELIST_POP_GC(PyContext, contexts);
     if (ctx == NULL) {
         ctx = PyObject_GC_New(PyContext, &PyContext_Type);
         if (ctx == NULL) {
@@ -164,6 +164,8 @@ _PyGC_InitState(GCState *gcstate)
     INIT_HEAD(gcstate->permanent_generation);
 
 #undef INIT_HEAD
+    // Not used by this collector, but reported by gc.get_parallel().
+    gcstate->parallel_threshold = _PyGC_PARALLEL_THRESHOLD;
 }
 
 
@@ -475,12 +477,14 @@ gc_list_validate_space(PyGC_Head *head, int space) {
 
 /* Set all gc_refs = ob_refcnt.  After this, gc_refs is > 0 and
  * PREV_MASK_COLLECTING bit is set for all objects in containers.
+ * Return the number of objects left in containers.
  */
-static void
+static Py_ssize_t
 update_refs(PyGC_Head *containers)
 {
     PyGC_Head *next;
     PyGC_Head *gc = GC_NEXT(containers);
+    Py_ssize_t size = 0;
 
     while (gc != containers) {
         next = GC_NEXT(gc);
@@ -511,7 +515,9 @@ update_refs(PyGC_Head *containers)
          */
         _PyObject_ASSERT(op, gc_get_refs(gc) != 0);
         gc = next;
+        size++;
     }
+    return size;
 }
 
 /* A traversal callback for subtract_refs. */
@@ -1155,6 +1161,9 @@ delete_garbage(PyThreadState *tstate, GCState *gcstate,
    objects that were initially marked as unreachable but are referred transitively
    by the reachable objects (the ones with strictly positive reference count).
 
+If "stats" is not NULL, the time spent in each step and the number of objects
+in "base" are added to it.
+
 Contracts:
 
     * The "base" has to be a valid list with no mask set.
@@ -1168,15 +1177,28 @@ flag is cleared (for example, by using 'clear_unreachable_mask' function or
 by a call to 'move_legacy_finalizers'), the 'unreachable' list is not a normal
 list and we can not use most gc_list_* functions for it. */
 static inline void
-deduce_unreachable(PyGC_Head *base, PyGC_Head *unreachable) {
+deduce_unreachable(PyGC_Head *base, PyGC_Head *unreachable,
+                   struct gc_collection_stats *stats)
+{
     validate_list(base, collecting_clear_unreachable_clear);
+    PyTime_t start = 0;
+    if (stats != NULL) {
+        (void)PyTime_PerfCounterRaw(&start);
+    }
     /* Using ob_refcnt and gc_refs, calculate which objects in the
      * container set are reachable from outside the set (i.e., have a
      * refcount greater than 0 when all the references within the
      * set are taken into account).
      */
-    update_refs(base);  // gc_prev is used for gc_refs
+    Py_ssize_t size = update_refs(base);  // gc_prev is used for gc_refs
+    if (stats != NULL) {
+        stats->visited += size;
+        _PyGC_EndPhase(stats->phase_times, _PyGC_PHASE_UPDATE_REFS, &start);
+    }
     subtract_refs(base);
+    if (stats != NULL) {
+        _PyGC_EndPhase(stats->phase_times, _PyGC_PHASE_SUBTRACT_REFS, &start);
+    }
 
     /* Leave everything reachable from outside base in base, and move
      * everything else (in base) to unreachable.
@@ -1214,6 +1236,9 @@ deduce_unreachable(PyGC_Head *base, PyGC_Head *unreachable) {
      * worth complicating the code to speed just a little.
      */
     move_unreachable(base, unreachable);  // gc_prev is pointer again
+    if (stats != NULL) {
+        _PyGC_EndPhase(stats->phase_times, _PyGC_PHASE_MOVE_UNREACHABLE, &start);
+    }
     validate_list(base, collecting_clear_unreachable_clear);
     validate_list(unreachable, collecting_set_unreachable_set);
 }
@@ -1243,7 +1268,7 @@ handle_resurrected_objects(PyGC_Head *unreachable, PyGC_Head* still_unreachable,
     // have the PREV_MARK_COLLECTING set, but the objects are going to be
     // removed so we can skip the expense of clearing the flag.
     PyGC_Head* resurrected = unreachable;
-    deduce_unreachable(resurrected, still_unreachable);
+    deduce_unreachable(resurrected, still_unreachable, NULL);
     clear_unreachable_mask(still_unreachable);
 
     // Move the resurrected objects to the old generation for future collection.
@@ -1295,9 +1320,14 @@ gc_list_set_space(PyGC_Head *list, int space)
 static void
 add_stats(GCState *gcstate, int gen, struct gc_collection_stats *stats)
 {
-    gcstate->generation_stats[gen].collected += stats->collected;
-    gcstate->generation_stats[gen].uncollectable += stats->uncollectable;
-    gcstate->generation_stats[gen].collections += 1;
+    struct gc_generation_stats *gen_stats = &gcstate->generation_stats[gen];
+    gen_stats->collected += stats->collected;
+    gen_stats->uncollectable += stats->uncollectable;
+    gen_stats->collections += 1;
+    gen_stats->visited += stats->visited;
+    for (int i = 0; i < _PyGC_PHASES; i++) {
+        gen_stats->phase_times[i] += stats->phase_times[i];
+    }
 }
 
 static void
@@ -1433,6 +1463,67 @@ completed_cycle(GCState *gcstate)
     gcstate->work_to_do = 0;
 }
 
+/* Time-budgeted increments
+ *
+ * By default an increment scans work_to_do objects of the old space,
+ * however long that takes.  When gc.set_increment_budget() sets a target
+ * duration, the increment also stops growing once it holds as many
+ * objects as were scanned in that much time by recent increments
+ * (increment_rate, a moving average).  The young objects merged into the
+ * increment count against the budget, but each increment still scans at
+ * least one region of the old space so that the cycle makes progress.
+ *
+ * Work that does not fit in the budget stays in work_to_do.  To catch up
+ * the next increment is paced by allocations: young.count is pre-charged
+ * so that the next collection comes sooner the larger the backlog is
+ * relative to the budget, and never later than a full young threshold.
+ */
+
+/* Weight of the latest increment in increment_rate */
+#define INCREMENT_RATE_WEIGHT 0.25
+
+static Py_ssize_t
+increment_budget_objects(GCState *gcstate)
+{
+    if (gcstate->increment_budget <= 0 || gcstate->increment_rate <= 0) {
+        return 0;
+    }
+    double objects = gcstate->increment_rate * gcstate->increment_budget / 1e9;
+    if (objects >= (double)PY_SSIZE_T_MAX) {
+        return 0;
+    }
+    return Py_MAX((Py_ssize_t)objects, 1);
+}
+
+static void
+update_increment_rate(GCState *gcstate, Py_ssize_t objects, PyTime_t elapsed)
+{
+    if (objects <= 0 || elapsed <= 0) {
+        return;
+    }
+    double rate = (double)objects * 1e9 / (double)elapsed;
+    if (gcstate->increment_rate <= 0) {
+        gcstate->increment_rate = rate;
+    }
+    else {
+        gcstate->increment_rate += INCREMENT_RATE_WEIGHT *
+                                   (rate - gcstate->increment_rate);
+    }
+}
+
+static void
+pace_next_increment(GCState *gcstate, Py_ssize_t budget_objects)
+{
+    Py_ssize_t threshold = gcstate->young.threshold;
+    if (budget_objects <= 0 || gcstate->work_to_do <= 0 || threshold <= 0) {
+        return;
+    }
+    double share = (double)budget_objects /
+                   ((double)budget_objects + (double)gcstate->work_to_do);
+    Py_ssize_t delay = Py_MAX((Py_ssize_t)(threshold * share), threshold / 8);
+    gcstate->young.count = (int)(threshold - delay);
+}
+
 static void
 gc_collect_increment(PyThreadState *tstate, struct gc_collection_stats *stats)
 {
@@ -1446,6 +1537,12 @@ gc_collect_increment(PyThreadState *tstate, struct gc_collection_stats *stats)
     if (scale_factor < 1) {
         scale_factor = 1;
     }
+    PyTime_t start = 0;
+    if (gcstate->increment_budget > 0) {
+        (void)PyTime_PerfCounterRaw(&start);
+    }
+    Py_ssize_t budget_objects = increment_budget_objects(gcstate);
+    Py_ssize_t young_size = Py_MAX(gcstate->young.count, 0);
     gc_list_merge(&gcstate->young.head, &increment);
     gcstate->young.count = 0;
     gc_list_validate_space(&increment, gcstate->visited_space);
@@ -1454,6 +1551,10 @@ gc_collect_increment(PyThreadState *tstate, struct gc_collection_stats *stats)
         if (gc_list_is_empty(not_visited)) {
             break;
         }
+        if (budget_objects > 0 && increment_size > 0 &&
+            young_size + increment_size >= budget_objects) {
+            break;
+        }
         PyGC_Head *gc = _PyGCHead_NEXT(not_visited);
         gc_list_move(gc, &increment);
         increment_size++;
@@ -1475,6 +1576,12 @@ gc_collect_increment(PyThreadState *tstate, struct gc_collection_stats *stats)
     if (gc_list_is_empty(not_visited)) {
         completed_cycle(gcstate);
     }
+    if (gcstate->increment_budget > 0) {
+        PyTime_t end;
+        (void)PyTime_PerfCounterRaw(&end);
+        update_increment_rate(gcstate, young_size + increment_size, end - start);
+        pace_next_increment(gcstate, budget_objects);
+    }
 }
 
 
@@ -1526,7 +1633,9 @@ gc_collect_region(PyThreadState *tstate,
     assert(!_PyErr_Occurred(tstate));
 
     gc_list_init(&unreachable);
-    deduce_unreachable(from, &unreachable);
+    deduce_unreachable(from, &unreachable, stats);
+    PyTime_t start;
+    (void)PyTime_PerfCounterRaw(&start);
     validate_consistent_old_space(from);
     if (untrack & UNTRACK_TUPLES) {
         untrack_tuples(from);
@@ -1576,6 +1685,7 @@ gc_collect_region(PyThreadState *tstate,
     PyGC_Head final_unreachable;
     gc_list_init(&final_unreachable);
     handle_resurrected_objects(&unreachable, &final_unreachable, to);
+    _PyGC_EndPhase(stats->phase_times, _PyGC_PHASE_FINALIZE, &start);
 
     /* Call tp_clear on objects in the final_unreachable set.  This will cause
     * the reference cycles to be broken.  It may also cause some objects
@@ -1598,6 +1708,7 @@ gc_collect_region(PyThreadState *tstate,
      * this if they insist on creating this type of structure.
      */
     handle_legacy_finalizers(tstate, gcstate, &finalizers, to);
+    _PyGC_EndPhase(stats->phase_times, _PyGC_PHASE_DELETE, &start);
     gc_list_validate_space(to, gcstate->visited_space);
     validate_list(to, collecting_clear_unreachable_clear);
 }
@@ -1615,10 +1726,12 @@ do_gc_callback(GCState *gcstate, const char *phase,
     assert(PyList_CheckExact(gcstate->callbacks));
     PyObject *info = NULL;
     if (PyList_GET_SIZE(gcstate->callbacks) != 0) {
-        info = Py_BuildValue("{sisnsn}",
+        info = Py_BuildValue("{sisnsnsnsd}",
             "generation", generation,
             "collected", stats->collected,
-            "uncollectable", stats->uncollectable);
+            "uncollectable", stats->uncollectable,
+            "visited", stats->visited,
+            "duration", PyTime_AsSecondsDouble(stats->duration));
         if (info == NULL) {
             PyErr_FormatUnraisable("Exception ignored on invoking gc callbacks");
             return;
@@ -1784,6 +1897,33 @@ _PyGC_GetFreezeCount(PyInterpreterState *interp)
     return gc_list_size(&gcstate->permanent_generation.head);
 }
 
+Py_ssize_t
+_PyGC_ImmortalizeHeap(PyInterpreterState *interp)
+{
+    GCState *gcstate = &interp->gc;
+    PyGC_Head heap;
+    gc_list_init(&heap);
+    gc_list_merge(&gcstate->young.head, &heap);
+    gcstate->young.count = 0;
+    for (int i = 0; i < 2; i++) {
+        gc_list_merge(&gcstate->old[i].head, &heap);
+        gcstate->old[i].count = 0;
+    }
+    gc_list_merge(&gcstate->permanent_generation.head, &heap);
+
+    Py_ssize_t count = 0;
+    while (!gc_list_is_empty(&heap)) {
+        PyObject *op = FROM_GC(GC_NEXT(&heap));
+        // Untracks op, unlinking it from the heap list.
+        count += _PyObject_Immortalize(op);
+        /* Immortal objects are never deallocated, so they no longer count
+           towards the heap size that paces incremental collections. */
+        gcstate->heap_size--;
+    }
+    validate_old(gcstate);
+    return count;
+}
+
 /* C API for controlling the state of the garbage collector */
 int
 PyGC_Enable(void)
@@ -1851,6 +1991,8 @@ _PyGC_Collect(PyThreadState *tstate, int generation, _PyGC_Reason reason)
         PyDTrace_GC_START(generation);
     }
     PyObject *exc = _PyErr_GetRaisedException(tstate);
+    PyTime_t start, end;
+    (void)PyTime_PerfCounterRaw(&start);
     switch(generation) {
         case 0:
             gc_collect_young(tstate, &stats);
@@ -1864,6 +2006,10 @@ _PyGC_Collect(PyThreadState *tstate, int generation, _PyGC_Reason reason)
         default:
             Py_UNREACHABLE();
     }
+    (void)PyTime_PerfCounterRaw(&end);
+    stats.duration = end - start;
+    gcstate->generation_stats[generation].durations[
+        _PyGC_DurationBucket(stats.duration)]++;
     if (PyDTrace_GC_DONE_ENABLED()) {
         PyDTrace_GC_DONE(stats.uncollectable + stats.collected);
     }
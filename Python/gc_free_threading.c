@@ -9,7 +9,9 @@
 #include "pycore_interp.h"        // PyInterpreterState.gc
 #include "pycore_object.h"
 #include "pycore_object_alloc.h"  // _PyObject_MallocWithType()
+#include "pycore_obmalloc.h"      // _PyObject_VirtualAlloc()
 #include "pycore_object_stack.h"
+#include "pycore_parking_lot.h"   // _PyParkingLot_Park()
 #include "pycore_pyerrors.h"
 #include "pycore_pystate.h"       // _PyThreadState_GET()
 #include "pycore_tstate.h"        // _PyThreadStateImpl
@@ -17,6 +19,13 @@
 #include "pydtrace.h"
 #include "pycore_uniqueid.h"      // _PyObject_MergeThreadLocalRefcounts()
 
+#ifdef HAVE_UNISTD_H
+#  include <unistd.h>             // sysconf()
+#endif
+#ifdef HAVE_SCHED_H
+#  include <sched.h>              // sched_getaffinity()
+#endif
+
 #ifdef Py_GIL_DISABLED
 
 typedef struct _gc_runtime_state GCState;
@@ -33,6 +42,9 @@ typedef struct _gc_runtime_state GCState;
 // Automatically choose the generation that needs collecting.
 #define GENERATION_AUTO (-1)
 
+// Maximum number of threads marking the heap in parallel.
+#define GC_MAX_PARALLEL_THREADS 64
+
 // A linked list of objects using the `ob_tid` field as the next pointer.
 // The linked list pointers are distinct from any real thread ids, because the
 // thread ids returned by _Py_ThreadId() are also pointers to distinct objects.
@@ -56,9 +68,18 @@ struct collection_state {
     PyInterpreterState *interp;
     GCState *gcstate;
     _PyGC_Reason reason;
+    // True if only the pages with new objects are collected
+    int young;
+    // True if gc_refs were computed by the page passes (see below)
+    int page_passes;
     Py_ssize_t collected;
     Py_ssize_t uncollectable;
     Py_ssize_t long_lived_total;
+    // Number of surviving objects that had not survived a collection before
+    Py_ssize_t long_lived_new;
+    // Number of objects examined by scan_heap_visitor()
+    Py_ssize_t visited;
+    PyTime_t phase_times[_PyGC_PHASES];
     struct worklist unreachable;
     struct worklist legacy_finalizers;
     struct worklist wrcb_to_call;
@@ -284,8 +305,8 @@ op_from_block(void *block, void *arg, bool include_frozen)
 }
 
 static int
-gc_visit_heaps_lock_held(PyInterpreterState *interp, mi_block_visit_fun *visitor,
-                         struct visitor_args *arg)
+gc_visit_heaps_lock_held(PyInterpreterState *interp, bool visit_blocks,
+                         mi_block_visit_fun *visitor, struct visitor_args *arg)
 {
     // Offset of PyObject header from start of memory block.
     Py_ssize_t offset_base = 0;
@@ -306,12 +327,12 @@ gc_visit_heaps_lock_held(PyInterpreterState *interp, mi_block_visit_fun *visitor
         }
 
         arg->offset = offset_base;
-        if (!mi_heap_visit_blocks(&m->heaps[_Py_MIMALLOC_HEAP_GC], true,
+        if (!mi_heap_visit_blocks(&m->heaps[_Py_MIMALLOC_HEAP_GC], visit_blocks,
                                   visitor, arg)) {
             return -1;
         }
         arg->offset = offset_pre;
-        if (!mi_heap_visit_blocks(&m->heaps[_Py_MIMALLOC_HEAP_GC_PRE], true,
+        if (!mi_heap_visit_blocks(&m->heaps[_Py_MIMALLOC_HEAP_GC_PRE], visit_blocks,
                                   visitor, arg)) {
             return -1;
         }
@@ -320,12 +341,12 @@ gc_visit_heaps_lock_held(PyInterpreterState *interp, mi_block_visit_fun *visitor
     // visit blocks in the per-interpreter abandoned pool (from dead threads)
     mi_abandoned_pool_t *pool = &interp->mimalloc.abandoned_pool;
     arg->offset = offset_base;
-    if (!_mi_abandoned_pool_visit_blocks(pool, _Py_MIMALLOC_HEAP_GC, true,
+    if (!_mi_abandoned_pool_visit_blocks(pool, _Py_MIMALLOC_HEAP_GC, visit_blocks,
                                          visitor, arg)) {
         return -1;
     }
     arg->offset = offset_pre;
-    if (!_mi_abandoned_pool_visit_blocks(pool, _Py_MIMALLOC_HEAP_GC_PRE, true,
+    if (!_mi_abandoned_pool_visit_blocks(pool, _Py_MIMALLOC_HEAP_GC_PRE, visit_blocks,
                                          visitor, arg)) {
         return -1;
     }
@@ -345,7 +366,7 @@ gc_visit_heaps(PyInterpreterState *interp, mi_block_visit_fun *visitor,
 
     int err;
     HEAD_LOCK(&_PyRuntime);
-    err = gc_visit_heaps_lock_held(interp, visitor, arg);
+    err = gc_visit_heaps_lock_held(interp, true, visitor, arg);
     HEAD_UNLOCK(&_PyRuntime);
     return err;
 }
@@ -358,7 +379,8 @@ gc_visit_stackref(_PyStackRef stackref)
     // being dead already.
     if (PyStackRef_IsDeferred(stackref) && !PyStackRef_IsNull(stackref)) {
         PyObject *obj = PyStackRef_AsPyObjectBorrow(stackref);
-        if (_PyObject_GC_IS_TRACKED(obj)) {
+        // Only objects in the collection have gc_refs.
+        if (_PyObject_GC_IS_TRACKED(obj) && gc_is_unreachable(obj)) {
             gc_add_refs(obj, 1);
         }
     }
@@ -618,6 +640,671 @@ restore_refs(const mi_heap_t *heap, const mi_heap_area_t *area,
     return true;
 }
 
+/* Parallel marking
+ * ================
+ *
+ * When the heap is large, computing gc_refs and marking reachable objects
+ * is split across several threads.  The pages of the GC heaps are first
+ * collected into an array, and each thread then repeatedly claims the next
+ * page that no thread has visited yet.  The work is done in three passes:
+ *
+ *   1. init_refs_parallel() sets gc_refs to the refcount of each object.
+ *   2. subtract_refs_parallel() subtracts internal references.
+ *   3. mark_heap_visitor_parallel() marks objects with gc_refs > 0, and
+ *      everything reachable from them, as reachable.
+ *
+ * update_refs() initializes gc_refs lazily, on the first visit of either
+ * the object or a reference to it.  Here, passes 1 and 2 are separate so
+ * that each object is written only by the thread that owns its page,
+ * apart from the atomic decrements of gc_refs in pass 2.  In pass 3 the
+ * unreachable bit is cleared with an atomic read-modify-write, and only
+ * the thread that cleared it traverses the object.
+ *
+ * Each thread marks from its own _PyObjectStack.  While some threads are
+ * idle, threads with more than one chunk of pending objects move full
+ * chunks to a shared stack, and idle threads take them from there.
+ * Marking is done once every thread is idle and the shared stack is empty.
+ *
+ * The helper threads are started by the first parallel collection and
+ * then stay parked between passes (see gc_run_parallel_pass()).  A pass
+ * ends once every helper has reported back, which is the barrier between
+ * passes.  They have no thread state: they run while the world is stopped
+ * and must not take part in stopping it.
+ * So they must not use anything that needs one, such as freelists or
+ * _PyDict_MaybeUntrack() (which asserts on the thread state in debug
+ * builds).  Dicts are instead untracked by scan_heap_visitor().  Nor can
+ * they use PyMem_RawMalloc(): its hooks, tracemalloc's among them, may
+ * attach a thread state.  The stack chunks come from a pool that is
+ * backed by the arena allocator and released at the end of the
+ * collection.
+ */
+
+/* Young collections
+ * =================
+ *
+ * Allocating a GC object sets the gc_young flag of its mimalloc page.  A
+ * young collection (generations 0 and 1) only collects the pages with the
+ * flag set, and runs the passes above on them, even on a single thread.
+ * Full collections clear the flag on every page.
+ *
+ * Any set of objects can be collected this way: the first pass marks
+ * every object in the set as unreachable, and only those objects have
+ * their gc_refs updated or are marked reachable later on.  References
+ * from objects outside the set are never subtracted, so the objects they
+ * refer to keep gc_refs > 0.  The refcounts thus play the role of a
+ * remembered set, and no write barrier is needed.  Old objects that share
+ * a page with new ones are collected too, which is merely extra work.
+ * Cycles that include an old object on another page are left to the next
+ * full collection, which happens once the objects that survived young
+ * collections have grown the heap by a quarter.
+ */
+
+struct gc_page {
+    mi_page_t *page;
+    mi_heap_area_t area;
+    size_t offset;  // offset of PyObject from start of block
+};
+
+struct gc_page_list {
+    struct visitor_args base;
+    int young;              // only collect pages flagged as gc_young
+    struct gc_page *pages;
+    Py_ssize_t size;
+    Py_ssize_t capacity;
+    Py_ssize_t nblocks;     // number of allocated blocks on the pages
+};
+
+enum gc_parallel_pass {
+    GC_PASS_INIT_REFS,
+    GC_PASS_SUBTRACT_REFS,
+    GC_PASS_MARK,
+};
+
+struct gc_parallel_state {
+    struct gc_page_list *pages;
+    enum gc_parallel_pass pass;
+    Py_ssize_t next_page;   // index of the next page to visit (atomic)
+    int failed;             // set on memory allocation failure (atomic)
+
+    // Work sharing during GC_PASS_MARK
+    PyMutex mutex;
+    _PyObjectStack shared;  // protected by mutex
+    _PyObjectStack free_chunks;  // protected by mutex
+    int nthreads;           // protected by mutex
+    int nidle;              // written with mutex held, read atomically
+};
+
+struct gc_worker {
+    struct visitor_args base;
+    struct gc_parallel_state *par;
+    _PyObjectStack stack;
+};
+
+// A helper thread of parallel collections.  It stays parked until
+// gc_run_parallel_pass() sets `run`, and clears it when done with the pass.
+struct gc_helper {
+    struct _gc_helper_pool *pool;
+    PyThread_handle_t handle;
+    int run;                // atomic
+    // The helper's current thread state while it runs.  Code called by
+    // tp_traverse may need one, e.g. Py_INCREF() counts references in it in
+    // debug builds.  It is not linked into the interpreter's thread list, so
+    // stop-the-world doesn't wait on helpers and os.fork() doesn't see them.
+    _PyThreadStateImpl tstate;
+};
+
+struct _gc_helper_pool {
+    struct gc_parallel_state *par;  // the pass being run
+    int stop;               // set when the helpers must exit
+    int running;            // helpers not done with the pass yet (atomic)
+    int nhelpers;           // number of helper threads started
+    struct gc_helper helpers[GC_MAX_PARALLEL_THREADS - 1];
+};
+
+// The number of CPUs usable by the process, like os.process_cpu_count().
+static int
+gc_cpu_count(void)
+{
+    int ncpu = _Py_GetConfig()->cpu_count;
+    if (ncpu > 0) {
+        return ncpu;
+    }
+#if defined(HAVE_SCHED_SETAFFINITY) && defined(CPU_COUNT)
+    cpu_set_t set;
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        return CPU_COUNT(&set);
+    }
+    // More CPUs than fit in a cpu_set_t: fall back to counting them all.
+#endif
+#if defined(MS_WINDOWS) && defined(MS_WINDOWS_DESKTOP)
+    ncpu = (int)GetActiveProcessorCount(ALL_PROCESSOR_GROUPS);
+#elif defined(HAVE_SYSCONF) && defined(_SC_NPROCESSORS_ONLN)
+    ncpu = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    return ncpu > 0 ? ncpu : 1;
+}
+
+// Return the number of threads to use for computing gc_refs and marking
+// about `nobjects` objects.
+static int
+gc_parallel_threads(GCState *gcstate, Py_ssize_t nobjects)
+{
+    if (nobjects < gcstate->parallel_threshold) {
+        return 1;
+    }
+    int nthreads = gcstate->parallel_threads;
+    if (nthreads <= 0) {
+        nthreads = gc_cpu_count();
+    }
+    return Py_MIN(nthreads, GC_MAX_PARALLEL_THREADS);
+}
+
+static bool
+collect_page(const mi_heap_t *heap, const mi_heap_area_t *area,
+             void *block, size_t block_size, void *args)
+{
+    struct gc_page_list *list = (struct gc_page_list *)args;
+    assert(block == NULL);
+    mi_page_t *page = _mi_ptr_page(area->blocks);
+    if (list->young && !page->gc_young) {
+        return true;
+    }
+    page->gc_young = 0;
+    if (area->used == 0) {
+        return true;
+    }
+    if (list->size == list->capacity) {
+        Py_ssize_t capacity = list->capacity ? list->capacity * 2 : 256;
+        // Not PyMem_Malloc(): mimalloc must not be used during heap traversal
+        struct gc_page *pages = PyMem_RawRealloc(
+            list->pages, capacity * sizeof(struct gc_page));
+        if (pages == NULL) {
+            return false;
+        }
+        list->pages = pages;
+        list->capacity = capacity;
+    }
+    struct gc_page *p = &list->pages[list->size++];
+    p->page = page;
+    p->area = *area;
+    p->offset = list->base.offset;
+    list->nblocks += area->used;
+    return true;
+}
+
+// Collect the non-empty pages of the GC heaps, or only those with new
+// objects if list->young is set, and clear their gc_young flags.  This
+// also collects the pages' free lists, so that the pages can then be
+// visited concurrently.
+static int
+gc_collect_pages(PyInterpreterState *interp, struct gc_page_list *list)
+{
+    assert(interp->stoptheworld.world_stopped);
+    int err;
+    HEAD_LOCK(&_PyRuntime);
+    err = gc_visit_heaps_lock_held(interp, false, &collect_page, &list->base);
+    HEAD_UNLOCK(&_PyRuntime);
+    return err;
+}
+
+static bool
+clear_young_page(const mi_heap_t *heap, const mi_heap_area_t *area,
+                 void *block, size_t block_size, void *args)
+{
+    _mi_ptr_page(area->blocks)->gc_young = 0;
+    return true;
+}
+
+// Visit the objects on the collected pages on the calling thread.
+static int
+gc_visit_pages(struct gc_page_list *list, mi_block_visit_fun *visitor,
+               struct visitor_args *arg)
+{
+    for (Py_ssize_t i = 0; i < list->size; i++) {
+        struct gc_page *p = &list->pages[i];
+        arg->offset = p->offset;
+        if (!_mi_heap_area_visit_blocks(&p->area, p->page, visitor, arg)) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+// The parallel counterpart of the first half of update_refs().
+static bool
+init_refs_parallel(const mi_heap_t *heap, const mi_heap_area_t *area,
+                   void *block, size_t block_size, void *args)
+{
+    PyObject *op = op_from_block(block, args, false);
+    if (op == NULL) {
+        return true;
+    }
+
+    // Exclude immortal objects from garbage collection
+    if (_Py_IsImmortal(op)) {
+        op->ob_tid = 0;
+        _PyObject_GC_UNTRACK(op);
+        return true;
+    }
+
+    Py_ssize_t refcount = Py_REFCNT(op);
+    if (_PyObject_HasDeferredRefcount(op)) {
+        refcount -= _Py_REF_DEFERRED;
+    }
+    _PyObject_ASSERT(op, refcount >= 0);
+
+    if (refcount > 0 && !_PyObject_HasDeferredRefcount(op) &&
+        PyTuple_CheckExact(op))
+    {
+        _PyTuple_MaybeUntrack(op);
+        if (!_PyObject_GC_IS_TRACKED(op)) {
+            return true;
+        }
+    }
+
+    // Other threads read the GC bits of this object concurrently.
+    _PyObject_SET_GC_BITS(op, _PyGC_BITS_UNREACHABLE);
+    op->ob_tid = (uintptr_t)refcount;
+    return true;
+}
+
+static int
+visit_decref_parallel(PyObject *op, void *arg)
+{
+    // Only objects initialized by init_refs_parallel() have the bit set.
+    if (_PyObject_HAS_GC_BITS(op, _PyGC_BITS_UNREACHABLE)) {
+        _Py_atomic_add_uintptr(&op->ob_tid, (uintptr_t)-1);
+    }
+    return 0;
+}
+
+// The parallel counterpart of the second half of update_refs().
+static bool
+subtract_refs_parallel(const mi_heap_t *heap, const mi_heap_area_t *area,
+                       void *block, size_t block_size, void *args)
+{
+    PyObject *op = op_from_block(block, args, false);
+    if (op == NULL || !gc_is_unreachable(op)) {
+        return true;
+    }
+    Py_TYPE(op)->tp_traverse(op, visit_decref_parallel, NULL);
+    return true;
+}
+
+// Clear the unreachable bit.  Return true if this thread cleared it.
+static inline int
+gc_try_clear_unreachable(PyObject *op)
+{
+    uint8_t old = _Py_atomic_and_uint8(&op->ob_gc_bits,
+                                       (uint8_t)~_PyGC_BITS_UNREACHABLE);
+    return (old & _PyGC_BITS_UNREACHABLE) != 0;
+}
+
+static _PyObjectStackChunk *
+gc_chunk_new(struct gc_parallel_state *par)
+{
+    PyMutex_LockFlags(&par->mutex, _Py_LOCK_DONT_DETACH);
+    _PyObjectStackChunk *chunk = par->free_chunks.head;
+    if (chunk != NULL) {
+        par->free_chunks.head = chunk->prev;
+    }
+    PyMutex_Unlock(&par->mutex);
+    if (chunk == NULL) {
+        chunk = _PyObject_VirtualAlloc(sizeof(_PyObjectStackChunk));
+    }
+    return chunk;
+}
+
+static void
+gc_chunk_free(struct gc_parallel_state *par, _PyObjectStackChunk *chunk)
+{
+    PyMutex_LockFlags(&par->mutex, _Py_LOCK_DONT_DETACH);
+    chunk->prev = par->free_chunks.head;
+    par->free_chunks.head = chunk;
+    PyMutex_Unlock(&par->mutex);
+}
+
+// Like _PyObjectStack_Push(), but with a chunk from the pool.
+static int
+gc_worker_push(struct gc_worker *worker, PyObject *op)
+{
+    _PyObjectStackChunk *chunk = worker->stack.head;
+    if (chunk == NULL || chunk->n == _Py_OBJECT_STACK_CHUNK_SIZE) {
+        chunk = gc_chunk_new(worker->par);
+        if (chunk == NULL) {
+            return -1;
+        }
+        chunk->prev = worker->stack.head;
+        chunk->n = 0;
+        worker->stack.head = chunk;
+    }
+    chunk->objs[chunk->n++] = op;
+    return 0;
+}
+
+// Like _PyObjectStack_Pop(), but returns empty chunks to the pool.
+static PyObject *
+gc_worker_pop(struct gc_worker *worker)
+{
+    _PyObjectStackChunk *chunk = worker->stack.head;
+    if (chunk == NULL) {
+        return NULL;
+    }
+    assert(chunk->n > 0);
+    PyObject *op = chunk->objs[--chunk->n];
+    if (chunk->n == 0) {
+        worker->stack.head = chunk->prev;
+        gc_chunk_free(worker->par, chunk);
+    }
+    return op;
+}
+
+static void
+gc_stack_release(struct gc_parallel_state *par, _PyObjectStack *stack)
+{
+    while (stack->head != NULL) {
+        _PyObjectStackChunk *chunk = stack->head;
+        stack->head = chunk->prev;
+        chunk->n = 0;
+        gc_chunk_free(par, chunk);
+    }
+}
+
+static void
+gc_free_chunks(struct gc_parallel_state *par)
+{
+    assert(par->shared.head == NULL);
+    while (par->free_chunks.head != NULL) {
+        _PyObjectStackChunk *chunk = par->free_chunks.head;
+        par->free_chunks.head = chunk->prev;
+        _PyObject_VirtualFree(chunk, sizeof(_PyObjectStackChunk));
+    }
+}
+
+static int
+visit_mark_parallel(PyObject *op, struct gc_worker *worker)
+{
+    if (_PyObject_HAS_GC_BITS(op, _PyGC_BITS_UNREACHABLE) &&
+        gc_try_clear_unreachable(op))
+    {
+        _PyObject_ASSERT(op, _PyObject_GC_IS_TRACKED(op));
+        return gc_worker_push(worker, op);
+    }
+    return 0;
+}
+
+// Move a full chunk of pending objects to the shared stack.  The chunk on
+// top of the stack is kept, since it is the one being pushed to.
+static void
+gc_worker_share(struct gc_worker *worker)
+{
+    _PyObjectStackChunk *top = worker->stack.head;
+    if (top == NULL || top->prev == NULL) {
+        return;
+    }
+    _PyObjectStackChunk *chunk = top->prev;
+    top->prev = chunk->prev;
+
+    struct gc_parallel_state *par = worker->par;
+    PyMutex_LockFlags(&par->mutex, _Py_LOCK_DONT_DETACH);
+    chunk->prev = par->shared.head;
+    par->shared.head = chunk;
+    PyMutex_Unlock(&par->mutex);
+}
+
+// Transitively mark the objects on the worker's stack as reachable.
+static int
+gc_worker_drain(struct gc_worker *worker)
+{
+    struct gc_parallel_state *par = worker->par;
+    PyObject *op;
+    while ((op = gc_worker_pop(worker)) != NULL) {
+        traverseproc traverse = Py_TYPE(op)->tp_traverse;
+        if (traverse(op, (visitproc)&visit_mark_parallel, worker) < 0) {
+            return -1;
+        }
+        if (_Py_atomic_load_int_relaxed(&par->nidle) > 0) {
+            if (_Py_atomic_load_int_relaxed(&par->failed)) {
+                return 0;
+            }
+            gc_worker_share(worker);
+        }
+    }
+    return 0;
+}
+
+// The parallel counterpart of mark_heap_visitor().
+static bool
+mark_heap_visitor_parallel(const mi_heap_t *heap, const mi_heap_area_t *area,
+                           void *block, size_t block_size, void *args)
+{
+    PyObject *op = op_from_block(block, args, false);
+    if (op == NULL) {
+        return true;
+    }
+
+    _PyObject_ASSERT_WITH_MSG(op, gc_get_refs(op) >= 0,
+                                  "refcount is too small");
+
+    if (_PyObject_HAS_GC_BITS(op, _PyGC_BITS_UNREACHABLE) &&
+        gc_get_refs(op) != 0 &&
+        gc_try_clear_unreachable(op))
+    {
+        struct gc_worker *worker = (struct gc_worker *)args;
+        traverseproc traverse = Py_TYPE(op)->tp_traverse;
+        if (traverse(op, (visitproc)&visit_mark_parallel, worker) < 0 ||
+            gc_worker_drain(worker) < 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Once there are no pages left to visit, mark objects shared by other
+// threads until every thread has run out of work.
+static void
+gc_worker_steal(struct gc_worker *worker)
+{
+    struct gc_parallel_state *par = worker->par;
+    int idle = 0;
+    for (;;) {
+        if (gc_worker_drain(worker) < 0) {
+            _Py_atomic_store_int(&par->failed, 1);
+        }
+        if (_Py_atomic_load_int_relaxed(&par->failed)) {
+            gc_stack_release(par, &worker->stack);
+        }
+
+        PyMutex_LockFlags(&par->mutex, _Py_LOCK_DONT_DETACH);
+        _PyObjectStackChunk *chunk = par->shared.head;
+        if (chunk != NULL && !_Py_atomic_load_int_relaxed(&par->failed)) {
+            par->shared.head = chunk->prev;
+            chunk->prev = NULL;
+            worker->stack.head = chunk;
+            if (idle) {
+                idle = 0;
+                _Py_atomic_add_int(&par->nidle, -1);
+            }
+            PyMutex_Unlock(&par->mutex);
+            continue;
+        }
+        if (!idle) {
+            idle = 1;
+            _Py_atomic_add_int(&par->nidle, 1);
+        }
+        int done = (par->nidle == par->nthreads);
+        PyMutex_Unlock(&par->mutex);
+        if (done) {
+            return;
+        }
+        _Py_yield();
+    }
+}
+
+static void
+gc_parallel_worker(void *arg)
+{
+    struct gc_parallel_state *par = (struct gc_parallel_state *)arg;
+    struct gc_worker worker = { .par = par };
+    mi_block_visit_fun *visitor;
+    switch (par->pass) {
+        case GC_PASS_INIT_REFS:
+            visitor = &init_refs_parallel;
+            break;
+        case GC_PASS_SUBTRACT_REFS:
+            visitor = &subtract_refs_parallel;
+            break;
+        default:
+            visitor = &mark_heap_visitor_parallel;
+            break;
+    }
+
+    struct gc_page_list *list = par->pages;
+    for (;;) {
+        Py_ssize_t i = _Py_atomic_add_ssize(&par->next_page, 1);
+        if (i >= list->size || _Py_atomic_load_int_relaxed(&par->failed)) {
+            break;
+        }
+        struct gc_page *p = &list->pages[i];
+        worker.base.offset = p->offset;
+        if (!_mi_heap_area_visit_blocks(&p->area, p->page, visitor, &worker)) {
+            _Py_atomic_store_int(&par->failed, 1);
+            break;
+        }
+    }
+
+    if (par->pass == GC_PASS_MARK) {
+        gc_worker_steal(&worker);
+    }
+    assert(worker.stack.head == NULL);
+}
+
+static void
+gc_helper_thread(void *arg)
+{
+    struct gc_helper *helper = (struct gc_helper *)arg;
+    struct _gc_helper_pool *pool = helper->pool;
+    _Py_tss_tstate = &helper->tstate.base;
+    for (;;) {
+        int run = 0;
+        while (!_Py_atomic_load_int(&helper->run)) {
+            _PyParkingLot_Park(&helper->run, &run, sizeof(run), -1, NULL, 0);
+        }
+        if (pool->stop) {
+            _Py_tss_tstate = NULL;
+            return;
+        }
+        gc_parallel_worker(pool->par);
+        _Py_atomic_store_int(&helper->run, 0);
+        if (_Py_atomic_add_int(&pool->running, -1) == 1) {
+            _PyParkingLot_UnparkAll(&pool->running);
+        }
+    }
+}
+
+// Start helper threads until there are `n` of them, or until one fails to
+// start.  Return the number of helpers available.
+static int
+gc_start_helpers(PyInterpreterState *interp, int n)
+{
+    assert(n < GC_MAX_PARALLEL_THREADS);
+    GCState *gcstate = &interp->gc;
+    struct _gc_helper_pool *pool = gcstate->parallel_helpers;
+    if (pool == NULL) {
+        pool = PyMem_RawCalloc(1, sizeof(struct _gc_helper_pool));
+        if (pool == NULL) {
+            return 0;
+        }
+        gcstate->parallel_helpers = pool;
+    }
+    while (pool->nhelpers < n) {
+        struct gc_helper *helper = &pool->helpers[pool->nhelpers];
+        helper->pool = pool;
+        helper->run = 0;
+        helper->tstate.base.interp = interp;
+        PyThread_ident_t ident;
+        if (PyThread_start_joinable_thread(gc_helper_thread, helper, &ident,
+                                           &helper->handle) != 0) {
+            // Carry on with fewer threads.
+            break;
+        }
+        pool->nhelpers++;
+    }
+    return Py_MIN(n, pool->nhelpers);
+}
+
+// Wake up the helpers, wait for them to exit and free the pool.
+static void
+gc_stop_helpers(GCState *gcstate)
+{
+    struct _gc_helper_pool *pool = gcstate->parallel_helpers;
+    if (pool == NULL) {
+        return;
+    }
+    pool->stop = 1;
+    for (int i = 0; i < pool->nhelpers; i++) {
+        _Py_atomic_store_int(&pool->helpers[i].run, 1);
+        _PyParkingLot_UnparkAll(&pool->helpers[i].run);
+    }
+    for (int i = 0; i < pool->nhelpers; i++) {
+        PyThread_join_thread(pool->helpers[i].handle);
+    }
+    PyMem_RawFree(pool);
+    gcstate->parallel_helpers = NULL;
+}
+
+void
+_PyGC_BeforeFork(void)
+{
+    PyInterpreterState *interp = _PyRuntime.interpreters.head;
+    for (; interp != NULL; interp = interp->next) {
+        gc_stop_helpers(&interp->gc);
+    }
+}
+
+// Run a pass on the calling thread and up to nthreads - 1 helper threads.
+static int
+gc_run_parallel_pass(PyInterpreterState *interp,
+                     struct gc_parallel_state *par,
+                     enum gc_parallel_pass pass, int nthreads)
+{
+    assert(nthreads <= GC_MAX_PARALLEL_THREADS);
+    int nhelpers = nthreads > 1 ? gc_start_helpers(interp, nthreads - 1) : 0;
+    par->pass = pass;
+    par->next_page = 0;
+    par->nthreads = nhelpers + 1;
+    par->nidle = 0;
+
+    struct _gc_helper_pool *pool = interp->gc.parallel_helpers;
+    if (nhelpers > 0) {
+        pool->par = par;
+        _Py_atomic_store_int(&pool->running, nhelpers);
+        for (int i = 0; i < nhelpers; i++) {
+            _Py_atomic_store_int(&pool->helpers[i].run, 1);
+            _PyParkingLot_UnparkAll(&pool->helpers[i].run);
+        }
+    }
+    gc_parallel_worker(par);
+    if (nhelpers > 0) {
+        int running;
+        while ((running = _Py_atomic_load_int(&pool->running)) != 0) {
+            _PyParkingLot_Park(&pool->running, &running, sizeof(running),
+                               -1, NULL, 0);
+        }
+#ifdef Py_REF_DEBUG
+        // Move the helpers' reference counts to the collecting thread.
+        for (int i = 0; i < nhelpers; i++) {
+            _PyThreadStateImpl *t = &pool->helpers[i].tstate;
+            _Py_AddRefTotal(_PyThreadState_GET(), t->reftotal);
+            t->reftotal = 0;
+        }
+#endif
+    }
+    gc_stack_release(par, &par->shared);
+    return par->failed ? -1 : 0;
+}
+
 /* Return true if object has a pre-PEP 442 finalization method. */
 static int
 has_legacy_finalizer(PyObject *op)
@@ -635,6 +1322,7 @@ scan_heap_visitor(const mi_heap_t *heap, const mi_heap_area_t *area,
     }
 
     struct collection_state *state = (struct collection_state *)args;
+    state->visited++;
     if (gc_is_unreachable(op)) {
         // Disable deferred refcounting for unreachable objects so that they
         // are collected immediately after finalization.
@@ -664,6 +1352,19 @@ scan_heap_visitor(const mi_heap_t *heap, const mi_heap_area_t *area,
 
     // object is reachable, restore `ob_tid`; we're done with these objects
     gc_restore_tid(op);
+    if (state->page_passes && PyDict_CheckExact(op) &&
+        !_PyObject_HasDeferredRefcount(op))
+    {
+        // Dicts are not untracked by the page passes.
+        _PyDict_MaybeUntrack(op);
+        if (!_PyObject_GC_IS_TRACKED(op)) {
+            return true;
+        }
+    }
+    if ((op->ob_gc_bits & _PyGC_BITS_OLD) == 0) {
+        op->ob_gc_bits |= _PyGC_BITS_OLD;
+        state->long_lived_new++;
+    }
     state->long_lived_total++;
     return true;
 }
@@ -671,6 +1372,18 @@ scan_heap_visitor(const mi_heap_t *heap, const mi_heap_area_t *area,
 static int
 move_legacy_finalizer_reachable(struct collection_state *state);
 
+// Visit the objects in the collection: the collected pages in a young
+// collection, otherwise the whole heap.
+static int
+gc_visit_collection(PyInterpreterState *interp, struct collection_state *state,
+                    struct gc_page_list *pages, mi_block_visit_fun *visitor)
+{
+    if (state->young) {
+        return gc_visit_pages(pages, visitor, &state->base);
+    }
+    return gc_visit_heaps(interp, visitor, &state->base);
+}
+
 static int
 deduce_unreachable_heap(PyInterpreterState *interp,
                         struct collection_state *state)
@@ -682,15 +1395,59 @@ deduce_unreachable_heap(PyInterpreterState *interp,
     gc_visit_heaps(interp, &validate_refcounts, &state->base);
 #endif
 
+    PyTime_t start;
+    (void)PyTime_PerfCounterRaw(&start);
+
+    // A young collection only visits the pages with new objects.  A full
+    // collection splits the work across threads if the heap is large.
+    struct gc_page_list pages = { .young = state->young };
+    struct gc_parallel_state par = { .pages = &pages };
+    int nthreads = 1;
+    if (state->young) {
+        if (gc_collect_pages(interp, &pages) == 0) {
+            state->page_passes = 1;
+            nthreads = gc_parallel_threads(state->gcstate, pages.nblocks);
+        }
+        else {
+            // Out of memory: collect the whole heap instead.
+            state->young = 0;
+        }
+    }
+    else {
+        nthreads = gc_parallel_threads(state->gcstate,
+                                       state->gcstate->long_lived_total);
+        if (nthreads > 1 && gc_collect_pages(interp, &pages) == 0) {
+            state->page_passes = 1;
+        }
+    }
+    if (!state->page_passes) {
+        // gc_collect_pages() did not clear the gc_young flags.
+        HEAD_LOCK(&_PyRuntime);
+        gc_visit_heaps_lock_held(interp, false, &clear_young_page,
+                                 &state->base);
+        HEAD_UNLOCK(&_PyRuntime);
+    }
+
     // Identify objects that are directly reachable from outside the GC heap
     // by computing the difference between the refcount and the number of
     // incoming references.
-    gc_visit_heaps(interp, &update_refs, &state->base);
+    // Without page passes, update_refs() does both in a single pass.
+    if (state->page_passes) {
+        gc_run_parallel_pass(interp, &par, GC_PASS_INIT_REFS, nthreads);
+        _PyGC_EndPhase(state->phase_times, _PyGC_PHASE_UPDATE_REFS, &start);
+        gc_run_parallel_pass(interp, &par, GC_PASS_SUBTRACT_REFS,
+                             nthreads);
+        _PyGC_EndPhase(state->phase_times, _PyGC_PHASE_SUBTRACT_REFS, &start);
+    }
+    else {
+        gc_visit_heaps(interp, &update_refs, &state->base);
+        _PyGC_EndPhase(state->phase_times, _PyGC_PHASE_UPDATE_REFS, &start);
+    }
 
 #ifdef GC_DEBUG
     // Check that all objects are marked as unreachable and that the computed
     // reference count difference (stored in `ob_tid`) is non-negative.
-    gc_visit_heaps(interp, &validate_gc_objects, &state->base);
+    gc_visit_collection(interp, state, &pages, &validate_gc_objects);
 #endif
 
     // Visit the thread stacks to account for any deferred references.
@@ -698,15 +1455,25 @@ deduce_unreachable_heap(PyInterpreterState *interp,
 
     // Transitively mark reachable objects by clearing the
     // _PyGC_BITS_UNREACHABLE flag.
-    if (gc_visit_heaps(interp, &mark_heap_visitor, &state->base) < 0) {
+    int err;
+    if (state->page_passes) {
+        err = gc_run_parallel_pass(interp, &par, GC_PASS_MARK, nthreads);
+    }
+    else {
+        err = gc_visit_heaps(interp, &mark_heap_visitor, &state->base);
+    }
+    gc_free_chunks(&par);
+    if (err < 0) {
         // On out-of-memory, restore the refcounts and bail out.
-        gc_visit_heaps(interp, &restore_refs, &state->base);
+        gc_visit_collection(interp, state, &pages, &restore_refs);
+        PyMem_RawFree(pages.pages);
         return -1;
     }
 
     // Identify remaining unreachable objects and push them onto a stack.
     // Restores ob_tid for reachable objects.
-    gc_visit_heaps(interp, &scan_heap_visitor, &state->base);
+    gc_visit_collection(interp, state, &pages, &scan_heap_visitor);
+    PyMem_RawFree(pages.pages);
 
     if (state->legacy_finalizers.head) {
         // There may be objects reachable from legacy finalizers that are in
@@ -715,6 +1482,7 @@ deduce_unreachable_heap(PyInterpreterState *interp,
             return -1;
         }
     }
+    _PyGC_EndPhase(state->phase_times, _PyGC_PHASE_MOVE_UNREACHABLE, &start);
 
     return 0;
 }
@@ -837,6 +1605,7 @@ _PyGC_InitState(GCState *gcstate)
 {
     // TODO: move to pycore_runtime_init.h once the incremental GC lands.
     gcstate->young.threshold = 2000;
+    gcstate->parallel_threshold = _PyGC_PARALLEL_THRESHOLD;
 }
 
 
@@ -983,7 +1752,8 @@ _PyGC_VisitStackRef(_PyStackRef *ref, visitproc visit, void *arg)
     // computing the incoming references, but otherwise treat them like
     // regular references.
     if (!PyStackRef_IsDeferred(*ref) ||
-        (visit != visit_decref && visit != visit_decref_unreachable))
+        (visit != visit_decref && visit != visit_decref_parallel &&
+         visit != visit_decref_unreachable))
     {
         Py_VISIT(PyStackRef_AsPyObjectBorrow(*ref));
     }
@@ -1092,8 +1862,7 @@ handle_resurrected_objects(struct collection_state *state)
  */
 static void
 invoke_gc_callback(PyThreadState *tstate, const char *phase,
-                   int generation, Py_ssize_t collected,
-                   Py_ssize_t uncollectable)
+                   int generation, struct gc_collection_stats *stats)
 {
     assert(!_PyErr_Occurred(tstate));
 
@@ -1107,10 +1876,12 @@ invoke_gc_callback(PyThreadState *tstate, const char *phase,
     assert(PyList_CheckExact(gcstate->callbacks));
     PyObject *info = NULL;
     if (PyList_GET_SIZE(gcstate->callbacks) != 0) {
-        info = Py_BuildValue("{sisnsn}",
+        info = Py_BuildValue("{sisnsnsnsd}",
             "generation", generation,
-            "collected", collected,
-            "uncollectable", uncollectable);
+            "collected", stats->collected,
+            "uncollectable", stats->uncollectable,
+            "visited", stats->visited,
+            "duration", PyTime_AsSecondsDouble(stats->duration));
         if (info == NULL) {
             PyErr_FormatUnraisable("Exception ignored on invoking gc callbacks");
             return;
@@ -1160,11 +1931,24 @@ gc_should_collect(GCState *gcstate)
     if (count <= threshold || threshold == 0 || !gcstate->enabled) {
         return false;
     }
-    // Avoid quadratic behavior by scaling threshold to the number of live
-    // objects. A few tests rely on immediate scheduling of the GC so we ignore
-    // the scaled threshold if generations[1].threshold is set to zero.
-    return (count > gcstate->long_lived_total / 4 ||
-            gcstate->old[0].threshold == 0);
+    // Young collections only visit the pages with new objects, so unlike
+    // full collections their threshold is not scaled to the heap size.
+    return true;
+}
+
+// Avoid quadratic behavior by collecting the whole heap only once the
+// objects that survived young collections would grow it by a quarter.
+static bool
+gc_should_collect_full(GCState *gcstate)
+{
+    return gcstate->long_lived_pending > gcstate->long_lived_total / 4;
+}
+
+// Include the object at `ptr` in the next young collection.
+static inline void
+gc_set_young_page(void *ptr)
+{
+    _Py_atomic_store_uint8_relaxed(&_mi_ptr_page(ptr)->gc_young, 1);
 }
 
 static void
@@ -1238,6 +2022,8 @@ gc_collect_internal(PyInterpreterState *interp, struct collection_state *state,
         PyErr_NoMemory();
         return;
     }
+    PyTime_t start;
+    (void)PyTime_PerfCounterRaw(&start);
 
     // Print debugging information.
     if (interp->gc.debug & _PyGC_DEBUG_COLLECTABLE) {
@@ -1247,8 +2033,16 @@ gc_collect_internal(PyInterpreterState *interp, struct collection_state *state,
         }
     }
 
-    // Record the number of live GC objects
-    interp->gc.long_lived_total = state->long_lived_total;
+    // Record the number of live GC objects.  A young collection also visits
+    // the old objects that share a page with new ones, so count only the
+    // objects that survive their first collection.
+    if (state->young) {
+        interp->gc.long_lived_pending += state->long_lived_new;
+    }
+    else {
+        interp->gc.long_lived_total = state->long_lived_total;
+        interp->gc.long_lived_pending = 0;
+    }
 
     // Clear weakrefs and enqueue callbacks (but do not call them).
     clear_weakrefs(state);
@@ -1265,9 +2059,12 @@ gc_collect_internal(PyInterpreterState *interp, struct collection_state *state,
     // Handle any objects that may have resurrected after the finalization.
     _PyEval_StopTheWorld(interp);
     err = handle_resurrected_objects(state);
-    // Clear free lists in all threads
-    _PyGC_ClearAllFreeLists(interp);
+    if (!state->young) {
+        // Clear free lists in all threads
+        _PyGC_ClearAllFreeLists(interp);
+    }
     _PyEval_StartTheWorld(interp);
+    _PyGC_EndPhase(state->phase_times, _PyGC_PHASE_FINALIZE, &start);
 
     if (err < 0) {
         cleanup_worklist(&state->unreachable);
@@ -1285,6 +2082,7 @@ gc_collect_internal(PyInterpreterState *interp, struct collection_state *state,
 
     // Append objects with legacy finalizers to the "gc.garbage" list.
     handle_legacy_finalizers(state);
+    _PyGC_EndPhase(state->phase_times, _PyGC_PHASE_DELETE, &start);
 }
 
 /* This is the main function.  Read this to understand how the
@@ -1294,7 +2092,7 @@ gc_collect_main(PyThreadState *tstate, int generation, _PyGC_Reason reason)
 {
     Py_ssize_t m = 0; /* # objects collected */
     Py_ssize_t n = 0; /* # unreachable objects that couldn't be collected */
-    PyTime_t t1 = 0;   /* initialize to prevent a compiler warning */
+    PyTime_t t1;
     GCState *gcstate = &tstate->interp->gc;
 
     // gc_collect_main() must not be called before _PyGC_Init
@@ -1314,6 +2112,10 @@ gc_collect_main(PyThreadState *tstate, int generation, _PyGC_Reason reason)
         return 0;
     }
 
+    if (reason == _Py_GC_REASON_HEAP && gc_should_collect_full(gcstate)) {
+        generation = NUM_GENERATIONS - 1;
+    }
+
     assert(generation >= 0 && generation < NUM_GENERATIONS);
 
 #ifdef Py_STATS
@@ -1324,15 +2126,16 @@ gc_collect_main(PyThreadState *tstate, int generation, _PyGC_Reason reason)
     GC_STAT_ADD(generation, collections, 1);
 
     if (reason != _Py_GC_REASON_SHUTDOWN) {
-        invoke_gc_callback(tstate, "start", generation, 0, 0);
+        struct gc_collection_stats stats = { 0 };
+        invoke_gc_callback(tstate, "start", generation, &stats);
     }
 
     if (gcstate->debug & _PyGC_DEBUG_STATS) {
         PySys_WriteStderr("gc: collecting generation %d...\n", generation);
         show_stats_each_generations(gcstate);
-        // ignore error: don't interrupt the GC if reading the clock fails
-        (void)PyTime_PerfCounterRaw(&t1);
     }
+    // ignore error: don't interrupt the GC if reading the clock fails
+    (void)PyTime_PerfCounterRaw(&t1);
 
     if (PyDTrace_GC_START_ENABLED()) {
         PyDTrace_GC_START(generation);
@@ -1344,25 +2147,28 @@ gc_collect_main(PyThreadState *tstate, int generation, _PyGC_Reason reason)
         .interp = interp,
         .gcstate = gcstate,
         .reason = reason,
+        .young = (generation < NUM_GENERATIONS - 1),
     };
 
     gc_collect_internal(interp, &state, generation);
 
     m = state.collected;
     n = state.uncollectable;
+    PyTime_t t2;
+    (void)PyTime_PerfCounterRaw(&t2);
 
     if (gcstate->debug & _PyGC_DEBUG_STATS) {
-        PyTime_t t2;
-        (void)PyTime_PerfCounterRaw(&t2);
         double d = PyTime_AsSecondsDouble(t2 - t1);
         PySys_WriteStderr(
             "gc: done, %zd unreachable, %zd uncollectable, %.4fs elapsed\n",
             n+m, n, d);
     }
 
-    // Clear the current thread's free-list again.
-    _PyThreadStateImpl *tstate_impl = (_PyThreadStateImpl *)tstate;
-    _PyObject_ClearFreeLists(&tstate_impl->freelists, 0);
+    if (!state.young) {
+        // Clear the current thread's free-list again.
+        _PyThreadStateImpl *tstate_impl = (_PyThreadStateImpl *)tstate;
+        _PyObject_ClearFreeLists(&tstate_impl->freelists, 0);
+    }
 
     if (_PyErr_Occurred(tstate)) {
         if (reason == _Py_GC_REASON_SHUTDOWN) {
@@ -1374,10 +2180,22 @@ gc_collect_main(PyThreadState *tstate, int generation, _PyGC_Reason reason)
     }
 
     /* Update stats */
-    struct gc_generation_stats *stats = &gcstate->generation_stats[generation];
-    stats->collections++;
-    stats->collected += m;
-    stats->uncollectable += n;
+    struct gc_collection_stats stats = {
+        .collected = m,
+        .uncollectable = n,
+        .visited = state.visited,
+        .duration = t2 - t1,
+    };
+    struct gc_generation_stats *gen_stats = &gcstate->generation_stats[generation];
+    gen_stats->collections++;
+    gen_stats->collected += m;
+    gen_stats->uncollectable += n;
+    gen_stats->visited += stats.visited;
+    for (int i = 0; i < _PyGC_PHASES; i++) {
+        stats.phase_times[i] = state.phase_times[i];
+        gen_stats->phase_times[i] += state.phase_times[i];
+    }
+    gen_stats->durations[_PyGC_DurationBucket(stats.duration)]++;
 
     GC_STAT_ADD(generation, objects_collected, m);
 #ifdef Py_STATS
@@ -1393,7 +2211,7 @@ gc_collect_main(PyThreadState *tstate, int generation, _PyGC_Reason reason)
     }
 
     if (reason != _Py_GC_REASON_SHUTDOWN) {
-        invoke_gc_callback(tstate, "stop", generation, m, n);
+        invoke_gc_callback(tstate, "stop", generation, &stats);
     }
 
     assert(!_PyErr_Occurred(tstate));
@@ -1601,6 +2419,34 @@ _PyGC_GetFreezeCount(PyInterpreterState *interp)
     return args.count;
 }
 
+struct immortalize_args {
+    struct visitor_args base;
+    Py_ssize_t count;
+};
+
+static bool
+visit_immortalize(const mi_heap_t *heap, const mi_heap_area_t *area,
+                  void *block, size_t block_size, void *args)
+{
+    PyObject *op = op_from_block(block, args, true);
+    if (op != NULL) {
+        struct immortalize_args *arg = (struct immortalize_args *)args;
+        arg->count += _PyObject_Immortalize(op);
+    }
+    return true;
+}
+
+Py_ssize_t
+_PyGC_ImmortalizeHeap(PyInterpreterState *interp)
+{
+    struct immortalize_args args = { .count = 0 };
+    _PyEval_StopTheWorld(interp);
+    gc_visit_heaps(interp, &visit_immortalize, &args.base);
+    interp->gc.young.count = 0;
+    _PyEval_StartTheWorld(interp);
+    return args.count;
+}
+
 /* C API for controlling the state of the garbage collector */
 int
 PyGC_Enable(void)
@@ -1712,6 +2558,7 @@ _PyGC_Fini(PyInterpreterState *interp)
     GCState *gcstate = &interp->gc;
     Py_CLEAR(gcstate->garbage);
     Py_CLEAR(gcstate->callbacks);
+    gc_stop_helpers(gcstate);
 
     /* We expect that none of this interpreters objects are shared
        with other interpreters.
@@ -1786,6 +2633,7 @@ _Py_ScheduleGC(PyThreadState *tstate)
 void
 _PyObject_GC_Link(PyObject *op)
 {
+    gc_set_young_page(op);
     record_allocation(_PyThreadState_GET());
 }
 
@@ -1816,6 +2664,7 @@ gc_alloc(PyTypeObject *tp, size_t basicsize, size_t presize)
         ((PyObject **)mem)[1] = NULL;
     }
     PyObject *op = (PyObject *)(mem + presize);
+    gc_set_young_page(mem);
     record_allocation(tstate);
     return op;
 }
@@ -1885,6 +2734,7 @@ _PyObject_GC_Resize(PyVarObject *op, Py_ssize_t nitems)
     if (mem == NULL) {
         return (PyVarObject *)PyErr_NoMemory();
     }
+    gc_set_young_page(mem);
     op = (PyVarObject *) (mem + presize);
     Py_SET_SIZE(op, nitems);
     return op;
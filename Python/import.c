@@ -10,6 +10,7 @@
 #include "pycore_magic_number.h"  // PYC_MAGIC_NUMBER_TOKEN
 #include "pycore_namespace.h"     // _PyNamespace_Type
 #include "pycore_object.h"        // _Py_SetImmortal()
+#include "pycore_optimizer.h"     // _Py_GetTraceCache()
 #include "pycore_pyerrors.h"      // _PyErr_SetString()
 #include "pycore_pyhash.h"        // _Py_KeyedHash()
 #include "pycore_pylifecycle.h"
@@ -4790,6 +4791,56 @@ _imp_source_hash_impl(PyObject *module, long key, Py_buffer *source)
 }
 
 
+/*[clinic input]
+_imp._get_trace_cache
+
+    code: object(type="PyCodeObject *", subclass_of="&PyCode_Type")
+    loaded: object(subclass_of="&PyDict_Type")
+    /
+
+Return the trace cache of code and its nested code objects.
+
+The result maps each code object with hot loops to their offsets.  It holds
+the loops that have executors, and those listed in loaded, a cache returned
+by an earlier call.  It is saved by the import system for -X trace_cache.
+[clinic start generated code]*/
+
+static PyObject *
+_imp__get_trace_cache_impl(PyObject *module, PyCodeObject *code,
+                           PyObject *loaded)
+/*[clinic end generated code: output=03093d23cc7014b8 input=7acd7fc160f6c045]*/
+{
+#ifdef _Py_TIER2
+    return _Py_GetTraceCache(code, loaded);
+#else
+    return PyDict_Copy(loaded);
+#endif
+}
+
+/*[clinic input]
+_imp._load_trace_cache
+
+    code: object(type="PyCodeObject *", subclass_of="&PyCode_Type")
+    cache: object(subclass_of="&PyDict_Type")
+    /
+
+Prime the loops of code that a dict from _get_trace_cache() lists as hot.
+[clinic start generated code]*/
+
+static PyObject *
+_imp__load_trace_cache_impl(PyObject *module, PyCodeObject *code,
+                            PyObject *cache)
+/*[clinic end generated code: output=0a9b778f2654efa7 input=18693e8496624879]*/
+{
+#ifdef _Py_TIER2
+    if (_Py_LoadTraceCache(code, cache) < 0) {
+        return NULL;
+    }
+#endif
+    Py_RETURN_NONE;
+}
+
+
 PyDoc_STRVAR(doc_imp,
 "(Extremely) low-level import machinery bits as used by importlib.");
 
@@ -4813,6 +4864,8 @@ static PyMethodDef imp_methods[] = {
     _IMP_EXEC_BUILTIN_METHODDEF
     _IMP__FIX_CO_FILENAME_METHODDEF
     _IMP_SOURCE_HASH_METHODDEF
+    _IMP__GET_TRACE_CACHE_METHODDEF
+    _IMP__LOAD_TRACE_CACHE_METHODDEF
     {NULL, NULL}  /* sentinel */
 };
 
@@ -4832,6 +4885,12 @@ imp_module_exec(PyObject *module)
         return -1;
     }
 
+    if (PyModule_Add(module, "trace_cache",
+                     PyBool_FromLong(_Py_GetConfig()->trace_cache)) < 0)
+    {
+        return -1;
+    }
+
     return 0;
 }
 
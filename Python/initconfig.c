@@ -141,6 +141,7 @@ static const PyConfigSpec PYCONFIG_SPEC[] = {
     SPEC(filesystem_errors, WSTR, READ_ONLY, NO_SYS),
     SPEC(hash_seed, ULONG, READ_ONLY, NO_SYS),
     SPEC(home, WSTR_OPT, READ_ONLY, NO_SYS),
+    SPEC(huge_pages, BOOL, READ_ONLY, NO_SYS),
     SPEC(import_time, BOOL, READ_ONLY, NO_SYS),
     SPEC(install_signal_handlers, BOOL, READ_ONLY, NO_SYS),
     SPEC(isolated, BOOL, READ_ONLY, NO_SYS),  // sys.flags.isolated
@@ -165,6 +166,7 @@ static const PyConfigSpec PYCONFIG_SPEC[] = {
     SPEC(skip_source_first_line, BOOL, READ_ONLY, NO_SYS),
     SPEC(stdio_encoding, WSTR, READ_ONLY, NO_SYS),
     SPEC(stdio_errors, WSTR, READ_ONLY, NO_SYS),
+    SPEC(trace_cache, BOOL, READ_ONLY, NO_SYS),
     SPEC(tracemalloc, UINT, READ_ONLY, NO_SYS),
     SPEC(use_frozen_modules, BOOL, READ_ONLY, NO_SYS),
     SPEC(use_hash_seed, BOOL, READ_ONLY, NO_SYS),
@@ -296,6 +298,8 @@ The following implementation-specific options are available:\n\
 "-X gil=[0|1]: enable (1) or disable (0) the GIL; also PYTHON_GIL\n"
 #endif
 "\
+-X huge_pages: back memory allocator arenas with transparent huge pages;\n\
+         also PYTHON_HUGE_PAGES\n\
 -X importtime: show how long each import takes; also PYTHONPROFILEIMPORTTIME\n\
 -X int_max_str_digits=N: limit the size of int<->str conversions;\n\
          0 disables the limit; also PYTHONINTMAXSTRDIGITS\n\
@@ -322,6 +326,8 @@ The following implementation-specific options are available:\n\
          PYTHON_TLBC\n"
 #endif
 "\
+-X trace_cache: save the loops that were optimized next to the .pyc files, and\n\
+         optimize them straight away in later runs; also PYTHON_TRACE_CACHE\n\
 -X tracemalloc[=N]: trace Python memory allocations; N sets a traceback limit\n \
          of N frames (default: 1); also PYTHONTRACEMALLOC=N\n\
 -X utf8[=0|1]: enable (1) or disable (0) UTF-8 mode; also PYTHONUTF8\n\
@@ -386,6 +392,8 @@ static const char usage_envvars[] =
 #ifdef Py_GIL_DISABLED
 "PYTHON_GIL      : when set to 0, disables the GIL (-X gil)\n"
 #endif
+"PYTHON_HUGE_PAGES: back memory allocator arenas with transparent huge pages\n"
+"                  (-X huge_pages)\n"
 "PYTHONINSPECT   : inspect interactively after running script (-i)\n"
 "PYTHONINTMAXSTRDIGITS: limit the size of int<->str conversions;\n"
 "                  0 disables the limit (-X int_max_str_digits=N)\n"
@@ -409,6 +417,8 @@ static const char usage_envvars[] =
 #ifdef Py_GIL_DISABLED
 "PYTHON_TLBC     : when set to 0, disables thread-local bytecode (-X tlbc)\n"
 #endif
+"PYTHON_TRACE_CACHE: save optimized loops next to .pyc files and optimize\n"
+"                  them straight away in later runs (-X trace_cache)\n"
 "PYTHONTRACEMALLOC: trace Python memory allocations (-X tracemalloc)\n"
 "PYTHONUNBUFFERED: disable stdout/stderr buffering (-u)\n"
 "PYTHONUTF8      : control the UTF-8 mode (-X utf8)\n"
@@ -843,6 +853,8 @@ config_check_consistency(const PyConfig *config)
     assert(config->show_ref_count >= 0);
     assert(config->dump_refs >= 0);
     assert(config->malloc_stats >= 0);
+    assert(config->huge_pages >= 0);
+    assert(config->trace_cache >= 0);
     assert(config->site_import >= 0);
     assert(config->bytes_warning >= 0);
     assert(config->warn_default_encoding >= 0);
@@ -2101,6 +2113,16 @@ config_read_complex_options(PyConfig *config)
         config->import_time = 1;
     }
 
+    if (config_get_env(config, "PYTHON_HUGE_PAGES")
+       || config_get_xoption(config, L"huge_pages")) {
+        config->huge_pages = 1;
+    }
+
+    if (config_get_env(config, "PYTHON_TRACE_CACHE")
+       || config_get_xoption(config, L"trace_cache")) {
+        config->trace_cache = 1;
+    }
+
     if (config_get_env(config, "PYTHONNODEBUGRANGES")
        || config_get_xoption(config, L"no_debug_ranges")) {
         config->code_debug_ranges = 0;
@@ -2596,6 +2618,10 @@ _PyConfig_Write(const PyConfig *config, _PyRuntimeState *runtime)
     }
 #endif
 
+    if (config->huge_pages) {
+        _PyMem_EnableHugePages();
+    }
+
     return _PyStatus_OK();
 }
 
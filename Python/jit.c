@@ -8,14 +8,17 @@
 #include "pycore_ceval.h"
 #include "pycore_critical_section.h"
 #include "pycore_dict.h"
+#include "pycore_interp.h"
 #include "pycore_intrinsics.h"
 #include "pycore_long.h"
 #include "pycore_opcode_metadata.h"
 #include "pycore_opcode_utils.h"
 #include "pycore_optimizer.h"
 #include "pycore_pyerrors.h"
+#include "pycore_pystate.h"
 #include "pycore_setobject.h"
 #include "pycore_sliceobject.h"
+#include "pycore_uop_metadata.h"
 #include "pycore_jit.h"
 
 // Memory management stuff: ////////////////////////////////////////////////////
@@ -120,6 +123,321 @@ mark_executable(unsigned char *memory, size_t size)
     return 0;
 }
 
+static int
+mark_writable(unsigned char *memory, size_t size)
+{
+    assert(size % get_page_size() == 0);
+#if defined(MS_WINDOWS)
+    int old;
+    int failed = !VirtualProtect(memory, size, PAGE_READWRITE, &old);
+#elif defined(MAP_JIT)
+    // MAP_JIT memory is toggled per-thread with pthread_jit_write_protect_np:
+    int failed = 0;
+#else
+    int failed = mprotect(memory, size, PROT_READ | PROT_WRITE);
+#endif
+    if (failed) {
+        jit_error("unable to unprotect executable memory");
+        return -1;
+    }
+    return 0;
+}
+
+// Code arena stuff: ///////////////////////////////////////////////////////////
+
+// Rather than mapping each executor separately, jitted code is carved out of
+// large per-interpreter chunks. This keeps the number of mappings (and iTLB
+// entries) down when there are many small executors. Whole pages are handed
+// out, since pages are made executable (and read-only) as soon as an executor
+// is emitted, and code in neighbouring pages may be running at any time.
+
+// 2 MiB with 4 KiB pages, so a chunk can be backed by a single huge page:
+#define JIT_CHUNK_PAGES 512
+#define JIT_CHUNK_WORDS (JIT_CHUNK_PAGES / 64)
+// Only naturally aligned ranges can be backed by huge pages:
+#define JIT_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
+typedef struct _PyJitChunk {
+    struct _PyJitChunk *next;
+    unsigned char *memory;
+    size_t size;
+    size_t used_pages;
+    // One bit per page, set while the page belongs to a live executor. Chunks
+    // bigger than JIT_CHUNK_PAGES hold exactly one executor and don't use it:
+    uint64_t used[JIT_CHUNK_WORDS];
+    // Pages that have been made executable since the chunk was mapped, and
+    // must be made writable again before they are reused:
+    uint64_t executable[JIT_CHUNK_WORDS];
+} _PyJitChunk;
+
+static inline bool
+page_bit(const uint64_t *bits, size_t page)
+{
+    return (bits[page / 64] >> (page % 64)) & 1;
+}
+
+static void
+set_page_bits(uint64_t *bits, size_t first, size_t count, bool value)
+{
+    for (size_t page = first; page < first + count; page++) {
+        uint64_t bit = (uint64_t)1 << (page % 64);
+        if (value) {
+            bits[page / 64] |= bit;
+        }
+        else {
+            bits[page / 64] &= ~bit;
+        }
+    }
+}
+
+static bool
+any_page_bits(const uint64_t *bits, size_t first, size_t count)
+{
+    for (size_t page = first; page < first + count; page++) {
+        if (page_bit(bits, page)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static size_t
+chunk_pages(const _PyJitChunk *chunk)
+{
+    return chunk->size / get_page_size();
+}
+
+// First fit. Returns the index of the first of npages free pages, or -1:
+static Py_ssize_t
+chunk_find_pages(const _PyJitChunk *chunk, size_t npages)
+{
+    size_t total = chunk_pages(chunk);
+    if (total > JIT_CHUNK_PAGES || total - chunk->used_pages < npages) {
+        return -1;
+    }
+    size_t run = 0;
+    for (size_t page = 0; page < total; page++) {
+        if (page_bit(chunk->used, page)) {
+            run = 0;
+        }
+        else if (++run == npages) {
+            return page + 1 - npages;
+        }
+    }
+    return -1;
+}
+
+static unsigned char *
+chunk_map(size_t size)
+{
+#ifdef MADV_HUGEPAGE
+    // mmap only promises page alignment, so map enough to trim the chunk down
+    // to a huge-page boundary:
+    size_t page_size = get_page_size();
+    size_t slack = JIT_HUGE_PAGE_SIZE - page_size;
+    unsigned char *memory = jit_alloc(size + slack);
+    if (memory == NULL) {
+        return NULL;
+    }
+    unsigned char *aligned = _Py_ALIGN_UP(memory, JIT_HUGE_PAGE_SIZE);
+    size_t head = aligned - memory;
+    if (head) {
+        (void)munmap(memory, head);
+    }
+    if (slack - head) {
+        (void)munmap(aligned + size, slack - head);
+    }
+    // Just a hint; failure is harmless:
+    (void)madvise(aligned, size, MADV_HUGEPAGE);
+    return aligned;
+#else
+    return jit_alloc(size);
+#endif
+}
+
+static _PyJitChunk *
+chunk_new(struct _jit_arena *arena, size_t size)
+{
+    _PyJitChunk *chunk = PyMem_RawCalloc(1, sizeof(_PyJitChunk));
+    if (chunk == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    chunk->memory = chunk_map(size);
+    if (chunk->memory == NULL) {
+        PyMem_RawFree(chunk);
+        return NULL;
+    }
+    chunk->size = size;
+    chunk->next = arena->chunks;
+    arena->chunks = chunk;
+    arena->chunk_count++;
+    arena->mapped_size += size;
+    return chunk;
+}
+
+static void
+chunk_free(struct _jit_arena *arena, _PyJitChunk *chunk)
+{
+    assert(chunk->used_pages == 0);
+    _PyJitChunk **link = &arena->chunks;
+    while (*link != chunk) {
+        link = &(*link)->next;
+    }
+    *link = chunk->next;
+    arena->chunk_count--;
+    arena->mapped_size -= chunk->size;
+    if (jit_free(chunk->memory, chunk->size)) {
+        PyErr_WriteUnraisable(NULL);
+    }
+    PyMem_RawFree(chunk);
+}
+
+static _PyJitChunk *
+arena_find_chunk(struct _jit_arena *arena, unsigned char *memory)
+{
+    for (_PyJitChunk *chunk = arena->chunks; chunk; chunk = chunk->next) {
+        if (chunk->memory <= memory && memory < chunk->memory + chunk->size) {
+            return chunk;
+        }
+    }
+    return NULL;
+}
+
+static size_t
+round_up_to_pages(size_t size)
+{
+    size_t page_size = get_page_size();
+    assert((page_size & (page_size - 1)) == 0);
+    return (size + page_size - 1) & ~(page_size - 1);
+}
+
+// Returns page-aligned, writable memory for size bytes, which must later be
+// handed back to arena_free with the same size:
+static unsigned char *
+arena_alloc(struct _jit_arena *arena, size_t size)
+{
+    assert(size);
+    size_t page_size = get_page_size();
+    size_t npages = round_up_to_pages(size) / page_size;
+    _PyJitChunk *chunk = NULL;
+    Py_ssize_t first = -1;
+    PyMutex_Lock(&arena->mutex);
+    if (npages <= JIT_CHUNK_PAGES) {
+        for (chunk = arena->chunks; chunk; chunk = chunk->next) {
+            first = chunk_find_pages(chunk, npages);
+            if (first >= 0) {
+                break;
+            }
+        }
+    }
+    if (chunk == NULL) {
+        chunk = chunk_new(arena, Py_MAX(npages, JIT_CHUNK_PAGES) * page_size);
+        if (chunk == NULL) {
+            PyMutex_Unlock(&arena->mutex);
+            return NULL;
+        }
+        first = 0;
+    }
+    unsigned char *memory = chunk->memory + first * page_size;
+    if (npages <= JIT_CHUNK_PAGES) {
+        if (any_page_bits(chunk->executable, first, npages)) {
+            // Make the whole free run around these pages writable at once, so
+            // that the executors that get carved out of the rest of it don't
+            // each need a protection change of their own:
+            size_t start = first, end = first + npages;
+            while (start > 0 && !page_bit(chunk->used, start - 1)) {
+                start--;
+            }
+            while (end < chunk_pages(chunk) && !page_bit(chunk->used, end)) {
+                end++;
+            }
+            if (mark_writable(chunk->memory + start * page_size,
+                              (end - start) * page_size))
+            {
+                if (chunk->used_pages == 0) {
+                    chunk_free(arena, chunk);
+                }
+                PyMutex_Unlock(&arena->mutex);
+                return NULL;
+            }
+            set_page_bits(chunk->executable, start, end - start, false);
+        }
+        set_page_bits(chunk->used, first, npages, true);
+    }
+    chunk->used_pages += npages;
+    arena->used_size += npages * page_size;
+    arena->code_size += size;
+    PyMutex_Unlock(&arena->mutex);
+    return memory;
+}
+
+// Memory handed out by arena_alloc has been made executable:
+static void
+arena_mark_executable(struct _jit_arena *arena, unsigned char *memory,
+                      size_t size)
+{
+    PyMutex_Lock(&arena->mutex);
+    _PyJitChunk *chunk = arena_find_chunk(arena, memory);
+    assert(chunk != NULL);
+    if (chunk_pages(chunk) <= JIT_CHUNK_PAGES) {
+        size_t page_size = get_page_size();
+        set_page_bits(chunk->executable, (memory - chunk->memory) / page_size,
+                      round_up_to_pages(size) / page_size, true);
+    }
+    PyMutex_Unlock(&arena->mutex);
+}
+
+static void
+arena_free(struct _jit_arena *arena, unsigned char *memory, size_t size)
+{
+    PyMutex_Lock(&arena->mutex);
+    _PyJitChunk *chunk = arena_find_chunk(arena, memory);
+    if (chunk == NULL) {
+        // The arena has already been finalized, and the chunk abandoned:
+        PyMutex_Unlock(&arena->mutex);
+        return;
+    }
+    size_t page_size = get_page_size();
+    size_t npages = round_up_to_pages(size) / page_size;
+    if (chunk_pages(chunk) <= JIT_CHUNK_PAGES) {
+        size_t first = (memory - chunk->memory) / page_size;
+        set_page_bits(chunk->used, first, npages, false);
+    }
+    assert(chunk->used_pages >= npages);
+    chunk->used_pages -= npages;
+    arena->used_size -= npages * page_size;
+    arena->code_size -= size;
+    // Hang on to the last empty chunk, so that a program that keeps creating
+    // and destroying a few executors doesn't keep mapping and unmapping it:
+    if (chunk->used_pages == 0 &&
+        (arena->chunk_count > 1 || chunk_pages(chunk) > JIT_CHUNK_PAGES))
+    {
+        chunk_free(arena, chunk);
+    }
+    PyMutex_Unlock(&arena->mutex);
+}
+
+void
+_PyJIT_Fini(PyInterpreterState *interp)
+{
+    // finalize_modules() has invalidated every executor, so none of them can
+    // be entered again. Any that are still alive (and leaked) never run their
+    // code, and _PyJIT_Free() ignores the chunks that are gone:
+    assert(interp->executor_list_head == NULL);
+    struct _jit_arena *arena = &interp->jit_arena;
+    PyMutex_Lock(&arena->mutex);
+    while (arena->chunks) {
+        _PyJitChunk *chunk = arena->chunks;
+        chunk->used_pages = 0;
+        chunk_free(arena, chunk);
+    }
+    assert(arena->chunk_count == 0 && arena->mapped_size == 0);
+    arena->used_size = 0;
+    arena->code_size = 0;
+    PyMutex_Unlock(&arena->mutex);
+}
+
 // JIT compiler stuff: /////////////////////////////////////////////////////////
 
 #define SYMBOL_MASK_WORDS 4
@@ -469,6 +787,38 @@ combine_symbol_mask(const symbol_mask src, symbol_mask dest)
     }
 }
 
+// If trace[i] and trace[i + 1] have a fused stencil, fill in *fused and return
+// true. The fused stencil reads the operands from the stack once for both the
+// guard and the operation, rather than once in each stencil. Its inputs and
+// result still go through the stack like those of any other stencil. It takes
+// its exit from whichever uop has one, and everything else from the second
+// uop:
+static bool
+fuse(const _PyUOpInstruction trace[], size_t i, size_t length,
+     _PyUOpInstruction *fused)
+{
+    if (i + 1 >= length) {
+        return false;
+    }
+    const _PyUOpInstruction *first = &trace[i];
+    const _PyUOpInstruction *second = &trace[i + 1];
+    int opcode = _PyUop_Fuse(first->opcode, second->opcode);
+    if (opcode == 0) {
+        return false;
+    }
+    *fused = *second;
+    fused->opcode = opcode;
+    fused->format = UOP_FORMAT_JUMP;
+    if (_PyUop_Flags[first->opcode] & (HAS_EXIT_FLAG | HAS_DEOPT_FLAG)) {
+        assert(first->format == UOP_FORMAT_JUMP);
+        fused->jump_target = first->jump_target;
+    }
+    if (second->format == UOP_FORMAT_TARGET) {
+        fused->error_target = 0;
+    }
+    return true;
+}
+
 // Compiles executor in-place. Don't forget to call _PyJIT_Free later!
 int
 _PyJIT_Compile(_PyExecutorObject *executor, const _PyUOpInstruction trace[], size_t length)
@@ -482,10 +832,18 @@ _PyJIT_Compile(_PyExecutorObject *executor, const _PyUOpInstruction trace[], siz
     code_size += group->code_size;
     data_size += group->data_size;
     combine_symbol_mask(group->trampoline_mask, state.trampolines.mask);
+    _PyUOpInstruction fused;
     for (size_t i = 0; i < length; i++) {
         const _PyUOpInstruction *instruction = &trace[i];
-        group = &stencil_groups[instruction->opcode];
         state.instruction_starts[i] = code_size;
+        if (fuse(trace, i, length, &fused)) {
+            // Nothing jumps to the second half of a fused pair, but if
+            // something did, re-running the guard first would be harmless:
+            instruction = &fused;
+            i++;
+            state.instruction_starts[i] = code_size;
+        }
+        group = &stencil_groups[instruction->opcode];
         code_size += group->code_size;
         data_size += group->data_size;
         combine_symbol_mask(group->trampoline_mask, state.trampolines.mask);
@@ -498,12 +856,9 @@ _PyJIT_Compile(_PyExecutorObject *executor, const _PyUOpInstruction trace[], siz
     for (size_t i = 0; i < Py_ARRAY_LENGTH(state.trampolines.mask); i++) {
         state.trampolines.size += _Py_popcount32(state.trampolines.mask[i]) * TRAMPOLINE_SIZE;
     }
-    // Round up to the nearest page:
-    size_t page_size = get_page_size();
-    assert((page_size & (page_size - 1)) == 0);
-    size_t padding = page_size - ((code_size + data_size + state.trampolines.size) & (page_size - 1));
-    size_t total_size = code_size + data_size + state.trampolines.size + padding;
-    unsigned char *memory = jit_alloc(total_size);
+    size_t total_size = code_size + data_size + state.trampolines.size;
+    struct _jit_arena *arena = &_PyInterpreterState_GET()->jit_arena;
+    unsigned char *memory = arena_alloc(arena, total_size);
     if (memory == NULL) {
         return -1;
     }
@@ -528,6 +883,10 @@ _PyJIT_Compile(_PyExecutorObject *executor, const _PyUOpInstruction trace[], siz
     assert(trace[0].opcode == _START_EXECUTOR);
     for (size_t i = 0; i < length; i++) {
         const _PyUOpInstruction *instruction = &trace[i];
+        if (fuse(trace, i, length, &fused)) {
+            instruction = &fused;
+            i++;
+        }
         group = &stencil_groups[instruction->opcode];
         group->emit(code, data, executor, instruction, &state);
         code += group->code_size;
@@ -543,10 +902,11 @@ _PyJIT_Compile(_PyExecutorObject *executor, const _PyUOpInstruction trace[], siz
 #ifdef MAP_JIT
     pthread_jit_write_protect_np(1);
 #endif
-    if (mark_executable(memory, total_size)) {
-        jit_free(memory, total_size);
+    if (mark_executable(memory, round_up_to_pages(total_size))) {
+        arena_free(arena, memory, total_size);
         return -1;
     }
+    arena_mark_executable(arena, memory, total_size);
     executor->jit_code = memory;
     executor->jit_side_entry = memory + shim.code_size;
     executor->jit_size = total_size;
@@ -562,9 +922,7 @@ _PyJIT_Free(_PyExecutorObject *executor)
         executor->jit_code = NULL;
         executor->jit_side_entry = NULL;
         executor->jit_size = 0;
-        if (jit_free(memory, size)) {
-            PyErr_WriteUnraisable(NULL);
-        }
+        arena_free(&_PyInterpreterState_GET()->jit_arena, memory, size);
     }
 }
 
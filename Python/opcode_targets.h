@@ -1,3 +1,4 @@
+#if !Py_TAIL_CALL_INTERP
 static void *opcode_targets[256] = {
     &&TARGET_CACHE,
     &&TARGET_BINARY_SLICE,
@@ -116,38 +117,38 @@ static void *opcode_targets[256] = {
     &&TARGET_UNPACK_EX,
     &&TARGET_UNPACK_SEQUENCE,
     &&TARGET_YIELD_VALUE,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
     &&TARGET_RESUME,
     &&TARGET_BINARY_OP_ADD_FLOAT,
     &&TARGET_BINARY_OP_ADD_INT,
@@ -227,15 +228,15 @@ static void *opcode_targets[256] = {
     &&TARGET_UNPACK_SEQUENCE_LIST,
     &&TARGET_UNPACK_SEQUENCE_TUPLE,
     &&TARGET_UNPACK_SEQUENCE_TWO_TUPLE,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
+    &&unknown_opcode,
     &&TARGET_INSTRUMENTED_END_FOR,
     &&TARGET_INSTRUMENTED_END_SEND,
     &&TARGET_INSTRUMENTED_LOAD_SUPER_ATTR,
@@ -256,3 +257,490 @@ static void *opcode_targets[256] = {
     &&TARGET_INSTRUMENTED_LINE,
     &&TARGET_ENTER_EXECUTOR,
 };
+#else /* Py_TAIL_CALL_INTERP */
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_unknown_opcode(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_pop_4_error(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_pop_3_error(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_pop_2_error(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_pop_1_error(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_error(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_exception_unwind(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_exit_unwind(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_resume_with_error(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_start_frame(TAIL_CALL_PARAMS);
+
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_BINARY_OP(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_BINARY_OP_ADD_FLOAT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_BINARY_OP_ADD_INT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_BINARY_OP_ADD_UNICODE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_BINARY_OP_INPLACE_ADD_UNICODE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_BINARY_OP_MULTIPLY_FLOAT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_BINARY_OP_MULTIPLY_INT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_BINARY_OP_SUBTRACT_FLOAT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_BINARY_OP_SUBTRACT_INT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_BINARY_SLICE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_BINARY_SUBSCR(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_BINARY_SUBSCR_DICT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_BINARY_SUBSCR_GETITEM(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_BINARY_SUBSCR_LIST_INT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_BINARY_SUBSCR_STR_INT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_BINARY_SUBSCR_TUPLE_INT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_BUILD_LIST(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_BUILD_MAP(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_BUILD_SET(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_BUILD_SLICE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_BUILD_STRING(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_BUILD_TUPLE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CACHE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_ALLOC_AND_ENTER_INIT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_BOUND_METHOD_EXACT_ARGS(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_BOUND_METHOD_GENERAL(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_BUILTIN_CLASS(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_BUILTIN_FAST(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_BUILTIN_FAST_WITH_KEYWORDS(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_BUILTIN_O(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_FUNCTION_EX(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_INTRINSIC_1(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_INTRINSIC_2(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_ISINSTANCE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_KW(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_KW_BOUND_METHOD(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_KW_NON_PY(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_KW_PY(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_LEN(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_LIST_APPEND(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_METHOD_DESCRIPTOR_FAST(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_METHOD_DESCRIPTOR_NOARGS(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_METHOD_DESCRIPTOR_O(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_NON_PY_GENERAL(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_PY_EXACT_ARGS(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_PY_GENERAL(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_STR_1(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_TUPLE_1(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_TYPE_1(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CHECK_EG_MATCH(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CHECK_EXC_MATCH(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CLEANUP_THROW(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_COMPARE_OP(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_COMPARE_OP_FLOAT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_COMPARE_OP_INT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_COMPARE_OP_STR(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CONTAINS_OP(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CONTAINS_OP_DICT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CONTAINS_OP_SET(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CONVERT_VALUE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_COPY(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_COPY_FREE_VARS(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_DELETE_ATTR(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_DELETE_DEREF(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_DELETE_FAST(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_DELETE_GLOBAL(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_DELETE_NAME(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_DELETE_SUBSCR(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_DICT_MERGE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_DICT_UPDATE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_END_ASYNC_FOR(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_END_FOR(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_END_SEND(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_ENTER_EXECUTOR(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_EXIT_INIT_CHECK(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_EXTENDED_ARG(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_FORMAT_SIMPLE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_FORMAT_WITH_SPEC(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_FOR_ITER(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_FOR_ITER_GEN(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_FOR_ITER_LIST(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_FOR_ITER_RANGE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_FOR_ITER_TUPLE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_GET_AITER(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_GET_ANEXT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_GET_AWAITABLE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_GET_ITER(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_GET_LEN(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_GET_YIELD_FROM_ITER(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_IMPORT_FROM(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_IMPORT_NAME(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_INSTRUMENTED_CALL(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_INSTRUMENTED_CALL_FUNCTION_EX(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_INSTRUMENTED_CALL_KW(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_INSTRUMENTED_END_FOR(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_INSTRUMENTED_END_SEND(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_INSTRUMENTED_FOR_ITER(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_INSTRUMENTED_INSTRUCTION(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_INSTRUMENTED_JUMP_BACKWARD(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_INSTRUMENTED_JUMP_FORWARD(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_INSTRUMENTED_LINE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_INSTRUMENTED_LOAD_SUPER_ATTR(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_INSTRUMENTED_POP_JUMP_IF_FALSE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_INSTRUMENTED_POP_JUMP_IF_NONE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_INSTRUMENTED_POP_JUMP_IF_NOT_NONE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_INSTRUMENTED_POP_JUMP_IF_TRUE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_INSTRUMENTED_RESUME(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_INSTRUMENTED_RETURN_VALUE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_INSTRUMENTED_YIELD_VALUE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_INTERPRETER_EXIT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_IS_OP(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_JUMP_BACKWARD(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_JUMP_BACKWARD_NO_INTERRUPT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_JUMP_FORWARD(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LIST_APPEND(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LIST_EXTEND(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_CLASS(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_CLASS_WITH_METACLASS_CHECK(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_INSTANCE_VALUE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_METHOD_LAZY_DICT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_METHOD_NO_DICT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_METHOD_WITH_VALUES(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_MODULE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_NONDESCRIPTOR_NO_DICT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_PROPERTY(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_SLOT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_WITH_HINT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_BUILD_CLASS(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_COMMON_CONSTANT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_CONST(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_CONST_IMMORTAL(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_DEREF(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_FAST(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_FAST_AND_CLEAR(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_FAST_CHECK(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_FAST_LOAD_FAST(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_FROM_DICT_OR_DEREF(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_FROM_DICT_OR_GLOBALS(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_GLOBAL(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_GLOBAL_BUILTIN(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_GLOBAL_MODULE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_LOCALS(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_NAME(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_SMALL_INT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_SPECIAL(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_SUPER_ATTR(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_SUPER_ATTR_ATTR(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_SUPER_ATTR_METHOD(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_MAKE_CELL(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_MAKE_DEFER_EXPR(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_MAKE_FUNCTION(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_MAP_ADD(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_MATCH_CLASS(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_MATCH_KEYS(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_MATCH_MAPPING(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_MATCH_SEQUENCE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_NOP(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_POP_EXCEPT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_POP_JUMP_IF_FALSE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_POP_JUMP_IF_NONE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_POP_JUMP_IF_NOT_NONE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_POP_JUMP_IF_TRUE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_POP_TOP(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_PUSH_EXC_INFO(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_PUSH_NULL(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_RAISE_VARARGS(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_RERAISE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_RESERVED(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_RESUME(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_RESUME_CHECK(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_RETURN_GENERATOR(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_RETURN_VALUE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_SEND(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_SEND_GEN(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_SETUP_ANNOTATIONS(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_SET_ADD(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_SET_FUNCTION_ATTRIBUTE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_SET_UPDATE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_STORE_ATTR(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_STORE_ATTR_INSTANCE_VALUE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_STORE_ATTR_SLOT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_STORE_ATTR_WITH_HINT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_STORE_DEREF(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_STORE_FAST(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_STORE_FAST_LOAD_FAST(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_STORE_FAST_STORE_FAST(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_STORE_GLOBAL(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_STORE_NAME(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_STORE_SLICE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_STORE_SUBSCR(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_STORE_SUBSCR_DICT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_STORE_SUBSCR_LIST_INT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_SWAP(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_TO_BOOL(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_TO_BOOL_ALWAYS_TRUE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_TO_BOOL_BOOL(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_TO_BOOL_INT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_TO_BOOL_LIST(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_TO_BOOL_NONE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_TO_BOOL_STR(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_UNARY_INVERT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_UNARY_NEGATIVE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_UNARY_NOT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_UNPACK_EX(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_UNPACK_SEQUENCE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_UNPACK_SEQUENCE_LIST(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_UNPACK_SEQUENCE_TUPLE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_UNPACK_SEQUENCE_TWO_TUPLE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_WITH_EXCEPT_START(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_YIELD_VALUE(TAIL_CALL_PARAMS);
+
+static const py_tail_call_funcptr INSTRUCTION_TABLE[256] = {
+    _TAIL_CALL_CACHE,
+    _TAIL_CALL_BINARY_SLICE,
+    _TAIL_CALL_BINARY_SUBSCR,
+    _TAIL_CALL_BINARY_OP_INPLACE_ADD_UNICODE,
+    _TAIL_CALL_CHECK_EG_MATCH,
+    _TAIL_CALL_CHECK_EXC_MATCH,
+    _TAIL_CALL_CLEANUP_THROW,
+    _TAIL_CALL_DELETE_SUBSCR,
+    _TAIL_CALL_END_ASYNC_FOR,
+    _TAIL_CALL_END_FOR,
+    _TAIL_CALL_END_SEND,
+    _TAIL_CALL_EXIT_INIT_CHECK,
+    _TAIL_CALL_FORMAT_SIMPLE,
+    _TAIL_CALL_FORMAT_WITH_SPEC,
+    _TAIL_CALL_GET_AITER,
+    _TAIL_CALL_GET_ANEXT,
+    _TAIL_CALL_GET_ITER,
+    _TAIL_CALL_RESERVED,
+    _TAIL_CALL_GET_LEN,
+    _TAIL_CALL_GET_YIELD_FROM_ITER,
+    _TAIL_CALL_INTERPRETER_EXIT,
+    _TAIL_CALL_LOAD_BUILD_CLASS,
+    _TAIL_CALL_LOAD_LOCALS,
+    _TAIL_CALL_MAKE_DEFER_EXPR,
+    _TAIL_CALL_MAKE_FUNCTION,
+    _TAIL_CALL_MATCH_KEYS,
+    _TAIL_CALL_MATCH_MAPPING,
+    _TAIL_CALL_MATCH_SEQUENCE,
+    _TAIL_CALL_NOP,
+    _TAIL_CALL_POP_EXCEPT,
+    _TAIL_CALL_POP_TOP,
+    _TAIL_CALL_PUSH_EXC_INFO,
+    _TAIL_CALL_PUSH_NULL,
+    _TAIL_CALL_RETURN_GENERATOR,
+    _TAIL_CALL_RETURN_VALUE,
+    _TAIL_CALL_SETUP_ANNOTATIONS,
+    _TAIL_CALL_STORE_SLICE,
+    _TAIL_CALL_STORE_SUBSCR,
+    _TAIL_CALL_TO_BOOL,
+    _TAIL_CALL_UNARY_INVERT,
+    _TAIL_CALL_UNARY_NEGATIVE,
+    _TAIL_CALL_UNARY_NOT,
+    _TAIL_CALL_WITH_EXCEPT_START,
+    _TAIL_CALL_BINARY_OP,
+    _TAIL_CALL_BUILD_LIST,
+    _TAIL_CALL_BUILD_MAP,
+    _TAIL_CALL_BUILD_SET,
+    _TAIL_CALL_BUILD_SLICE,
+    _TAIL_CALL_BUILD_STRING,
+    _TAIL_CALL_BUILD_TUPLE,
+    _TAIL_CALL_CALL,
+    _TAIL_CALL_CALL_FUNCTION_EX,
+    _TAIL_CALL_CALL_INTRINSIC_1,
+    _TAIL_CALL_CALL_INTRINSIC_2,
+    _TAIL_CALL_CALL_KW,
+    _TAIL_CALL_COMPARE_OP,
+    _TAIL_CALL_CONTAINS_OP,
+    _TAIL_CALL_CONVERT_VALUE,
+    _TAIL_CALL_COPY,
+    _TAIL_CALL_COPY_FREE_VARS,
+    _TAIL_CALL_DELETE_ATTR,
+    _TAIL_CALL_DELETE_DEREF,
+    _TAIL_CALL_DELETE_FAST,
+    _TAIL_CALL_DELETE_GLOBAL,
+    _TAIL_CALL_DELETE_NAME,
+    _TAIL_CALL_DICT_MERGE,
+    _TAIL_CALL_DICT_UPDATE,
+    _TAIL_CALL_EXTENDED_ARG,
+    _TAIL_CALL_FOR_ITER,
+    _TAIL_CALL_GET_AWAITABLE,
+    _TAIL_CALL_IMPORT_FROM,
+    _TAIL_CALL_IMPORT_NAME,
+    _TAIL_CALL_IS_OP,
+    _TAIL_CALL_JUMP_BACKWARD,
+    _TAIL_CALL_JUMP_BACKWARD_NO_INTERRUPT,
+    _TAIL_CALL_JUMP_FORWARD,
+    _TAIL_CALL_LIST_APPEND,
+    _TAIL_CALL_LIST_EXTEND,
+    _TAIL_CALL_LOAD_ATTR,
+    _TAIL_CALL_LOAD_COMMON_CONSTANT,
+    _TAIL_CALL_LOAD_CONST,
+    _TAIL_CALL_LOAD_DEREF,
+    _TAIL_CALL_LOAD_FAST,
+    _TAIL_CALL_LOAD_FAST_AND_CLEAR,
+    _TAIL_CALL_LOAD_FAST_CHECK,
+    _TAIL_CALL_LOAD_FAST_LOAD_FAST,
+    _TAIL_CALL_LOAD_FROM_DICT_OR_DEREF,
+    _TAIL_CALL_LOAD_FROM_DICT_OR_GLOBALS,
+    _TAIL_CALL_LOAD_GLOBAL,
+    _TAIL_CALL_LOAD_NAME,
+    _TAIL_CALL_LOAD_SMALL_INT,
+    _TAIL_CALL_LOAD_SPECIAL,
+    _TAIL_CALL_LOAD_SUPER_ATTR,
+    _TAIL_CALL_MAKE_CELL,
+    _TAIL_CALL_MAP_ADD,
+    _TAIL_CALL_MATCH_CLASS,
+    _TAIL_CALL_POP_JUMP_IF_FALSE,
+    _TAIL_CALL_POP_JUMP_IF_NONE,
+    _TAIL_CALL_POP_JUMP_IF_NOT_NONE,
+    _TAIL_CALL_POP_JUMP_IF_TRUE,
+    _TAIL_CALL_RAISE_VARARGS,
+    _TAIL_CALL_RERAISE,
+    _TAIL_CALL_SEND,
+    _TAIL_CALL_SET_ADD,
+    _TAIL_CALL_SET_FUNCTION_ATTRIBUTE,
+    _TAIL_CALL_SET_UPDATE,
+    _TAIL_CALL_STORE_ATTR,
+    _TAIL_CALL_STORE_DEREF,
+    _TAIL_CALL_STORE_FAST,
+    _TAIL_CALL_STORE_FAST_LOAD_FAST,
+    _TAIL_CALL_STORE_FAST_STORE_FAST,
+    _TAIL_CALL_STORE_GLOBAL,
+    _TAIL_CALL_STORE_NAME,
+    _TAIL_CALL_SWAP,
+    _TAIL_CALL_UNPACK_EX,
+    _TAIL_CALL_UNPACK_SEQUENCE,
+    _TAIL_CALL_YIELD_VALUE,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_RESUME,
+    _TAIL_CALL_BINARY_OP_ADD_FLOAT,
+    _TAIL_CALL_BINARY_OP_ADD_INT,
+    _TAIL_CALL_BINARY_OP_ADD_UNICODE,
+    _TAIL_CALL_BINARY_OP_MULTIPLY_FLOAT,
+    _TAIL_CALL_BINARY_OP_MULTIPLY_INT,
+    _TAIL_CALL_BINARY_OP_SUBTRACT_FLOAT,
+    _TAIL_CALL_BINARY_OP_SUBTRACT_INT,
+    _TAIL_CALL_BINARY_SUBSCR_DICT,
+    _TAIL_CALL_BINARY_SUBSCR_GETITEM,
+    _TAIL_CALL_BINARY_SUBSCR_LIST_INT,
+    _TAIL_CALL_BINARY_SUBSCR_STR_INT,
+    _TAIL_CALL_BINARY_SUBSCR_TUPLE_INT,
+    _TAIL_CALL_CALL_ALLOC_AND_ENTER_INIT,
+    _TAIL_CALL_CALL_BOUND_METHOD_EXACT_ARGS,
+    _TAIL_CALL_CALL_BOUND_METHOD_GENERAL,
+    _TAIL_CALL_CALL_BUILTIN_CLASS,
+    _TAIL_CALL_CALL_BUILTIN_FAST,
+    _TAIL_CALL_CALL_BUILTIN_FAST_WITH_KEYWORDS,
+    _TAIL_CALL_CALL_BUILTIN_O,
+    _TAIL_CALL_CALL_ISINSTANCE,
+    _TAIL_CALL_CALL_KW_BOUND_METHOD,
+    _TAIL_CALL_CALL_KW_NON_PY,
+    _TAIL_CALL_CALL_KW_PY,
+    _TAIL_CALL_CALL_LEN,
+    _TAIL_CALL_CALL_LIST_APPEND,
+    _TAIL_CALL_CALL_METHOD_DESCRIPTOR_FAST,
+    _TAIL_CALL_CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS,
+    _TAIL_CALL_CALL_METHOD_DESCRIPTOR_NOARGS,
+    _TAIL_CALL_CALL_METHOD_DESCRIPTOR_O,
+    _TAIL_CALL_CALL_NON_PY_GENERAL,
+    _TAIL_CALL_CALL_PY_EXACT_ARGS,
+    _TAIL_CALL_CALL_PY_GENERAL,
+    _TAIL_CALL_CALL_STR_1,
+    _TAIL_CALL_CALL_TUPLE_1,
+    _TAIL_CALL_CALL_TYPE_1,
+    _TAIL_CALL_COMPARE_OP_FLOAT,
+    _TAIL_CALL_COMPARE_OP_INT,
+    _TAIL_CALL_COMPARE_OP_STR,
+    _TAIL_CALL_CONTAINS_OP_DICT,
+    _TAIL_CALL_CONTAINS_OP_SET,
+    _TAIL_CALL_FOR_ITER_GEN,
+    _TAIL_CALL_FOR_ITER_LIST,
+    _TAIL_CALL_FOR_ITER_RANGE,
+    _TAIL_CALL_FOR_ITER_TUPLE,
+    _TAIL_CALL_LOAD_ATTR_CLASS,
+    _TAIL_CALL_LOAD_ATTR_CLASS_WITH_METACLASS_CHECK,
+    _TAIL_CALL_LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN,
+    _TAIL_CALL_LOAD_ATTR_INSTANCE_VALUE,
+    _TAIL_CALL_LOAD_ATTR_METHOD_LAZY_DICT,
+    _TAIL_CALL_LOAD_ATTR_METHOD_NO_DICT,
+    _TAIL_CALL_LOAD_ATTR_METHOD_WITH_VALUES,
+    _TAIL_CALL_LOAD_ATTR_MODULE,
+    _TAIL_CALL_LOAD_ATTR_NONDESCRIPTOR_NO_DICT,
+    _TAIL_CALL_LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES,
+    _TAIL_CALL_LOAD_ATTR_PROPERTY,
+    _TAIL_CALL_LOAD_ATTR_SLOT,
+    _TAIL_CALL_LOAD_ATTR_WITH_HINT,
+    _TAIL_CALL_LOAD_CONST_IMMORTAL,
+    _TAIL_CALL_LOAD_GLOBAL_BUILTIN,
+    _TAIL_CALL_LOAD_GLOBAL_MODULE,
+    _TAIL_CALL_LOAD_SUPER_ATTR_ATTR,
+    _TAIL_CALL_LOAD_SUPER_ATTR_METHOD,
+    _TAIL_CALL_RESUME_CHECK,
+    _TAIL_CALL_SEND_GEN,
+    _TAIL_CALL_STORE_ATTR_INSTANCE_VALUE,
+    _TAIL_CALL_STORE_ATTR_SLOT,
+    _TAIL_CALL_STORE_ATTR_WITH_HINT,
+    _TAIL_CALL_STORE_SUBSCR_DICT,
+    _TAIL_CALL_STORE_SUBSCR_LIST_INT,
+    _TAIL_CALL_TO_BOOL_ALWAYS_TRUE,
+    _TAIL_CALL_TO_BOOL_BOOL,
+    _TAIL_CALL_TO_BOOL_INT,
+    _TAIL_CALL_TO_BOOL_LIST,
+    _TAIL_CALL_TO_BOOL_NONE,
+    _TAIL_CALL_TO_BOOL_STR,
+    _TAIL_CALL_UNPACK_SEQUENCE_LIST,
+    _TAIL_CALL_UNPACK_SEQUENCE_TUPLE,
+    _TAIL_CALL_UNPACK_SEQUENCE_TWO_TUPLE,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_unknown_opcode,
+    _TAIL_CALL_INSTRUMENTED_END_FOR,
+    _TAIL_CALL_INSTRUMENTED_END_SEND,
+    _TAIL_CALL_INSTRUMENTED_LOAD_SUPER_ATTR,
+    _TAIL_CALL_INSTRUMENTED_FOR_ITER,
+    _TAIL_CALL_INSTRUMENTED_CALL_KW,
+    _TAIL_CALL_INSTRUMENTED_CALL_FUNCTION_EX,
+    _TAIL_CALL_INSTRUMENTED_INSTRUCTION,
+    _TAIL_CALL_INSTRUMENTED_JUMP_FORWARD,
+    _TAIL_CALL_INSTRUMENTED_POP_JUMP_IF_TRUE,
+    _TAIL_CALL_INSTRUMENTED_POP_JUMP_IF_FALSE,
+    _TAIL_CALL_INSTRUMENTED_POP_JUMP_IF_NONE,
+    _TAIL_CALL_INSTRUMENTED_POP_JUMP_IF_NOT_NONE,
+    _TAIL_CALL_INSTRUMENTED_RESUME,
+    _TAIL_CALL_INSTRUMENTED_RETURN_VALUE,
+    _TAIL_CALL_INSTRUMENTED_YIELD_VALUE,
+    _TAIL_CALL_INSTRUMENTED_CALL,
+    _TAIL_CALL_INSTRUMENTED_JUMP_BACKWARD,
+    _TAIL_CALL_INSTRUMENTED_LINE,
+    _TAIL_CALL_ENTER_EXECUTOR,
+};
+#endif /* Py_TAIL_CALL_INTERP */
@@ -9,6 +9,8 @@
 #include "pycore_opcode_metadata.h" // _PyOpcode_OpName[]
 #include "pycore_opcode_utils.h"  // MAX_REAL_OPCODE
 #include "pycore_optimizer.h"     // _Py_uop_analyze_and_optimize()
+#include "pycore_pyatomic_ft_wrappers.h"
+#include "pycore_pyhash.h"        // _Py_KeyedHash()
 #include "pycore_pystate.h"       // _PyInterpreterState_GET()
 #include "pycore_uop_ids.h"
 #include "pycore_jit.h"
@@ -222,6 +224,221 @@ _Py_GetExecutor(PyCodeObject *code, int offset)
     return NULL;
 }
 
+/* Make the backward jump at the given byte offset trigger the optimizer the
+ * next time it is executed, rather than waiting for the loop to warm up.
+ * This lets a hot loop seen by a previous run of the program (as found by
+ * _Py_GetExecutor) be compiled straight away. The trace itself is rebuilt
+ * from scratch, so it only reflects the state of the current process.
+ * Returns 1 if the jump was primed, 0 if there is nothing to do (the jump
+ * already has an executor, or is instrumented), and -1 with an exception
+ * set if there is no backward jump at offset. */
+int
+_Py_PrimeExecutor(PyCodeObject *code, int offset)
+{
+    int code_len = (int)Py_SIZE(code);
+    for (int i = 0 ; i < code_len;) {
+        _Py_CODEUNIT *instr = &_PyCode_CODE(code)[i];
+        if (i*2 == offset) {
+            // Executors are inserted before any EXTENDED_ARGs:
+            while (FT_ATOMIC_LOAD_UINT8_RELAXED(instr->op.code) == EXTENDED_ARG) {
+                instr++;
+            }
+            switch (FT_ATOMIC_LOAD_UINT8_RELAXED(instr->op.code)) {
+                case JUMP_BACKWARD:
+                    FT_ATOMIC_STORE_UINT16_RELAXED(
+                        instr[1].counter.value_and_backoff,
+                        make_backoff_counter(
+                            0, JUMP_BACKWARD_INITIAL_BACKOFF).value_and_backoff);
+                    return 1;
+                case ENTER_EXECUTOR:
+                case INSTRUMENTED_JUMP_BACKWARD:
+                    return 0;
+            }
+            break;
+        }
+        i += _PyInstruction_GetLength(code, i);
+    }
+    PyErr_SetString(PyExc_ValueError, "no backward jump at given byte offset");
+    return -1;
+}
+
+/* The trace cache (-X trace_cache) carries over, from one run of a program to
+ * the next, which loops ended up with an executor.  The import system saves it
+ * next to each module's bytecode, as a dict mapping a key for each code object
+ * to the byte offsets of its hot backward jumps, and primes those jumps when the
+ * module is loaded again (see SourceLoader.get_code).
+ *
+ * Code objects are keyed by qualified name, first line number and a hash of
+ * their bytecode, so entries recorded for different source are never applied.
+ * Traces themselves are not stored: their operands are pointers and type,
+ * function and dict keys versions that only mean something in the process
+ * that recorded them.  A primed loop gets its trace rebuilt, and so
+ * revalidated against the live objects, the first time it goes round. */
+
+static PyObject *
+trace_cache_key(PyCodeObject *code)
+{
+    PyObject *co_code = _PyCode_GetCode(code);
+    if (co_code == NULL) {
+        return NULL;
+    }
+    uint64_t hash = _Py_KeyedHash(0, PyBytes_AS_STRING(co_code),
+                                  PyBytes_GET_SIZE(co_code));
+    Py_DECREF(co_code);
+    return Py_BuildValue("(OiK)", code->co_qualname, code->co_firstlineno,
+                         (unsigned long long)hash);
+}
+
+static int
+trace_cache_visit(PyCodeObject *code,
+                  int (*visit)(PyCodeObject *, PyObject *, PyObject *),
+                  PyObject *cache, PyObject *arg)
+{
+    if (visit(code, cache, arg) < 0) {
+        return -1;
+    }
+    PyObject *consts = code->co_consts;
+    for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(consts); i++) {
+        PyObject *item = PyTuple_GET_ITEM(consts, i);
+        if (PyCode_Check(item) &&
+            trace_cache_visit((PyCodeObject *)item, visit, cache, arg) < 0)
+        {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int
+add_offset(PyObject *offsets, int offset)
+{
+    PyObject *item = PyLong_FromLong(offset);
+    if (item == NULL) {
+        return -1;
+    }
+    int res = PySet_Add(offsets, item);
+    Py_DECREF(item);
+    return res;
+}
+
+static int
+add_hot_loops(PyCodeObject *code, PyObject *cache, PyObject *loaded)
+{
+    PyObject *key = trace_cache_key(code);
+    if (key == NULL) {
+        return -1;
+    }
+    PyObject *offsets = PySet_New(NULL);
+    if (offsets == NULL) {
+        goto error;
+    }
+    // Keep the loops that were hot in earlier runs, even if they weren't
+    // reached in this one:
+    PyObject *old;
+    if (PyDict_GetItemRef(loaded, key, &old) < 0) {
+        goto error;
+    }
+    if (old != NULL) {
+        for (Py_ssize_t i = 0; PyTuple_Check(old) && i < PyTuple_GET_SIZE(old); i++) {
+            int offset = PyLong_AsInt(PyTuple_GET_ITEM(old, i));
+            if (offset == -1 && PyErr_Occurred()) {
+                PyErr_Clear();
+            }
+            else if (add_offset(offsets, offset) < 0) {
+                Py_DECREF(old);
+                goto error;
+            }
+        }
+        Py_DECREF(old);
+    }
+    int code_len = (int)Py_SIZE(code);
+    for (int i = 0; code->co_executors != NULL && i < code_len;) {
+        _Py_CODEUNIT *instr = &_PyCode_CODE(code)[i];
+        if (instr->op.code == ENTER_EXECUTOR &&
+            code->co_executors->executors[instr->op.arg]->vm_data.valid &&
+            add_offset(offsets, i * 2) < 0)
+        {
+            goto error;
+        }
+        i += _PyInstruction_GetLength(code, i);
+    }
+    if (PySet_GET_SIZE(offsets)) {
+        PyObject *list = PySequence_List(offsets);
+        if (list == NULL || PyList_Sort(list) < 0) {
+            Py_XDECREF(list);
+            goto error;
+        }
+        Py_SETREF(offsets, PyList_AsTuple(list));
+        Py_DECREF(list);
+        if (offsets == NULL || PyDict_SetItem(cache, key, offsets) < 0) {
+            goto error;
+        }
+    }
+    Py_DECREF(offsets);
+    Py_DECREF(key);
+    return 0;
+error:
+    Py_XDECREF(offsets);
+    Py_DECREF(key);
+    return -1;
+}
+
+/* Return the trace cache entries for code and the code objects nested in it,
+ * as a new dict: the loops that have executors, plus those listed in loaded
+ * (a cache returned by an earlier call, possibly in an earlier run). */
+PyObject *
+_Py_GetTraceCache(PyCodeObject *code, PyObject *loaded)
+{
+    assert(PyDict_Check(loaded));
+    PyObject *cache = PyDict_New();
+    if (cache == NULL) {
+        return NULL;
+    }
+    if (trace_cache_visit(code, add_hot_loops, cache, loaded) < 0) {
+        Py_DECREF(cache);
+        return NULL;
+    }
+    return cache;
+}
+
+static int
+prime_cached_loops(PyCodeObject *code, PyObject *cache,
+                   PyObject *Py_UNUSED(arg))
+{
+    PyObject *key = trace_cache_key(code);
+    if (key == NULL) {
+        return -1;
+    }
+    PyObject *offsets;
+    int res = PyDict_GetItemRef(cache, key, &offsets);
+    Py_DECREF(key);
+    if (res <= 0) {
+        return res;
+    }
+    // The cache comes from a file, so ignore anything malformed:
+    if (PyTuple_Check(offsets)) {
+        for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(offsets); i++) {
+            int offset = PyLong_AsInt(PyTuple_GET_ITEM(offsets, i));
+            if ((offset == -1 && PyErr_Occurred()) ||
+                _Py_PrimeExecutor(code, offset) < 0)
+            {
+                PyErr_Clear();
+            }
+        }
+    }
+    Py_DECREF(offsets);
+    return 0;
+}
+
+/* Prime the loops of code, and of the code objects nested in it, that cache
+ * (as returned by _Py_GetTraceCache in an earlier run) lists as hot. */
+int
+_Py_LoadTraceCache(PyCodeObject *code, PyObject *cache)
+{
+    assert(PyDict_Check(cache));
+    return trace_cache_visit(code, prime_cached_loops, cache, NULL);
+}
+
 static PyObject *
 is_valid(PyObject *self, PyObject *Py_UNUSED(ignored))
 {
@@ -986,10 +1203,23 @@ prepare_for_execution(_PyUOpInstruction *buffer, int length)
     int32_t current_error_target = -1;
     int32_t current_popped = -1;
     int32_t current_exit_op = -1;
+    /* A peeled loop jumps back to the start of the second copy of its
+     * body (see peel_loop), which moves when the NOPs are removed */
+    int loop_head = 0;
+    for (int i = 0; i < length; i++) {
+        if (buffer[i].opcode == _JUMP_TO_TOP) {
+            loop_head = buffer[i].oparg;
+            break;
+        }
+    }
+    int32_t loop_target = 1;
     /* Leaving in NOPs slows down the interpreter and messes up the stats */
     _PyUOpInstruction *copy_to = &buffer[0];
     for (int i = 0; i < length; i++) {
         _PyUOpInstruction *inst = &buffer[i];
+        if (loop_head != 0 && i == loop_head) {
+            loop_target = (int32_t)(copy_to - buffer);
+        }
         if (inst->opcode != _NOP) {
             if (copy_to != inst) {
                 *copy_to = *inst;
@@ -999,13 +1229,27 @@ prepare_for_execution(_PyUOpInstruction *buffer, int length)
     }
     length = (int)(copy_to - buffer);
     int next_spare = length;
+    /* Each exit and error in the body of an inlined call gets its own
+     * stub, which drops the `depth` values that the body has pushed above
+     * the call's arguments by then */
+    bool inlined = false;
+    int depth = 0;
     for (int i = 0; i < length; i++) {
         _PyUOpInstruction *inst = &buffer[i];
         int opcode = inst->opcode;
         int32_t target = (int32_t)uop_get_target(inst);
+        if (opcode == _ENTER_INLINED_CALL || opcode == _RETURN_INLINED) {
+            inlined = opcode == _ENTER_INLINED_CALL;
+            depth = 0;
+            current_jump_target = -1;
+            current_error_target = -1;
+        }
         if (_PyUop_Flags[opcode] & (HAS_EXIT_FLAG | HAS_DEOPT_FLAG)) {
             uint16_t exit_op = (_PyUop_Flags[opcode] & HAS_EXIT_FLAG) ?
                 _EXIT_TRACE : _DEOPT;
+            if (inlined) {
+                exit_op = _EXIT_INLINED_CALL;
+            }
             int32_t jump_target = target;
             if (is_for_iter_test[opcode]) {
                 /* Target the POP_TOP immediately after the END_FOR,
@@ -1014,8 +1258,13 @@ prepare_for_execution(_PyUOpInstruction *buffer, int length)
                 int32_t next_inst = target + 1 + INLINE_CACHE_ENTRIES_FOR_ITER + extended_arg;
                 jump_target = next_inst + inst->oparg + 1;
             }
-            if (jump_target != current_jump_target || current_exit_op != exit_op) {
+            if (inlined || jump_target != current_jump_target ||
+                current_exit_op != exit_op)
+            {
                 make_exit(&buffer[next_spare], exit_op, jump_target);
+                if (inlined) {
+                    buffer[next_spare].operand0 = depth;
+                }
                 current_exit_op = exit_op;
                 current_jump_target = jump_target;
                 current_jump = next_spare;
@@ -1027,13 +1276,21 @@ prepare_for_execution(_PyUOpInstruction *buffer, int length)
         if (_PyUop_Flags[opcode] & HAS_ERROR_FLAG) {
             int popped = (_PyUop_Flags[opcode] & HAS_ERROR_NO_POP_FLAG) ?
                 0 : _PyUop_num_popped(opcode, inst->oparg);
-            if (target != current_error_target || popped != current_popped) {
+            if (inlined || target != current_error_target ||
+                popped != current_popped)
+            {
                 current_popped = popped;
                 current_error = next_spare;
                 current_error_target = target;
-                make_exit(&buffer[next_spare], _ERROR_POP_N, 0);
+                if (inlined) {
+                    make_exit(&buffer[next_spare], _EXIT_INLINED_CALL, target);
+                    buffer[next_spare].operand0 = depth - popped;
+                }
+                else {
+                    make_exit(&buffer[next_spare], _ERROR_POP_N, 0);
+                    buffer[next_spare].operand0 = target;
+                }
                 buffer[next_spare].oparg = popped;
-                buffer[next_spare].operand0 = target;
                 next_spare++;
             }
             buffer[i].error_target = current_error;
@@ -1045,7 +1302,13 @@ prepare_for_execution(_PyUOpInstruction *buffer, int length)
         if (opcode == _JUMP_TO_TOP) {
             assert(buffer[0].opcode == _START_EXECUTOR);
             buffer[i].format = UOP_FORMAT_JUMP;
-            buffer[i].jump_target = 1;
+            buffer[i].oparg = loop_target;
+            buffer[i].jump_target = loop_target;
+        }
+        if (inlined) {
+            depth += _PyUop_num_pushed(opcode, inst->oparg) -
+                     _PyUop_num_popped(opcode, inst->oparg);
+            assert(depth >= 0);
         }
     }
     return next_spare;
@@ -1121,7 +1384,8 @@ sanity_check(_PyExecutorObject *executor)
         CHECK(
             opcode == _DEOPT ||
             opcode == _EXIT_TRACE ||
-            opcode == _ERROR_POP_N);
+            opcode == _ERROR_POP_N ||
+            opcode == _EXIT_INLINED_CALL);
     }
 }
 
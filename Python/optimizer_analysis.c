@@ -401,6 +401,26 @@ eliminate_pop_guard(_PyUOpInstruction *this_instr, bool exit)
     }
 }
 
+/* For `x = x + y` and friends on floats: if the result is stored straight
+ * back into the local the left operand was loaded from, let the operation do
+ * the store, so that it can reuse the float rather than allocate a new one.
+ * remove_unneeded_uops() removes the then redundant _STORE_FAST. */
+static void
+optimize_float_store(_PyUOpInstruction *this_instr, _Py_UOpsContext *ctx,
+                     _Py_UopsSymbol *left, int opcode)
+{
+    _PyUOpInstruction *next = this_instr + 1;
+    while (next->opcode == _SET_IP ||
+           next->opcode == _CHECK_VALIDITY ||
+           next->opcode == _CHECK_VALIDITY_AND_SET_IP)
+    {
+        next++;
+    }
+    if (next->opcode == _STORE_FAST && GETLOCAL(next->oparg) == left) {
+        REPLACE_OP(this_instr, opcode, next->oparg, 0);
+    }
+}
+
 /* _PUSH_FRAME/_RETURN_VALUE's operand can be 0, a PyFunctionObject *, or a
  * PyCodeObject *. Retrieve the code object if possible.
  */
@@ -449,14 +469,86 @@ get_code_with_logging(_PyUOpInstruction *op)
     return co;
 }
 
-/* 1 for success, 0 for not ready, cannot error at the moment. */
+/* What the abstract interpreter knew about the locals and stack
+ * of the outermost frame on reaching the head of a peeled loop. */
+typedef struct {
+    int count;
+    int stack_level;
+    _Py_UopsSymbol **slots;
+    _Py_UopsSymbol *facts;
+} loop_head_state;
+
+static _Py_UopsSymbol *
+frame_slot(_Py_UOpsAbstractFrame *frame, int i)
+{
+    if (i < frame->locals_len) {
+        return frame->locals[i];
+    }
+    return frame->stack[i - frame->locals_len];
+}
+
+static int
+save_loop_head(_Py_UOpsContext *ctx, loop_head_state *head)
+{
+    _Py_UOpsAbstractFrame *frame = ctx->frame;
+    int stack_level = (int)(frame->stack_pointer - frame->stack);
+    int count = frame->locals_len + stack_level;
+    head->slots = PyMem_Malloc(count * (sizeof(_Py_UopsSymbol *) + sizeof(_Py_UopsSymbol)));
+    if (head->slots == NULL) {
+        return 0;
+    }
+    head->facts = (_Py_UopsSymbol *)(head->slots + count);
+    head->count = count;
+    head->stack_level = stack_level;
+    for (int i = 0; i < count; i++) {
+        head->slots[i] = frame_slot(frame, i);
+        head->facts[i] = *head->slots[i];
+    }
+    return 1;
+}
+
+/* Going round the loop again is only safe if everything the second copy
+ * of the body was optimized under still holds at the back edge: every
+ * fact known at the head is still known, and any slots that shared a
+ * symbol at the head still share one. */
+static bool
+loop_head_holds(_Py_UOpsContext *ctx, loop_head_state *head)
+{
+    _Py_UOpsAbstractFrame *frame = ctx->frame;
+    if (ctx->curr_frame_depth != 1 ||
+        frame->stack_pointer - frame->stack != head->stack_level) {
+        return false;
+    }
+    for (int i = 0; i < head->count; i++) {
+        _Py_UopsSymbol *sym = frame_slot(frame, i);
+        if (!_Py_uop_sym_refines(sym, &head->facts[i])) {
+            return false;
+        }
+        for (int j = 0; j < i; j++) {
+            if (head->slots[j] == head->slots[i]) {
+                if (frame_slot(frame, j) != sym) {
+                    return false;
+                }
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+/* 1 for success, 0 for not ready, cannot error at the moment.
+ * If loop_head is non-zero, the trace is a peeled loop whose back edge
+ * targets loop_head, and *loop_ok is set to whether the optimizations
+ * made in the second copy of the body are valid for every iteration. */
 static int
 optimize_uops(
     PyCodeObject *co,
     _PyUOpInstruction *trace,
     int trace_len,
     int curr_stacklen,
-    _PyBloomFilter *dependencies
+    _PyBloomFilter *dependencies,
+    int loop_head,
+    bool *loop_ok
 )
 {
 
@@ -479,10 +571,16 @@ optimize_uops(
     ctx->out_of_space = false;
     ctx->contradiction = false;
 
+    loop_head_state head = {0};
     _PyUOpInstruction *this_instr = NULL;
     for (int i = 0; !ctx->done; i++) {
         assert(i < trace_len);
         this_instr = &trace[i];
+        if (loop_head != 0 && i == loop_head) {
+            if (!save_loop_head(ctx, &head)) {
+                break;
+            }
+        }
 
         int oparg = this_instr->oparg;
         opcode = this_instr->opcode;
@@ -513,6 +611,19 @@ optimize_uops(
         DPRINTF(3, "\n");
         DPRINTF(1, "Out of space in abstract interpreter\n");
     }
+    if (loop_head != 0) {
+        *loop_ok = (head.slots != NULL &&
+                    !ctx->out_of_space && !ctx->contradiction &&
+                    this_instr == &trace[trace_len - 1] &&
+                    this_instr->opcode == _JUMP_TO_TOP &&
+                    loop_head_holds(ctx, &head));
+        PyMem_Free(head.slots);
+        if (!*loop_ok) {
+            DPRINTF(1, "Peeled loop doesn't reach a fixed point\n");
+            _Py_uop_abstractcontext_fini(ctx);
+            return 0;
+        }
+    }
     if (ctx->contradiction) {
         // Attempted to push a "bottom" (contradiction) symbol onto the stack.
         // This means that the abstract interpreter has hit unreachable code.
@@ -550,6 +661,21 @@ optimize_uops(
 }
 
 
+static int
+float_store_to_binary_op(int opcode)
+{
+    switch (opcode) {
+        case _BINARY_OP_ADD_FLOAT_STORE_FAST:
+            return _BINARY_OP_ADD_FLOAT;
+        case _BINARY_OP_SUBTRACT_FLOAT_STORE_FAST:
+            return _BINARY_OP_SUBTRACT_FLOAT;
+        case _BINARY_OP_MULTIPLY_FLOAT_STORE_FAST:
+            return _BINARY_OP_MULTIPLY_FLOAT;
+        default:
+            Py_UNREACHABLE();
+    }
+}
+
 static int
 remove_unneeded_uops(_PyUOpInstruction *buffer, int buffer_size)
 {
@@ -606,6 +732,32 @@ remove_unneeded_uops(_PyUOpInstruction *buffer, int buffer_size)
                 }
                 break;
             }
+            case _BINARY_OP_ADD_FLOAT_STORE_FAST:
+            case _BINARY_OP_SUBTRACT_FLOAT_STORE_FAST:
+            case _BINARY_OP_MULTIPLY_FLOAT_STORE_FAST:
+            {
+                /* The operation does the store itself, so the _STORE_FAST
+                 * goes, along with the _SET_IP and _CHECK_VALIDITY for it.
+                 * The operation doesn't escape, so the validity check is
+                 * only needed if something before it escaped. */
+                if (may_have_escaped) {
+                    buffer[pc].opcode = float_store_to_binary_op(opcode);
+                    buffer[pc].oparg = 0;
+                    break;
+                }
+                int store = pc + 1;
+                while (buffer[store].opcode != _STORE_FAST) {
+                    assert(buffer[store].opcode == _SET_IP ||
+                           buffer[store].opcode == _CHECK_VALIDITY ||
+                           buffer[store].opcode == _CHECK_VALIDITY_AND_SET_IP);
+                    buffer[store].opcode = _NOP;
+                    store++;
+                }
+                assert(buffer[store].oparg == buffer[pc].oparg);
+                buffer[store].opcode = _NOP;
+                pc = store;
+                break;
+            }
             case _JUMP_TO_TOP:
             case _EXIT_TRACE:
             case _DYNAMIC_EXIT:
@@ -635,6 +787,240 @@ remove_unneeded_uops(_PyUOpInstruction *buffer, int buffer_size)
     Py_UNREACHABLE();
 }
 
+/* Peel the first iteration off a loop trace, so that
+ *     _START_EXECUTOR body _JUMP_TO_TOP
+ * becomes
+ *     _START_EXECUTOR body body' _JUMP_TO_TOP
+ * with the back edge going to body'. The guards in body' that are
+ * implied by body can then be removed, leaving only the ones that
+ * actually vary between iterations inside the loop.
+ * Returns the index of body' (stored in the oparg of _JUMP_TO_TOP),
+ * 0 if the trace isn't peeled, or -1 on error. On success *unpeeled
+ * is set to a copy of the original trace to fall back on. */
+static int
+peel_loop(_PyUOpInstruction *buffer, int length, _PyUOpInstruction **unpeeled)
+{
+    if (buffer[length - 1].opcode != _JUMP_TO_TOP) {
+        return 0;
+    }
+    assert(buffer[0].opcode == _START_EXECUTOR);
+    int body = length - 2;
+    /* Leave room for the exit and error stubs of both copies */
+    int stubs = 0;
+    for (int i = 1; i <= body; i++) {
+        int flags = _PyUop_Flags[buffer[i].opcode];
+        if (flags & (HAS_EXIT_FLAG | HAS_DEOPT_FLAG)) {
+            stubs++;
+        }
+        if (flags & HAS_ERROR_FLAG) {
+            stubs++;
+        }
+    }
+    if (length + body + 2 * stubs >= UOP_MAX_TRACE_LENGTH) {
+        return 0;
+    }
+    *unpeeled = PyMem_Malloc(length * sizeof(_PyUOpInstruction));
+    if (*unpeeled == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    memcpy(*unpeeled, buffer, length * sizeof(_PyUOpInstruction));
+    int loop_head = length - 1;
+    memcpy(&buffer[loop_head], &buffer[1], body * sizeof(_PyUOpInstruction));
+    buffer[loop_head + body] = (*unpeeled)[length - 1];
+    buffer[loop_head + body].oparg = loop_head;
+    return loop_head;
+}
+
+#define MAX_INLINED_UOPS 16
+
+/* Uops that can appear in the body of an inlined call. They must not
+ * escape, use the frame or have side effects, since an exit from the
+ * body just throws its work away and runs the call again in tier 1. */
+static bool
+is_inlinable(int opcode)
+{
+    switch (opcode) {
+        case _INIT_CALL_PY_EXACT_ARGS:
+            return false;
+        case _LOAD_SMALL_INT:
+        case _TO_BOOL_BOOL:
+        case _TO_BOOL_INT:
+        case _TO_BOOL_LIST:
+        case _TO_BOOL_NONE:
+        case _TO_BOOL_STR:
+        case _GUARD_BOTH_INT:
+        case _GUARD_NOS_INT:
+        case _GUARD_TOS_INT:
+        case _GUARD_BOTH_FLOAT:
+        case _GUARD_NOS_FLOAT:
+        case _GUARD_TOS_FLOAT:
+        case _GUARD_BOTH_UNICODE:
+        case _BINARY_SUBSCR_LIST_INT:
+        case _BINARY_SUBSCR_STR_INT:
+        case _BINARY_SUBSCR_TUPLE_INT:
+        case _COMPARE_OP_INT:
+        case _COMPARE_OP_FLOAT:
+        case _COMPARE_OP_STR:
+        case _IS_OP:
+        case _GUARD_TYPE_VERSION:
+        case _CHECK_MANAGED_OBJECT_HAS_VALUES:
+        case _LOAD_ATTR_INSTANCE_VALUE:
+        case _LOAD_ATTR_SLOT:
+        case _BUILD_TUPLE:
+            return true;
+    }
+    int flags = _PyUop_Flags[opcode];
+    return (flags & HAS_PURE_FLAG) &&
+        !(flags & (HAS_LOCAL_FLAG | HAS_CONST_FLAG));
+}
+
+/* Replace the _PUSH_FRAME ... _RETURN_VALUE of a call made by the
+ * _INIT_CALL_PY_EXACT_ARGS at start with the callee's uops, if it is
+ * short enough and only uses is_inlinable() uops. Its arguments are
+ * read with _COPY, and _RETURN_INLINED pops them along with the
+ * callable, leaving the return value. Exits from the body go back to
+ * the CALL (see prepare_for_execution).
+ * Reuses the slots of the uops that go away, so nothing outside the
+ * call moves. Returns the index of the last uop of the call. */
+static int
+inline_call(_PyUOpInstruction *buffer, int start, int length, int loop_head)
+{
+    _PyUOpInstruction *push_frame = &buffer[start + 2];
+    if (start + 2 >= length ||
+        buffer[start + 1].opcode != _SAVE_RETURN_OFFSET ||
+        push_frame->opcode != _PUSH_FRAME) {
+        return start;
+    }
+    PyCodeObject *co = get_code(push_frame);
+    if (co == NULL) {
+        return start;
+    }
+    int argc = buffer[start].oparg;
+    int nargs = co->co_argcount;
+    /* The callee has no locals other than its arguments, which
+     * include self for a bound method, and there is room for its
+     * temporaries (see _INIT_CALL_PY_EXACT_ARGS in
+     * optimizer_bytecodes.c). */
+    if (co->co_nlocalsplus != nargs || (nargs != argc && nargs != argc + 1) ||
+        co->co_stacksize > (int)buffer[start].operand0)
+    {
+        return start;
+    }
+    /* Find the _RETURN_VALUE, checking that the body can be rewritten
+     * in place: a _LOAD_FAST_LOAD_FAST takes two slots, so must not get
+     * ahead of the uops that are being read. */
+    int depth = 0;
+    int body = 0;
+    int write = start + 1;
+    int end = -1;
+    for (int pc = start + 3; pc < length; pc++) {
+        int opcode = buffer[pc].opcode;
+        int oparg = buffer[pc].oparg;
+        if (opcode == _RETURN_VALUE) {
+            if (depth == 1) {
+                end = pc;
+            }
+            break;
+        }
+        switch (opcode) {
+            case _NOP:
+            case _RESUME_CHECK:
+            case _SET_IP:
+            case _CHECK_VALIDITY:
+            case _CHECK_VALIDITY_AND_SET_IP:
+                continue;
+            case _LOAD_FAST:
+                write++;
+                depth++;
+                break;
+            case _LOAD_FAST_LOAD_FAST:
+                write += 2;
+                depth += 2;
+                break;
+            default:
+                if (!is_inlinable(opcode)) {
+                    return start;
+                }
+                write++;
+                depth += _PyUop_num_pushed(opcode, oparg) -
+                         _PyUop_num_popped(opcode, oparg);
+                if (depth < 0) {
+                    return start;
+                }
+        }
+        if (write > pc + 1 || ++body > MAX_INLINED_UOPS) {
+            return start;
+        }
+    }
+    if (end < 0 || (loop_head > start && loop_head <= end)) {
+        return start;
+    }
+    uint32_t call_target = buffer[start].target;
+    buffer[start].opcode = _ENTER_INLINED_CALL;
+    buffer[start].oparg = 0;
+    buffer[start].operand0 = co->co_stacksize;
+    write = start + 1;
+    depth = 0;
+    for (int pc = start + 3; pc <= end; pc++) {
+        _PyUOpInstruction inst = buffer[pc];
+        switch (inst.opcode) {
+            case _NOP:
+            case _RESUME_CHECK:
+            case _SET_IP:
+            case _CHECK_VALIDITY:
+            case _CHECK_VALIDITY_AND_SET_IP:
+                continue;
+            case _LOAD_FAST:
+                inst.opcode = _COPY;
+                inst.oparg = nargs - inst.oparg + depth;
+                depth++;
+                break;
+            case _LOAD_FAST_LOAD_FAST:
+                buffer[write] = inst;
+                buffer[write].opcode = _COPY;
+                buffer[write].oparg = nargs - (inst.oparg >> 4) + depth;
+                write++;
+                depth++;
+                inst.opcode = _COPY;
+                inst.oparg = nargs - (inst.oparg & 15) + depth;
+                depth++;
+                break;
+            case _RETURN_VALUE:
+                inst.opcode = _RETURN_INLINED;
+                inst.oparg = argc;
+                inst.operand0 = 0;
+                break;
+            default:
+                inst.target = call_target;
+                depth += _PyUop_num_pushed(inst.opcode, inst.oparg) -
+                         _PyUop_num_popped(inst.opcode, inst.oparg);
+        }
+        buffer[write++] = inst;
+    }
+    assert(buffer[write - 1].opcode == _RETURN_INLINED);
+    for (int pc = write; pc <= end; pc++) {
+        buffer[pc].opcode = _NOP;
+    }
+    DPRINTF(2, "Inlined call to %s: %d uops\n",
+            PyUnicode_AsUTF8(co->co_qualname), body);
+    return end;
+}
+
+static void
+inline_calls(_PyUOpInstruction *buffer, int length)
+{
+    int loop_head = -1;
+    if (buffer[length - 1].opcode == _JUMP_TO_TOP) {
+        loop_head = buffer[length - 1].oparg;
+    }
+    for (int pc = 0; pc < length; pc++) {
+        if (buffer[pc].opcode == _INIT_CALL_PY_EXACT_ARGS) {
+            pc = inline_call(buffer, pc, length, loop_head);
+        }
+    }
+}
+
 //  0 - failure, no error raised, just fall back to Tier 1
 // -1 - failure, and raise error
 //  > 0 - length of optimized trace
@@ -654,14 +1040,37 @@ _Py_uop_analyze_and_optimize(
         return err;
     }
 
-    length = optimize_uops(
-        _PyFrame_GetCode(frame), buffer,
-        length, curr_stacklen, dependencies);
+    _PyUOpInstruction *unpeeled = NULL;
+    int loop_head = peel_loop(buffer, length, &unpeeled);
+    if (loop_head < 0) {
+        return -1;
+    }
+    bool optimized = false;
+    if (loop_head > 0) {
+        bool loop_ok = false;
+        int res = optimize_uops(
+            _PyFrame_GetCode(frame), buffer,
+            2 * length - 2, curr_stacklen, dependencies, loop_head, &loop_ok);
+        if (loop_ok || res < 0) {
+            length = res;
+            optimized = true;
+        }
+        else {
+            memcpy(buffer, unpeeled, length * sizeof(_PyUOpInstruction));
+        }
+        PyMem_Free(unpeeled);
+    }
+    if (!optimized) {
+        length = optimize_uops(
+            _PyFrame_GetCode(frame), buffer,
+            length, curr_stacklen, dependencies, 0, NULL);
+    }
 
     if (length <= 0) {
         return length;
     }
 
+    inline_calls(buffer, length);
     length = remove_unneeded_uops(buffer, length);
     assert(length > 0);
 
@@ -43,6 +43,13 @@ optimize_to_bool(
 extern void
 eliminate_pop_guard(_PyUOpInstruction *this_instr, bool exit);
 
+extern void
+optimize_float_store(
+    _PyUOpInstruction *this_instr,
+    _Py_UOpsContext *ctx,
+    _Py_UopsSymbol *left,
+    int opcode);
+
 extern PyCodeObject *get_code(_PyUOpInstruction *op);
 
 static int
@@ -269,6 +276,8 @@ dummy_func(void) {
         }
         else {
             res = sym_new_type(ctx, &PyFloat_Type);
+            optimize_float_store(this_instr, ctx, left,
+                                 _BINARY_OP_ADD_FLOAT_STORE_FAST);
         }
     }
 
@@ -291,6 +300,8 @@ dummy_func(void) {
         }
         else {
             res = sym_new_type(ctx, &PyFloat_Type);
+            optimize_float_store(this_instr, ctx, left,
+                                 _BINARY_OP_SUBTRACT_FLOAT_STORE_FAST);
         }
     }
 
@@ -313,6 +324,8 @@ dummy_func(void) {
         }
         else {
             res = sym_new_type(ctx, &PyFloat_Type);
+            optimize_float_store(this_instr, ctx, left,
+                                 _BINARY_OP_MULTIPLY_FLOAT_STORE_FAST);
         }
     }
 
@@ -492,8 +505,9 @@ dummy_func(void) {
         (void)owner;
     }
 
-    op(_CHECK_ATTR_MODULE, (dict_version/2, owner -- owner)) {
+    op(_CHECK_ATTR_MODULE_PUSH_KEYS, (dict_version/2, owner -- owner, mod_keys)) {
         (void)dict_version;
+        mod_keys = sym_new_not_null(ctx);
         if (sym_is_const(owner)) {
             PyObject *cnst = sym_get_const(owner);
             if (PyModule_CheckExact(cnst)) {
@@ -515,16 +529,19 @@ dummy_func(void) {
         self_or_null = sym_new_unknown(ctx);
     }
 
-    op(_LOAD_ATTR_MODULE, (index/1, owner -- attr, null if (oparg & 1))) {
+    op(_LOAD_ATTR_MODULE_FROM_KEYS, (index/1, owner, mod_keys -- attr, null if (oparg & 1))) {
         (void)index;
+        (void)mod_keys;
         null = sym_new_null(ctx);
         attr = NULL;
         if (this_instr[-1].opcode == _NOP) {
-            // Preceding _CHECK_ATTR_MODULE was removed: mod is const and dict is watched.
+            // Preceding _CHECK_ATTR_MODULE_PUSH_KEYS was removed: mod is const and dict is watched.
             assert(sym_is_const(owner));
             PyModuleObject *mod = (PyModuleObject *)sym_get_const(owner);
             assert(PyModule_CheckExact(mod));
             PyObject *dict = mod->md_dict;
+            // The keys are no longer pushed: load from the module instead.
+            this_instr->opcode = _LOAD_ATTR_MODULE;
             PyObject *res = convert_global_to_const(this_instr, dict);
             if (res != NULL) {
                 this_instr[-1].opcode = _POP_TOP;
@@ -620,6 +637,15 @@ dummy_func(void) {
 
     op(_INIT_CALL_PY_EXACT_ARGS, (callable, self_or_null, args[oparg] -- new_frame: _Py_UOpsAbstractFrame *)) {
         int argcount = oparg;
+        /* How much room the callee's temporaries would have above the
+         * arguments if it were inlined (see inline_call()). If the calling
+         * frame is on the data stack, it is followed by the space that
+         * _CHECK_STACK_SPACE reserved for the callee's frame; the frame
+         * of a generator or coroutine lives in the generator instead. */
+        PyCodeObject *caller_co = ctx->frame->code;
+        int room = ctx->frame->stack_len - (int)(args + oparg - ctx->frame->stack);
+        bool on_data_stack = !(caller_co->co_flags &
+            (CO_GENERATOR | CO_COROUTINE | CO_ASYNC_GENERATOR));
         (void)callable;
 
         PyCodeObject *co = NULL;
@@ -645,6 +671,7 @@ dummy_func(void) {
             new_frame = frame_new(ctx, co, 0, NULL, 0);
 
         }
+        this_instr->operand0 = on_data_stack ? room + co->co_framesize : room;
     }
 
     op(_MAYBE_EXPAND_METHOD, (callable, self_or_null, args[oparg] -- func, maybe_self, args[oparg])) {
@@ -816,6 +843,27 @@ dummy_func(void) {
         }
     }
 
+    op(_ITER_CHECK_LIST, (iter -- iter)) {
+        if (sym_matches_type(iter, &PyListIter_Type)) {
+            REPLACE_OP(this_instr, _NOP, 0, 0);
+        }
+        sym_set_type(iter, &PyListIter_Type);
+    }
+
+    op(_ITER_CHECK_TUPLE, (iter -- iter)) {
+        if (sym_matches_type(iter, &PyTupleIter_Type)) {
+            REPLACE_OP(this_instr, _NOP, 0, 0);
+        }
+        sym_set_type(iter, &PyTupleIter_Type);
+    }
+
+    op(_ITER_CHECK_RANGE, (iter -- iter)) {
+        if (sym_matches_type(iter, &PyRangeIter_Type)) {
+            REPLACE_OP(this_instr, _NOP, 0, 0);
+        }
+        sym_set_type(iter, &PyRangeIter_Type);
+    }
+
     op(_ITER_NEXT_RANGE, (iter -- iter, next)) {
        next = sym_new_type(ctx, &PyLong_Type);
        (void)iter;
@@ -399,6 +399,8 @@
             }
             else {
                 res = sym_new_type(ctx, &PyFloat_Type);
+                optimize_float_store(this_instr, ctx, left,
+                                 _BINARY_OP_MULTIPLY_FLOAT_STORE_FAST);
             }
             stack_pointer[-2] = res;
             stack_pointer += -1;
@@ -430,6 +432,8 @@
             }
             else {
                 res = sym_new_type(ctx, &PyFloat_Type);
+                optimize_float_store(this_instr, ctx, left,
+                                 _BINARY_OP_ADD_FLOAT_STORE_FAST);
             }
             stack_pointer[-2] = res;
             stack_pointer += -1;
@@ -461,6 +465,8 @@
             }
             else {
                 res = sym_new_type(ctx, &PyFloat_Type);
+                optimize_float_store(this_instr, ctx, left,
+                                 _BINARY_OP_SUBTRACT_FLOAT_STORE_FAST);
             }
             stack_pointer[-2] = res;
             stack_pointer += -1;
@@ -468,6 +474,24 @@
             break;
         }
 
+        case _BINARY_OP_ADD_FLOAT_STORE_FAST: {
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _BINARY_OP_SUBTRACT_FLOAT_STORE_FAST: {
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _BINARY_OP_MULTIPLY_FLOAT_STORE_FAST: {
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _GUARD_BOTH_UNICODE: {
             _Py_UopsSymbol *right;
             _Py_UopsSymbol *left;
@@ -1134,61 +1158,76 @@
             break;
         }
 
-        case _CHECK_ATTR_MODULE: {
+        case _CHECK_ATTR_MODULE_PUSH_KEYS: {
             _Py_UopsSymbol *owner;
+            _Py_UopsSymbol *mod_keys;
             owner = stack_pointer[-1];
             uint32_t dict_version = (uint32_t)this_instr->operand0;
             (void)dict_version;
+            mod_keys = sym_new_not_null(ctx);
             if (sym_is_const(owner)) {
                 PyObject *cnst = sym_get_const(owner);
                 if (PyModule_CheckExact(cnst)) {
                     PyModuleObject *mod = (PyModuleObject *)cnst;
                     PyObject *dict = mod->md_dict;
+                    stack_pointer[0] = mod_keys;
+                    stack_pointer += 1;
+                    assert(WITHIN_STACK_BOUNDS());
                     uint64_t watched_mutations = get_mutations(dict);
                     if (watched_mutations < _Py_MAX_ALLOWED_GLOBALS_MODIFICATIONS) {
                         PyDict_Watch(GLOBALS_WATCHER_ID, dict);
                         _Py_BloomFilter_Add(dependencies, dict);
                         this_instr->opcode = _NOP;
                     }
+                    stack_pointer += -1;
+                    assert(WITHIN_STACK_BOUNDS());
                 }
             }
+            stack_pointer[0] = mod_keys;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
             break;
         }
 
-        case _LOAD_ATTR_MODULE: {
+        case _LOAD_ATTR_MODULE_FROM_KEYS: {
+            _Py_UopsSymbol *mod_keys;
             _Py_UopsSymbol *owner;
             _Py_UopsSymbol *attr;
             _Py_UopsSymbol *null = NULL;
-            owner = stack_pointer[-1];
+            mod_keys = stack_pointer[-1];
+            owner = stack_pointer[-2];
             uint16_t index = (uint16_t)this_instr->operand0;
             (void)index;
+            (void)mod_keys;
             null = sym_new_null(ctx);
             attr = NULL;
             if (this_instr[-1].opcode == _NOP) {
-                // Preceding _CHECK_ATTR_MODULE was removed: mod is const and dict is watched.
+                // Preceding _CHECK_ATTR_MODULE_PUSH_KEYS was removed: mod is const and dict is watched.
                 assert(sym_is_const(owner));
                 PyModuleObject *mod = (PyModuleObject *)sym_get_const(owner);
                 assert(PyModule_CheckExact(mod));
                 PyObject *dict = mod->md_dict;
-                stack_pointer[-1] = attr;
-                if (oparg & 1) stack_pointer[0] = null;
-                stack_pointer += (oparg & 1);
+                // The keys are no longer pushed: load from the module instead.
+                this_instr->opcode = _LOAD_ATTR_MODULE;
+                stack_pointer[-2] = attr;
+                if (oparg & 1) stack_pointer[-1] = null;
+                stack_pointer += -1 + (oparg & 1);
                 assert(WITHIN_STACK_BOUNDS());
                 PyObject *res = convert_global_to_const(this_instr, dict);
                 if (res != NULL) {
                     this_instr[-1].opcode = _POP_TOP;
                     attr = sym_new_const(ctx, res);
                 }
-                stack_pointer += -(oparg & 1);
+                stack_pointer += 1 - (oparg & 1);
                 assert(WITHIN_STACK_BOUNDS());
             }
             if (attr == NULL) {
                 /* No conversion made. We don't know what `attr` is. */
                 attr = sym_new_not_null(ctx);
             }
-            stack_pointer[-1] = attr;
-            if (oparg & 1) stack_pointer[0] = null;
-            stack_pointer += (oparg & 1);
+            stack_pointer[-2] = attr;
+            if (oparg & 1) stack_pointer[-1] = null;
+            stack_pointer += -1 + (oparg & 1);
             assert(WITHIN_STACK_BOUNDS());
             break;
         }
@@ -1525,6 +1564,12 @@
         /* _INSTRUMENTED_FOR_ITER is not a viable micro-op for tier 2 */
 
         case _ITER_CHECK_LIST: {
+            _Py_UopsSymbol *iter;
+            iter = stack_pointer[-1];
+            if (sym_matches_type(iter, &PyListIter_Type)) {
+                REPLACE_OP(this_instr, _NOP, 0, 0);
+            }
+            sym_set_type(iter, &PyListIter_Type);
             break;
         }
 
@@ -1544,6 +1589,12 @@
         }
 
         case _ITER_CHECK_TUPLE: {
+            _Py_UopsSymbol *iter;
+            iter = stack_pointer[-1];
+            if (sym_matches_type(iter, &PyTupleIter_Type)) {
+                REPLACE_OP(this_instr, _NOP, 0, 0);
+            }
+            sym_set_type(iter, &PyTupleIter_Type);
             break;
         }
 
@@ -1563,6 +1614,12 @@
         }
 
         case _ITER_CHECK_RANGE: {
+            _Py_UopsSymbol *iter;
+            iter = stack_pointer[-1];
+            if (sym_matches_type(iter, &PyRangeIter_Type)) {
+                REPLACE_OP(this_instr, _NOP, 0, 0);
+            }
+            sym_set_type(iter, &PyRangeIter_Type);
             break;
         }
 
@@ -1861,6 +1918,15 @@
             self_or_null = stack_pointer[-1 - oparg];
             callable = stack_pointer[-2 - oparg];
             int argcount = oparg;
+            /* How much room the callee's temporaries would have above the
+             * arguments if it were inlined (see inline_call()). If the calling
+             * frame is on the data stack, it is followed by the space that
+             * _CHECK_STACK_SPACE reserved for the callee's frame; the frame
+             * of a generator or coroutine lives in the generator instead. */
+            PyCodeObject *caller_co = ctx->frame->code;
+            int room = ctx->frame->stack_len - (int)(args + oparg - ctx->frame->stack);
+            bool on_data_stack = !(caller_co->co_flags &
+                               (CO_GENERATOR | CO_COROUTINE | CO_ASYNC_GENERATOR));
             (void)callable;
             PyCodeObject *co = NULL;
             assert((this_instr + 2)->opcode == _PUSH_FRAME);
@@ -1883,6 +1949,7 @@
             } else {
                 new_frame = frame_new(ctx, co, 0, NULL, 0);
             }
+            this_instr->operand0 = on_data_stack ? room + co->co_framesize : room;
             stack_pointer[0] = (_Py_UopsSymbol *)new_frame;
             stack_pointer += 1;
             assert(WITHIN_STACK_BOUNDS());
@@ -2535,6 +2602,18 @@
             break;
         }
 
+        case _LOAD_ATTR_MODULE: {
+            _Py_UopsSymbol *attr;
+            _Py_UopsSymbol *null = NULL;
+            attr = sym_new_not_null(ctx);
+            null = sym_new_null(ctx);
+            stack_pointer[-1] = attr;
+            if (oparg & 1) stack_pointer[0] = null;
+            stack_pointer += (oparg & 1);
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _INTERNAL_INCREMENT_OPT_COUNTER: {
             stack_pointer += -1;
             assert(WITHIN_STACK_BOUNDS());
@@ -2571,6 +2650,25 @@
             break;
         }
 
+        case _ENTER_INLINED_CALL: {
+            break;
+        }
+
+        case _RETURN_INLINED: {
+            _Py_UopsSymbol *res;
+            res = sym_new_not_null(ctx);
+            stack_pointer[-3 - oparg] = res;
+            stack_pointer += -2 - oparg;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _EXIT_INLINED_CALL: {
+            stack_pointer += -oparg;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _TIER2_RESUME_CHECK: {
             break;
         }
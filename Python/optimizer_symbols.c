@@ -297,6 +297,25 @@ _Py_uop_sym_matches_type_version(_Py_UopsSymbol *sym, unsigned int version)
     return _Py_uop_sym_get_type_version(sym) == version;
 }
 
+// Is everything known about prev also known about sym?
+bool
+_Py_uop_sym_refines(_Py_UopsSymbol *sym, _Py_UopsSymbol *prev)
+{
+    if ((sym->flags & prev->flags) != prev->flags) {
+        return false;
+    }
+    if (prev->typ != NULL && sym->typ != prev->typ) {
+        return false;
+    }
+    if (prev->type_version != 0 && sym->type_version != prev->type_version) {
+        return false;
+    }
+    if (prev->const_val != NULL && sym->const_val != prev->const_val) {
+        return false;
+    }
+    return true;
+}
+
 
 int
 _Py_uop_sym_truthiness(_Py_UopsSymbol *sym)
@@ -344,6 +363,7 @@ _Py_uop_frame_new(
     assert(ctx->curr_frame_depth < MAX_ABSTRACT_FRAME_DEPTH);
     _Py_UOpsAbstractFrame *frame = &ctx->frames[ctx->curr_frame_depth];
 
+    frame->code = co;
     frame->stack_len = co->co_stacksize;
     frame->locals_len = co->co_nlocalsplus;
 
@@ -534,6 +554,18 @@ _Py_uop_symbols_test(PyObject *Py_UNUSED(self), PyObject *Py_UNUSED(ignored))
     sym = _Py_uop_sym_new_const(ctx, PyLong_FromLong(0));
     TEST_PREDICATE(_Py_uop_sym_truthiness(sym) == 0, "bool(0) is not False");
 
+    _Py_UopsSymbol *top = _Py_uop_sym_new_unknown(ctx);
+    _Py_UopsSymbol *int_sym = _Py_uop_sym_new_type(ctx, &PyLong_Type);
+    sym = _Py_uop_sym_new_const(ctx, val_42);
+    if (top == NULL || int_sym == NULL || sym == NULL) {
+        goto fail;
+    }
+    TEST_PREDICATE(_Py_uop_sym_refines(int_sym, top), "int doesn't refine top");
+    TEST_PREDICATE(!_Py_uop_sym_refines(top, int_sym), "top refines int");
+    TEST_PREDICATE(_Py_uop_sym_refines(sym, int_sym), "42 doesn't refine int");
+    TEST_PREDICATE(!_Py_uop_sym_refines(int_sym, sym), "int refines 42");
+    TEST_PREDICATE(_Py_uop_sym_refines(sym, sym), "42 doesn't refine 42");
+
     _Py_uop_abstractcontext_fini(ctx);
     Py_DECREF(val_42);
     Py_DECREF(val_43);
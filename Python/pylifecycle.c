@@ -2024,6 +2024,10 @@ _Py_Finalize(_PyRuntimeState *runtime)
 
     _PyAtExit_Call(tstate->interp);
 
+    /* Stop the sampling profiler while its samples can still be freed */
+    _PySamplingProfiler_Fini();
+    _PyMem_StopPurger();
+
     assert(_PyThreadState_GET() == tstate);
 
     /* Copy the core config, PyInterpreterState_Delete() free
@@ -10,8 +10,9 @@
 #include "pycore_dtoa.h"          // _dtoa_state_INIT()
 #include "pycore_emscripten_trampoline.h"  // _Py_EmscriptenTrampoline_Init()
 #include "pycore_frame.h"
-#include "pycore_freelist.h"      // _PyObject_ClearFreeLists()
+#include "pycore_freelist.h"      // _PyObject_ClearFreeLists(), _PyObject_InitFreeLists()
 #include "pycore_initconfig.h"    // _PyStatus_OK()
+#include "pycore_jit.h"           // _PyJIT_Fini()
 #include "pycore_object.h"        // _PyType_InitCache()
 #include "pycore_parking_lot.h"   // _PyParkingLot_AfterFork()
 #include "pycore_pyerrors.h"      // _PyErr_Clear()
@@ -634,6 +635,7 @@ init_interpreter(PyInterpreterState *interp,
 
     _PyEval_InitState(interp);
     _PyGC_InitState(&interp->gc);
+    _PyObject_InitFreeLists(&interp->object_state.freelists, NULL);
     PyConfig_InitPythonConfig(&interp->config);
     _PyType_InitCache(interp);
 #ifdef Py_GIL_DISABLED
@@ -879,6 +881,10 @@ interpreter_clear(PyInterpreterState *interp, PyThreadState *tstate)
     Py_CLEAR(interp->sysdict);
     Py_CLEAR(interp->builtins);
 
+#ifdef _Py_JIT
+    _PyJIT_Fini(interp);
+#endif
+
     if (tstate->interp == interp) {
         /* We are now safe to fix tstate->_status.cleared. */
         // XXX Do this (much) earlier?
@@ -1471,6 +1477,10 @@ init_threadstate(_PyThreadStateImpl *_tstate,
 
     llist_init(&_tstate->mem_free_queue);
 
+#ifdef Py_GIL_DISABLED
+    _PyObject_InitFreeLists(&_tstate->freelists, &interp->object_state.freelists);
+#endif
+
     if (interp->stoptheworld.requested || _PyRuntime.stoptheworld.requested) {
         // Start in the suspended state if there is an ongoing stop-the-world.
         tstate->state = _Py_THREAD_SUSPENDED;
@@ -1704,6 +1714,7 @@ PyThreadState_Clear(PyThreadState *tstate)
 #ifdef Py_GIL_DISABLED
     // Each thread should clear own freelists in free-threading builds.
     struct _Py_freelists *freelists = _Py_freelists_GET();
+    _PyObject_MergeFreeListStats(tstate->interp, freelists);
     _PyObject_ClearFreeLists(freelists, 1);
 
     // Merge our thread-local refcounts into the type's own refcount and
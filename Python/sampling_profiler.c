@@ -0,0 +1,402 @@
+/*
+
+Sampling profiler
+=================
+
+A statistical profiler that is cheap enough to leave running in
+production.  Unlike the profilers built on sys.setprofile() (such as
+cProfile), nothing is done on function calls and returns.  Instead, a
+timer thread wakes up every `interval` and sets _PY_EVAL_SAMPLE_BIT in
+the eval breaker of every thread that is currently running Python code.
+Each of those threads then records its own stack the next time it checks
+the eval breaker, which it does at function entry and on every backward
+jump.  Threads that are blocked (waiting for I/O, a lock or the GIL) are
+not sampled, so the profile shows where CPU time is spent.
+
+Because every thread walks only its own frame chain, sampling neither
+takes the GIL on behalf of another thread nor stops the world.  The
+timer thread does not have a thread state at all.
+
+A sample is the stack of (code, offset) pairs of a thread, innermost
+frame first, where offset is the byte offset of the instruction being
+executed.  Samples are aggregated in a C hash table that maps each
+distinct stack to its count.  Stacks are hashed and compared by code
+object pointer and offset, so taking a sample costs a frame walk and a
+table lookup, and allocates only the first time a stack is seen.  Each
+distinct stack holds a strong reference to its code objects, which keeps
+the pointers valid until the profile is dumped.  Converting the stacks
+to folded stacks ("func (file:line);func (file:line)", outermost frame
+first) and creating Python objects happens only then.
+
+*/
+
+#include "Python.h"
+#include "pycore_ceval.h"         // _PY_EVAL_SAMPLE_BIT
+#include "pycore_frame.h"         // _PyInterpreterFrame
+#include "pycore_hashtable.h"     // _Py_hashtable_t
+#include "pycore_lock.h"          // PyEvent_WaitTimed()
+#include "pycore_pyhash.h"        // _Py_HashPointerRaw()
+#include "pycore_pystate.h"       // HEAD_LOCK()
+#include "pycore_pythread.h"      // PyThread_start_joinable_thread()
+#include "pycore_runtime.h"       // _PyRuntime
+
+// Deeper stacks are truncated, keeping the innermost frames.
+#define SAMPLE_MAX_DEPTH 256
+
+#define sampling _PyRuntime.ceval.sampling
+
+typedef struct {
+    PyCodeObject *code;
+    int offset;
+} sample_frame_t;
+
+typedef struct {
+    Py_uhash_t hash;
+    int depth;
+    // Innermost frame first
+    sample_frame_t frames[1];
+} sample_stack_t;
+
+#define STACK_SIZE(DEPTH) \
+    (sizeof(sample_stack_t) + sizeof(sample_frame_t) * ((DEPTH) - 1))
+
+static void
+sampler_thread(void *Py_UNUSED(arg))
+{
+    _PyRuntimeState *runtime = &_PyRuntime;
+    PyInterpreterState *interp = _PyInterpreterState_Main();
+    while (!PyEvent_WaitTimed(&sampling.stop, sampling.interval, 0)) {
+        HEAD_LOCK(runtime);
+        for (PyThreadState *t = interp->threads.head; t != NULL; t = t->next) {
+            if (_Py_atomic_load_int_relaxed(&t->state) == _Py_THREAD_ATTACHED) {
+                _Py_set_eval_breaker_bit(t, _PY_EVAL_SAMPLE_BIT);
+            }
+        }
+        HEAD_UNLOCK(runtime);
+    }
+}
+
+int
+_PySamplingProfiler_Start(PyTime_t interval)
+{
+    assert(interval > 0);
+    PyThread_ident_t ident;
+    int res = 0;
+    PyMutex_Lock(&sampling.control);
+    if (sampling.active) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "sampling profiler is already running");
+        res = -1;
+        goto done;
+    }
+    sampling.interval = interval;
+    sampling.stop = (PyEvent){0};
+    if (PyThread_start_joinable_thread(sampler_thread, NULL,
+                                       &ident, &sampling.handle)) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "can't start the sampling profiler thread");
+        res = -1;
+        goto done;
+    }
+    _Py_atomic_store_int(&sampling.active, 1);
+done:
+    PyMutex_Unlock(&sampling.control);
+    return res;
+}
+
+int
+_PySamplingProfiler_Stop(void)
+{
+    PyMutex_Lock(&sampling.control);
+    if (sampling.active) {
+        _Py_atomic_store_int(&sampling.active, 0);
+        _PyEvent_Notify(&sampling.stop);
+        Py_BEGIN_ALLOW_THREADS
+        PyThread_join_thread(sampling.handle);
+        Py_END_ALLOW_THREADS
+    }
+    PyMutex_Unlock(&sampling.control);
+    return 0;
+}
+
+static Py_uhash_t
+stack_hash(const sample_stack_t *stack)
+{
+    /* code based on tuplehash() of Objects/tupleobject.c */
+    Py_uhash_t x = 0x345678UL;
+    Py_uhash_t mult = PyHASH_MULTIPLIER;
+    for (int i = 0; i < stack->depth; i++) {
+        const sample_frame_t *frame = &stack->frames[i];
+        Py_uhash_t y = _Py_HashPointerRaw(frame->code);
+        y ^= (Py_uhash_t)frame->offset;
+        x = (x ^ y) * mult;
+        mult += (Py_uhash_t)(82520UL + 2 * (stack->depth - i));
+    }
+    x += 97531UL;
+    return x;
+}
+
+static Py_uhash_t
+hashtable_hash_stack(const void *key)
+{
+    return ((const sample_stack_t *)key)->hash;
+}
+
+static int
+hashtable_compare_stack(const void *key1, const void *key2)
+{
+    const sample_stack_t *stack1 = (const sample_stack_t *)key1;
+    const sample_stack_t *stack2 = (const sample_stack_t *)key2;
+    if (stack1->hash != stack2->hash || stack1->depth != stack2->depth) {
+        return 0;
+    }
+    for (int i = 0; i < stack1->depth; i++) {
+        if (stack1->frames[i].code != stack2->frames[i].code ||
+            stack1->frames[i].offset != stack2->frames[i].offset)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static sample_stack_t *
+stack_copy(const sample_stack_t *stack)
+{
+    sample_stack_t *copy = PyMem_RawMalloc(STACK_SIZE(stack->depth));
+    if (copy == NULL) {
+        return NULL;
+    }
+    memcpy(copy, stack, STACK_SIZE(stack->depth));
+    for (int i = 0; i < copy->depth; i++) {
+        Py_INCREF(copy->frames[i].code);
+    }
+    return copy;
+}
+
+static void
+stack_free(void *key)
+{
+    sample_stack_t *stack = (sample_stack_t *)key;
+    for (int i = 0; i < stack->depth; i++) {
+        Py_DECREF(stack->frames[i].code);
+    }
+    PyMem_RawFree(stack);
+}
+
+static _Py_hashtable_t *
+samples_new(void)
+{
+    _Py_hashtable_allocator_t alloc = {
+        .malloc = PyMem_RawMalloc,
+        .free = PyMem_RawFree,
+    };
+    return _Py_hashtable_new_full(hashtable_hash_stack,
+                                  hashtable_compare_stack,
+                                  stack_free, NULL, &alloc);
+}
+
+/* Count a sample.  Return -1 if memory is exhausted, without setting an
+   exception.  Must be called with sampling.mutex held. */
+static int
+count_sample(_Py_hashtable_t *samples, const sample_stack_t *stack,
+             uintptr_t count)
+{
+    _Py_hashtable_entry_t *entry = _Py_hashtable_get_entry(samples, stack);
+    if (entry != NULL) {
+        entry->value = (void *)((uintptr_t)entry->value + count);
+        return 0;
+    }
+    sample_stack_t *copy = stack_copy(stack);
+    if (copy == NULL) {
+        return -1;
+    }
+    if (_Py_hashtable_set(samples, copy, (void *)count) < 0) {
+        stack_free(copy);
+        return -1;
+    }
+    return 0;
+}
+
+/* Called from _Py_HandlePending() when _PY_EVAL_SAMPLE_BIT is set.
+   Sampling must never change the behavior of the profiled program, so
+   it never raises: if memory is exhausted, the sample is dropped. */
+void
+_PySamplingProfiler_TakeSample(PyThreadState *tstate)
+{
+    if (!_Py_atomic_load_int_relaxed(&sampling.active)) {
+        return;
+    }
+    union {
+        sample_stack_t stack;
+        char data[STACK_SIZE(SAMPLE_MAX_DEPTH)];
+    } buffer;
+    sample_stack_t *stack = &buffer.stack;
+    int depth = 0;
+    _PyInterpreterFrame *frame = tstate->current_frame;
+    for (; frame != NULL && depth < SAMPLE_MAX_DEPTH; frame = frame->previous) {
+        if (!_PyFrame_IsIncomplete(frame)) {
+            stack->frames[depth].code = _PyFrame_GetCode(frame);
+            stack->frames[depth].offset =
+                _PyInterpreterFrame_LASTI(frame) * sizeof(_Py_CODEUNIT);
+            depth++;
+        }
+    }
+    if (depth == 0) {
+        return;
+    }
+    stack->depth = depth;
+    stack->hash = stack_hash(stack);
+
+    PyMutex_Lock(&sampling.mutex);
+    if (sampling.samples == NULL) {
+        sampling.samples = samples_new();
+    }
+    if (sampling.samples != NULL) {
+        (void)count_sample(sampling.samples, stack, 1);
+    }
+    PyMutex_Unlock(&sampling.mutex);
+}
+
+static int
+add_count(PyObject *dict, PyObject *key, PyObject *count)
+{
+    PyObject *old;
+    if (PyDict_GetItemRef(dict, key, &old) < 0) {
+        return -1;
+    }
+    if (old != NULL) {
+        Py_SETREF(count, PyNumber_Add(old, count));
+        Py_DECREF(old);
+        if (count == NULL) {
+            return -1;
+        }
+    }
+    else {
+        Py_INCREF(count);
+    }
+    int res = PyDict_SetItem(dict, key, count);
+    Py_DECREF(count);
+    return res;
+}
+
+static PyObject *
+fold_stack(const sample_stack_t *stack)
+{
+    PyObject *names = PyList_New(stack->depth);
+    if (names == NULL) {
+        return NULL;
+    }
+    for (int i = 0; i < stack->depth; i++) {
+        // Outermost frame first
+        const sample_frame_t *frame = &stack->frames[stack->depth - 1 - i];
+        PyCodeObject *co = frame->code;
+        PyObject *name = PyUnicode_FromFormat("%U (%U:%d)",
+                                              co->co_qualname, co->co_filename,
+                                              PyCode_Addr2Line(co, frame->offset));
+        if (name == NULL) {
+            Py_DECREF(names);
+            return NULL;
+        }
+        PyList_SET_ITEM(names, i, name);
+    }
+    PyObject *folded = PyUnicode_Join(_Py_LATIN1_CHR(';'), names);
+    Py_DECREF(names);
+    return folded;
+}
+
+static int
+fold_sample(_Py_hashtable_t *Py_UNUSED(samples), const void *key,
+            const void *value, void *result)
+{
+    PyObject *folded = fold_stack((const sample_stack_t *)key);
+    if (folded == NULL) {
+        return -1;
+    }
+    PyObject *count = PyLong_FromSize_t((uintptr_t)value);
+    if (count == NULL) {
+        Py_DECREF(folded);
+        return -1;
+    }
+    int res = add_count((PyObject *)result, folded, count);
+    Py_DECREF(count);
+    Py_DECREF(folded);
+    return res;
+}
+
+static int
+copy_sample(_Py_hashtable_t *Py_UNUSED(samples), const void *key,
+            const void *value, void *copy)
+{
+    return count_sample((_Py_hashtable_t *)copy, (const sample_stack_t *)key,
+                        (uintptr_t)value);
+}
+
+PyObject *
+_PySamplingProfiler_Dump(int clear)
+{
+    _Py_hashtable_t *samples = NULL;
+    int nomemory = 0;
+    PyMutex_Lock(&sampling.mutex);
+    if (clear) {
+        samples = sampling.samples;
+        sampling.samples = NULL;
+    }
+    else if (sampling.samples != NULL) {
+        // Copy the stacks, but do not build objects, with the mutex held:
+        // that could run a finalizer that takes a sample.
+        samples = samples_new();
+        if (samples == NULL ||
+            _Py_hashtable_foreach(sampling.samples, copy_sample, samples) < 0)
+        {
+            nomemory = 1;
+        }
+    }
+    PyMutex_Unlock(&sampling.mutex);
+
+    PyObject *result = NULL;
+    if (nomemory) {
+        PyErr_NoMemory();
+        goto done;
+    }
+    result = PyDict_New();
+    if (result == NULL || samples == NULL) {
+        goto done;
+    }
+    if (_Py_hashtable_foreach(samples, fold_sample, result) < 0) {
+        Py_CLEAR(result);
+    }
+done:
+    if (samples != NULL) {
+        _Py_hashtable_destroy(samples);
+    }
+    return result;
+}
+
+void
+_PySamplingProfiler_Fini(void)
+{
+    _PySamplingProfiler_Stop();
+    PyMutex_Lock(&sampling.mutex);
+    _Py_hashtable_t *samples = sampling.samples;
+    sampling.samples = NULL;
+    PyMutex_Unlock(&sampling.mutex);
+    if (samples != NULL) {
+        _Py_hashtable_destroy(samples);
+    }
+}
+
+void
+_PySamplingProfiler_AfterFork_Child(void)
+{
+    // The sampler thread does not exist in the child, and either lock may
+    // have been held by a thread of the parent.  The samples taken so far
+    // belong to the parent.
+    sampling.control = (PyMutex){0};
+    sampling.mutex = (PyMutex){0};
+    sampling.active = 0;
+    if (sampling.samples != NULL) {
+        _Py_hashtable_destroy(sampling.samples);
+        sampling.samples = NULL;
+    }
+}
@@ -14,6 +14,7 @@
 #include "pycore_uop_ids.h"       // MAX_UOP_ID
 #include "pycore_opcode_utils.h"  // RESUME_AT_FUNC_START
 #include "pycore_pylifecycle.h"   // _PyOS_URandomNonblock()
+#include "pycore_pystate.h"       // _PyEval_StopTheWorld()
 #include "pycore_runtime.h"       // _Py_ID()
 
 #include <stdlib.h> // rand()
@@ -436,11 +437,21 @@ do { \
 #  define SPECIALIZATION_FAIL(opcode, kind) ((void)0)
 #endif
 
+#if ENABLE_SPECIALIZATION_FT
+static int apply_profile_site(_Py_CODEUNIT *instr,
+                              const _PyProfileSite *site);
+#endif
+
 // Initialize warmup counters and optimize instructions. This cannot fail.
-void
+// If profile is not NULL, it holds nsites sites sorted by index, which prime
+// the counters of the instructions they match.  Return the number of sites
+// applied.
+Py_ssize_t
 _PyCode_Quicken(_Py_CODEUNIT *instructions, Py_ssize_t size, PyObject *consts,
-                int enable_counters)
+                int enable_counters, const _PyProfileSite *profile,
+                Py_ssize_t nsites)
 {
+    Py_ssize_t applied = 0;
     #if ENABLE_SPECIALIZATION_FT
     _Py_BackoffCounter jump_counter, adaptive_counter;
     if (enable_counters) {
@@ -453,9 +464,16 @@ _PyCode_Quicken(_Py_CODEUNIT *instructions, Py_ssize_t size, PyObject *consts,
     }
     int opcode = 0;
     int oparg = 0;
+    Py_ssize_t k = 0;
     /* The last code unit cannot have a cache, so we don't need to check it */
     for (Py_ssize_t i = 0; i < size-1; i++) {
         opcode = instructions[i].op.code;
+        if (profile != NULL && _PyOpcode_Deopt[opcode] != 0) {
+            // Applying a profile to code that may have run.  Unknown opcodes
+            // are left alone, so that executing them still fails.
+            opcode = _PyOpcode_Deopt[opcode];
+            instructions[i].op.code = opcode;
+        }
         int caches = _PyOpcode_Caches[opcode];
         oparg = (oparg << 8) | instructions[i].op.arg;
         if (caches) {
@@ -472,6 +490,12 @@ _PyCode_Quicken(_Py_CODEUNIT *instructions, Py_ssize_t size, PyObject *consts,
                     break;
                 default:
                     instructions[i + 1].counter = adaptive_counter;
+                    while (k < nsites && profile[k].index < i) {
+                        k++;
+                    }
+                    if (enable_counters && k < nsites && profile[k].index == i) {
+                        applied += apply_profile_site(&instructions[i], &profile[k]);
+                    }
                     break;
             }
             i += caches;
@@ -490,6 +514,7 @@ _PyCode_Quicken(_Py_CODEUNIT *instructions, Py_ssize_t size, PyObject *consts,
         }
     }
     #endif /* ENABLE_SPECIALIZATION_FT */
+    return applied;
 }
 
 #define SIMPLE_FUNCTION 0
@@ -735,23 +760,32 @@ unspecialize(_Py_CODEUNIT *instr, int reason)
     set_counter(counter, adaptive_counter_backoff(cur));
 }
 
+/* Like unspecialize(), for callers that already recorded why they failed
+ * with SPECIALIZATION_FAIL(). */
+static inline void
+unspecialize_failed(_Py_CODEUNIT *instr)
+{
+    assert(!PyErr_Occurred());
+    uint8_t opcode = FT_ATOMIC_LOAD_UINT8_RELAXED(instr->op.code);
+    uint8_t generic_opcode = _PyOpcode_Deopt[opcode];
+    STAT_INC(generic_opcode, failure);
+    if (!set_opcode(instr, generic_opcode)) {
+        return;
+    }
+    _Py_BackoffCounter *counter = (_Py_BackoffCounter *)instr + 1;
+    _Py_BackoffCounter cur = load_counter(counter);
+    set_counter(counter, adaptive_counter_backoff(cur));
+}
+
 static int function_kind(PyCodeObject *code);
 static bool function_check_args(PyObject *o, int expected_argcount, int opcode);
 static uint32_t function_get_version(PyObject *o, int opcode);
 static uint32_t type_get_version(PyTypeObject *t, int opcode);
 
 static int
-specialize_module_load_attr(
-    PyObject *owner, _Py_CODEUNIT *instr, PyObject *name
-) {
+specialize_module_load_attr_lock_held(PyDictObject *dict, _Py_CODEUNIT *instr, PyObject *name)
+{
     _PyAttrCache *cache = (_PyAttrCache *)(instr + 1);
-    PyModuleObject *m = (PyModuleObject *)owner;
-    assert((Py_TYPE(owner)->tp_flags & Py_TPFLAGS_MANAGED_DICT) == 0);
-    PyDictObject *dict = (PyDictObject *)m->md_dict;
-    if (dict == NULL) {
-        SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_NO_DICT);
-        return -1;
-    }
     if (dict->ma_keys->dk_kind != DICT_KEYS_UNICODE) {
         SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_ATTR_NON_STRING);
         return -1;
@@ -771,18 +805,36 @@ specialize_module_load_attr(
                             SPEC_FAIL_OUT_OF_RANGE);
         return -1;
     }
-    uint32_t keys_version = _PyDictKeys_GetVersionForCurrentState(
-            _PyInterpreterState_GET(), dict->ma_keys);
+    uint32_t keys_version = _PyDict_GetKeysVersionForCurrentState(
+            _PyInterpreterState_GET(), dict);
     if (keys_version == 0) {
         SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_OUT_OF_VERSIONS);
         return -1;
     }
     write_u32(cache->version, keys_version);
     cache->index = (uint16_t)index;
-    instr->op.code = LOAD_ATTR_MODULE;
+    specialize(instr, LOAD_ATTR_MODULE);
     return 0;
 }
 
+static int
+specialize_module_load_attr(
+    PyObject *owner, _Py_CODEUNIT *instr, PyObject *name)
+{
+    PyModuleObject *m = (PyModuleObject *)owner;
+    assert((Py_TYPE(owner)->tp_flags & Py_TPFLAGS_MANAGED_DICT) == 0);
+    PyDictObject *dict = (PyDictObject *)m->md_dict;
+    if (dict == NULL) {
+        SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_NO_DICT);
+        return -1;
+    }
+    int result;
+    Py_BEGIN_CRITICAL_SECTION(dict);
+    result = specialize_module_load_attr_lock_held(dict, instr, name);
+    Py_END_CRITICAL_SECTION();
+    return result;
+}
+
 
 
 /* Attribute specialization */
@@ -792,30 +844,18 @@ _Py_Specialize_LoadSuperAttr(_PyStackRef global_super_st, _PyStackRef cls_st, _P
     PyObject *global_super = PyStackRef_AsPyObjectBorrow(global_super_st);
     PyObject *cls = PyStackRef_AsPyObjectBorrow(cls_st);
 
-    assert(ENABLE_SPECIALIZATION);
+    assert(ENABLE_SPECIALIZATION_FT);
     assert(_PyOpcode_Caches[LOAD_SUPER_ATTR] == INLINE_CACHE_ENTRIES_LOAD_SUPER_ATTR);
-    _PySuperAttrCache *cache = (_PySuperAttrCache *)(instr + 1);
     if (global_super != (PyObject *)&PySuper_Type) {
-        SPECIALIZATION_FAIL(LOAD_SUPER_ATTR, SPEC_FAIL_SUPER_SHADOWED);
-        goto fail;
+        unspecialize(instr, SPEC_FAIL_SUPER_SHADOWED);
+        return;
     }
     if (!PyType_Check(cls)) {
-        SPECIALIZATION_FAIL(LOAD_SUPER_ATTR, SPEC_FAIL_SUPER_BAD_CLASS);
-        goto fail;
+        unspecialize(instr, SPEC_FAIL_SUPER_BAD_CLASS);
+        return;
     }
-    instr->op.code = load_method ? LOAD_SUPER_ATTR_METHOD : LOAD_SUPER_ATTR_ATTR;
-    goto success;
-
-fail:
-    STAT_INC(LOAD_SUPER_ATTR, failure);
-    assert(!PyErr_Occurred());
-    instr->op.code = LOAD_SUPER_ATTR;
-    cache->counter = adaptive_counter_backoff(cache->counter);
-    return;
-success:
-    STAT_INC(LOAD_SUPER_ATTR, success);
-    assert(!PyErr_Occurred());
-    cache->counter = adaptive_counter_cooldown();
+    uint8_t load_code = load_method ? LOAD_SUPER_ATTR_METHOD : LOAD_SUPER_ATTR_ATTR;
+    specialize(instr, load_code);
 }
 
 typedef enum {
@@ -879,7 +919,7 @@ classify_descriptor(PyObject *descriptor, bool has_getattr)
 }
 
 static DescriptorClassification
-analyze_descriptor(PyTypeObject *type, PyObject *name, PyObject **descr, int store)
+lookup_descriptor(PyTypeObject *type, PyObject *name, PyObject **descr, int store)
 {
     bool has_getattr = false;
     if (store) {
@@ -898,7 +938,7 @@ analyze_descriptor(PyTypeObject *type, PyObject *name, PyObject **descr, int sto
             getattro_slot == _Py_slot_tp_getattro) {
             /* One or both of __getattribute__ or __getattr__ may have been
              overridden See typeobject.c for why these functions are special. */
-            PyObject *getattribute = _PyType_Lookup(type,
+            PyObject *getattribute = _PyType_LookupRef(type,
                 &_Py_ID(__getattribute__));
             PyInterpreterState *interp = _PyInterpreterState_GET();
             bool has_custom_getattribute = getattribute != NULL &&
@@ -913,6 +953,7 @@ analyze_descriptor(PyTypeObject *type, PyObject *name, PyObject **descr, int sto
                 }
                 /* Potentially both __getattr__ and __getattribute__ are set.
                    Too complicated */
+                Py_DECREF(getattribute);
                 *descr = NULL;
                 return GETSET_OVERRIDDEN;
             }
@@ -923,13 +964,14 @@ analyze_descriptor(PyTypeObject *type, PyObject *name, PyObject **descr, int sto
                raised. This means some specializations, e.g. specializing
                for property() isn't safe.
             */
+            Py_XDECREF(getattribute);
         }
         else {
             *descr = NULL;
             return GETSET_OVERRIDDEN;
         }
     }
-    PyObject *descriptor = _PyType_Lookup(type, name);
+    PyObject *descriptor = _PyType_LookupRef(type, name);
     *descr = descriptor;
     if (PyUnicode_CompareWithASCIIString(name, "__class__") == 0) {
         if (descriptor == _PyType_Lookup(&PyBaseObject_Type, name)) {
@@ -939,10 +981,47 @@ analyze_descriptor(PyTypeObject *type, PyObject *name, PyObject **descr, int sto
     return classify_descriptor(descriptor, has_getattr);
 }
 
+/* Classifies the attribute name of type. On return, *descr is a new
+ * reference to the descriptor, or NULL, and *tp_version is the version of
+ * type that the classification is valid for, or 0 if there is none.
+ */
+static DescriptorClassification
+analyze_descriptor(PyTypeObject *type, PyObject *name, PyObject **descr,
+                   unsigned int *tp_version, int store)
+{
+#ifdef Py_GIL_DISABLED
+    // Another thread may modify the type while we look at it. Modifying it
+    // resets its version before changing its dict, so the lookups are only
+    // valid if the version is the same before and after them.
+    unsigned int version = FT_ATOMIC_LOAD_UINT32_RELAXED(type->tp_version_tag);
+    DescriptorClassification kind = lookup_descriptor(type, name, descr, store);
+    if (FT_ATOMIC_LOAD_UINT32_RELAXED(type->tp_version_tag) != version) {
+        version = 0;
+    }
+#else
+    DescriptorClassification kind = lookup_descriptor(type, name, descr, store);
+    unsigned int version = type->tp_version_tag;
+#endif
+    *tp_version = version;
+    return kind;
+}
+
+#ifdef Py_GIL_DISABLED
+/* Specialized instructions push the descriptor cached in the instruction
+ * without taking a reference. Without the GIL, another thread may replace it
+ * on the type and free it while they run, unless it is immortal or only
+ * freed by the GC, which stops all threads. */
+static bool
+can_cache_borrowed_descr(PyObject *descr)
+{
+    return _Py_IsImmortal(descr) || _PyObject_HasDeferredRefcount(descr);
+}
+#endif
+
 static int
 specialize_dict_access(
     PyObject *owner, _Py_CODEUNIT *instr, PyTypeObject *type,
-    DescriptorClassification kind, PyObject *name,
+    DescriptorClassification kind, PyObject *name, unsigned int tp_version,
     int base_op, int values_op, int hint_op)
 {
     assert(kind == NON_OVERRIDING || kind == NON_DESCRIPTOR || kind == ABSENT ||
@@ -954,7 +1033,9 @@ specialize_dict_access(
         return 0;
     }
     _PyAttrCache *cache = (_PyAttrCache *)(instr + 1);
-    if (type->tp_flags & Py_TPFLAGS_INLINE_VALUES && _PyObject_InlineValues(owner)->valid) {
+    if (type->tp_flags & Py_TPFLAGS_INLINE_VALUES &&
+        FT_ATOMIC_LOAD_UINT8(_PyObject_InlineValues(owner)->valid))
+    {
         PyDictKeysObject *keys = ((PyHeapTypeObject *)type)->ht_cached_keys;
         assert(PyUnicode_CheckExact(name));
         Py_ssize_t index = _PyDictKeys_StringLookup(keys, name);
@@ -970,11 +1051,17 @@ specialize_dict_access(
             SPECIALIZATION_FAIL(base_op, SPEC_FAIL_OUT_OF_RANGE);
             return 0;
         }
-        write_u32(cache->version, type->tp_version_tag);
+        write_u32(cache->version, tp_version);
         cache->index = (uint16_t)offset;
-        instr->op.code = values_op;
+        specialize(instr, values_op);
     }
     else {
+#ifdef Py_GIL_DISABLED
+        // The *_WITH_HINT instructions read the managed dict without holding
+        // a reference to it, and another thread may replace and free it.
+        SPECIALIZATION_FAIL(base_op, SPEC_FAIL_OTHER);
+        return 0;
+#else
         PyDictObject *dict = _PyObject_GetManagedDict(owner);
         if (dict == NULL || !PyDict_CheckExact(dict)) {
             SPECIALIZATION_FAIL(base_op, SPEC_FAIL_NO_DICT);
@@ -995,14 +1082,15 @@ specialize_dict_access(
             return 0;
         }
         cache->index = (uint16_t)index;
-        write_u32(cache->version, type->tp_version_tag);
-        instr->op.code = hint_op;
+        write_u32(cache->version, tp_version);
+        specialize(instr, hint_op);
+#endif
     }
     return 1;
 }
 
 static int specialize_attr_loadclassattr(PyObject* owner, _Py_CODEUNIT* instr, PyObject* name,
-    PyObject* descr, DescriptorClassification kind, bool is_method);
+    PyObject* descr, unsigned int tp_version, DescriptorClassification kind, bool is_method);
 static int specialize_class_load_attr(PyObject* owner, _Py_CODEUNIT* instr, PyObject* name);
 
 /* Returns true if instances of obj's class are
@@ -1026,6 +1114,12 @@ instance_has_key(PyObject *obj, PyObject* name)
     if (dict == NULL || !PyDict_CheckExact(dict)) {
         return false;
     }
+#ifdef Py_GIL_DISABLED
+    // Another thread may replace and free the dict while we look into it.
+    // Assume the worst: nothing that depends on the instance dict is
+    // specialized in free-threaded builds anyway.
+    return true;
+#else
     if (dict->ma_values) {
         return false;
     }
@@ -1034,18 +1128,19 @@ instance_has_key(PyObject *obj, PyObject* name)
         return false;
     }
     return true;
+#endif
 }
 
 static int
-specialize_instance_load_attr(PyObject* owner, _Py_CODEUNIT* instr, PyObject* name)
+do_specialize_instance_load_attr(PyObject* owner, _Py_CODEUNIT* instr, PyObject* name,
+                                 bool shadow, DescriptorClassification kind,
+                                 PyObject *descr, unsigned int tp_version)
 {
     _PyAttrCache *cache = (_PyAttrCache *)(instr + 1);
     PyTypeObject *type = Py_TYPE(owner);
-    bool shadow = instance_has_key(owner, name);
-    PyObject *descr = NULL;
-    DescriptorClassification kind = analyze_descriptor(type, name, &descr, 0);
     assert(descr != NULL || kind == ABSENT || kind == GETSET_OVERRIDDEN);
-    if (type_get_version(type, LOAD_ATTR) == 0) {
+    if (tp_version == 0) {
+        SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_OUT_OF_VERSIONS);
         return -1;
     }
     switch(kind) {
@@ -1059,7 +1154,8 @@ specialize_instance_load_attr(PyObject* owner, _Py_CODEUNIT* instr, PyObject* na
             }
             int oparg = instr->op.arg;
             if (oparg & 1) {
-                if (specialize_attr_loadclassattr(owner, instr, name, descr, kind, true)) {
+                if (specialize_attr_loadclassattr(owner, instr, name, descr,
+                                                  tp_version, kind, true)) {
                     return 0;
                 }
                 else {
@@ -1071,6 +1167,12 @@ specialize_instance_load_attr(PyObject* owner, _Py_CODEUNIT* instr, PyObject* na
         }
         case PROPERTY:
         {
+#ifdef Py_GIL_DISABLED
+            // LOAD_ATTR_PROPERTY runs the getter's code from a borrowed
+            // reference, and another thread may replace it.
+            SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_ATTR_PROPERTY);
+            return -1;
+#else
             _PyLoadMethodCache *lm_cache = (_PyLoadMethodCache *)(instr + 1);
             assert(Py_TYPE(descr) == &PyProperty_Type);
             PyObject *fget = ((_PyPropertyObject *)descr)->prop_get;
@@ -1093,12 +1195,12 @@ specialize_instance_load_attr(PyObject* owner, _Py_CODEUNIT* instr, PyObject* na
                 SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_OTHER);
                 return -1;
             }
-            assert(type->tp_version_tag != 0);
-            write_u32(lm_cache->type_version, type->tp_version_tag);
+            write_u32(lm_cache->type_version, tp_version);
             /* borrowed */
             write_obj(lm_cache->descr, fget);
-            instr->op.code = LOAD_ATTR_PROPERTY;
+            specialize(instr, LOAD_ATTR_PROPERTY);
             return 0;
+#endif
         }
         case OBJECT_SLOT:
         {
@@ -1120,8 +1222,8 @@ specialize_instance_load_attr(PyObject* owner, _Py_CODEUNIT* instr, PyObject* na
             assert(dmem->type == Py_T_OBJECT_EX || dmem->type == _Py_T_OBJECT);
             assert(offset > 0);
             cache->index = (uint16_t)offset;
-            write_u32(cache->version, type->tp_version_tag);
-            instr->op.code = LOAD_ATTR_SLOT;
+            write_u32(cache->version, tp_version);
+            specialize(instr, LOAD_ATTR_SLOT);
             return 0;
         }
         case DUNDER_CLASS:
@@ -1129,8 +1231,8 @@ specialize_instance_load_attr(PyObject* owner, _Py_CODEUNIT* instr, PyObject* na
             Py_ssize_t offset = offsetof(PyObject, ob_type);
             assert(offset == (uint16_t)offset);
             cache->index = (uint16_t)offset;
-            write_u32(cache->version, type->tp_version_tag);
-            instr->op.code = LOAD_ATTR_SLOT;
+            write_u32(cache->version, tp_version);
+            specialize(instr, LOAD_ATTR_SLOT);
             return 0;
         }
         case OTHER_SLOT:
@@ -1144,6 +1246,12 @@ specialize_instance_load_attr(PyObject* owner, _Py_CODEUNIT* instr, PyObject* na
             return -1;
         case GETATTRIBUTE_IS_PYTHON_FUNCTION:
         {
+#ifdef Py_GIL_DISABLED
+            // LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN runs __getattribute__ from a
+            // borrowed reference, and another thread may replace its code.
+            SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_OVERRIDDEN);
+            return -1;
+#else
             assert(type->tp_getattro == _Py_slot_tp_getattro);
             assert(Py_IS_TYPE(descr, &PyFunction_Type));
             _PyLoadMethodCache *lm_cache = (_PyLoadMethodCache *)(instr + 1);
@@ -1165,9 +1273,10 @@ specialize_instance_load_attr(PyObject* owner, _Py_CODEUNIT* instr, PyObject* na
             write_u32(lm_cache->keys_version, version);
             /* borrowed */
             write_obj(lm_cache->descr, descr);
-            write_u32(lm_cache->type_version, type->tp_version_tag);
-            instr->op.code = LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN;
+            write_u32(lm_cache->type_version, tp_version);
+            specialize(instr, LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN);
             return 0;
+#endif
         }
         case BUILTIN_CLASSMETHOD:
         case PYTHON_CLASSMETHOD:
@@ -1181,7 +1290,8 @@ specialize_instance_load_attr(PyObject* owner, _Py_CODEUNIT* instr, PyObject* na
                 goto try_instance;
             }
             if ((instr->op.arg & 1) == 0) {
-                if (specialize_attr_loadclassattr(owner, instr, name, descr, kind, false)) {
+                if (specialize_attr_loadclassattr(owner, instr, name, descr,
+                                                  tp_version, kind, false)) {
                     return 0;
                 }
             }
@@ -1190,25 +1300,42 @@ specialize_instance_load_attr(PyObject* owner, _Py_CODEUNIT* instr, PyObject* na
             if (shadow) {
                 goto try_instance;
             }
+            set_counter((_Py_BackoffCounter *)instr + 1,
+                        adaptive_counter_cooldown());
             return 0;
     }
     Py_UNREACHABLE();
 try_instance:
-    if (specialize_dict_access(owner, instr, type, kind, name, LOAD_ATTR,
-                                    LOAD_ATTR_INSTANCE_VALUE, LOAD_ATTR_WITH_HINT))
+    if (specialize_dict_access(owner, instr, type, kind, name, tp_version,
+                               LOAD_ATTR, LOAD_ATTR_INSTANCE_VALUE,
+                               LOAD_ATTR_WITH_HINT))
     {
         return 0;
     }
     return -1;
 }
 
+static int
+specialize_instance_load_attr(PyObject* owner, _Py_CODEUNIT* instr, PyObject* name)
+{
+    PyTypeObject *type = Py_TYPE(owner);
+    bool shadow = instance_has_key(owner, name);
+    PyObject *descr = NULL;
+    unsigned int tp_version = 0;
+    DescriptorClassification kind =
+        analyze_descriptor(type, name, &descr, &tp_version, 0);
+    int result = do_specialize_instance_load_attr(owner, instr, name, shadow,
+                                                  kind, descr, tp_version);
+    Py_XDECREF(descr);
+    return result;
+}
+
 void
 _Py_Specialize_LoadAttr(_PyStackRef owner_st, _Py_CODEUNIT *instr, PyObject *name)
 {
-    _PyAttrCache *cache = (_PyAttrCache *)(instr + 1);
     PyObject *owner = PyStackRef_AsPyObjectBorrow(owner_st);
 
-    assert(ENABLE_SPECIALIZATION);
+    assert(ENABLE_SPECIALIZATION_FT);
     assert(_PyOpcode_Caches[LOAD_ATTR] == INLINE_CACHE_ENTRIES_LOAD_ATTR);
     PyTypeObject *type = Py_TYPE(owner);
     bool fail;
@@ -1230,53 +1357,31 @@ _Py_Specialize_LoadAttr(_PyStackRef owner_st, _Py_CODEUNIT *instr, PyObject *nam
     }
 
     if (fail) {
-        STAT_INC(LOAD_ATTR, failure);
-        assert(!PyErr_Occurred());
-        instr->op.code = LOAD_ATTR;
-        cache->counter = adaptive_counter_backoff(cache->counter);
-    }
-    else {
-        STAT_INC(LOAD_ATTR, success);
-        assert(!PyErr_Occurred());
-        cache->counter = adaptive_counter_cooldown();
+        unspecialize_failed(instr);
     }
 }
 
-void
-_Py_Specialize_StoreAttr(_PyStackRef owner_st, _Py_CODEUNIT *instr, PyObject *name)
+static int
+do_specialize_store_attr(PyObject *owner, _Py_CODEUNIT *instr, PyObject *name,
+                         DescriptorClassification kind, PyObject *descr,
+                         unsigned int tp_version)
 {
-    PyObject *owner = PyStackRef_AsPyObjectBorrow(owner_st);
-
-    assert(ENABLE_SPECIALIZATION);
-    assert(_PyOpcode_Caches[STORE_ATTR] == INLINE_CACHE_ENTRIES_STORE_ATTR);
     _PyAttrCache *cache = (_PyAttrCache *)(instr + 1);
     PyTypeObject *type = Py_TYPE(owner);
-    if (!_PyType_IsReady(type)) {
-        // We *might* not really need this check, but we inherited it from
-        // PyObject_GenericSetAttr and friends... and this way we still do the
-        // right thing if someone forgets to call PyType_Ready(type):
-        SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_OTHER);
-        goto fail;
-    }
-    if (PyModule_CheckExact(owner)) {
-        SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_OVERRIDDEN);
-        goto fail;
-    }
-    PyObject *descr;
-    DescriptorClassification kind = analyze_descriptor(type, name, &descr, 1);
-    if (type_get_version(type, STORE_ATTR) == 0) {
-        goto fail;
+    if (tp_version == 0) {
+        SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_OUT_OF_VERSIONS);
+        return -1;
     }
     switch(kind) {
         case OVERRIDING:
             SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_ATTR_OVERRIDING_DESCRIPTOR);
-            goto fail;
+            return -1;
         case METHOD:
             SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_ATTR_METHOD);
-            goto fail;
+            return -1;
         case PROPERTY:
             SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_ATTR_PROPERTY);
-            goto fail;
+            return -1;
         case OBJECT_SLOT:
         {
             PyMemberDescrObject *member = (PyMemberDescrObject *)descr;
@@ -1284,63 +1389,85 @@ _Py_Specialize_StoreAttr(_PyStackRef owner_st, _Py_CODEUNIT *instr, PyObject *na
             Py_ssize_t offset = dmem->offset;
             if (!PyObject_TypeCheck(owner, member->d_common.d_type)) {
                 SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_EXPECTED_ERROR);
-                goto fail;
+                return -1;
             }
             if (dmem->flags & Py_READONLY) {
                 SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_ATTR_READ_ONLY);
-                goto fail;
+                return -1;
             }
             if (offset != (uint16_t)offset) {
                 SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_OUT_OF_RANGE);
-                goto fail;
+                return -1;
             }
             assert(dmem->type == Py_T_OBJECT_EX || dmem->type == _Py_T_OBJECT);
             assert(offset > 0);
             cache->index = (uint16_t)offset;
-            write_u32(cache->version, type->tp_version_tag);
-            instr->op.code = STORE_ATTR_SLOT;
-            goto success;
+            write_u32(cache->version, tp_version);
+            specialize(instr, STORE_ATTR_SLOT);
+            return 0;
         }
         case DUNDER_CLASS:
         case OTHER_SLOT:
             SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_ATTR_NON_OBJECT_SLOT);
-            goto fail;
+            return -1;
         case MUTABLE:
             SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_ATTR_MUTABLE_CLASS);
-            goto fail;
+            return -1;
         case GETATTRIBUTE_IS_PYTHON_FUNCTION:
         case GETSET_OVERRIDDEN:
             SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_OVERRIDDEN);
-            goto fail;
+            return -1;
         case BUILTIN_CLASSMETHOD:
             SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_ATTR_BUILTIN_CLASS_METHOD_OBJ);
-            goto fail;
+            return -1;
         case PYTHON_CLASSMETHOD:
             SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_ATTR_CLASS_METHOD_OBJ);
-            goto fail;
+            return -1;
         case NON_OVERRIDING:
             SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_ATTR_CLASS_ATTR_DESCRIPTOR);
-            goto fail;
+            return -1;
         case NON_DESCRIPTOR:
             SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_ATTR_CLASS_ATTR_SIMPLE);
-            goto fail;
+            return -1;
         case ABSENT:
-            if (specialize_dict_access(owner, instr, type, kind, name, STORE_ATTR,
-                                    STORE_ATTR_INSTANCE_VALUE, STORE_ATTR_WITH_HINT))
+            if (specialize_dict_access(owner, instr, type, kind, name, tp_version,
+                                       STORE_ATTR, STORE_ATTR_INSTANCE_VALUE,
+                                       STORE_ATTR_WITH_HINT))
             {
-                goto success;
+                return 0;
             }
+            return -1;
     }
-fail:
-    STAT_INC(STORE_ATTR, failure);
-    assert(!PyErr_Occurred());
-    instr->op.code = STORE_ATTR;
-    cache->counter = adaptive_counter_backoff(cache->counter);
-    return;
-success:
-    STAT_INC(STORE_ATTR, success);
-    assert(!PyErr_Occurred());
-    cache->counter = adaptive_counter_cooldown();
+    Py_UNREACHABLE();
+}
+
+void
+_Py_Specialize_StoreAttr(_PyStackRef owner_st, _Py_CODEUNIT *instr, PyObject *name)
+{
+    PyObject *owner = PyStackRef_AsPyObjectBorrow(owner_st);
+
+    assert(ENABLE_SPECIALIZATION_FT);
+    assert(_PyOpcode_Caches[STORE_ATTR] == INLINE_CACHE_ENTRIES_STORE_ATTR);
+    PyTypeObject *type = Py_TYPE(owner);
+    if (!_PyType_IsReady(type)) {
+        // We *might* not really need this check, but we inherited it from
+        // PyObject_GenericSetAttr and friends... and this way we still do the
+        // right thing if someone forgets to call PyType_Ready(type):
+        unspecialize(instr, SPEC_FAIL_OTHER);
+        return;
+    }
+    if (PyModule_CheckExact(owner)) {
+        unspecialize(instr, SPEC_FAIL_OVERRIDDEN);
+        return;
+    }
+    PyObject *descr = NULL;
+    unsigned int tp_version = 0;
+    DescriptorClassification kind =
+        analyze_descriptor(type, name, &descr, &tp_version, 1);
+    if (do_specialize_store_attr(owner, instr, name, kind, descr, tp_version)) {
+        unspecialize_failed(instr);
+    }
+    Py_XDECREF(descr);
 }
 
 
@@ -1392,8 +1519,21 @@ specialize_class_load_attr(PyObject *owner, _Py_CODEUNIT *instr,
         SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_ATTR_METACLASS_OVERRIDDEN);
         return -1;
     }
-    PyObject *metadescriptor = _PyType_Lookup(Py_TYPE(cls), name);
+    PyTypeObject *metaclass = Py_TYPE(cls);
+#ifdef Py_GIL_DISABLED
+    // See analyze_descriptor()
+    unsigned int meta_version = FT_ATOMIC_LOAD_UINT32_RELAXED(metaclass->tp_version_tag);
+#endif
+    PyObject *metadescriptor = _PyType_LookupRef(metaclass, name);
     DescriptorClassification metakind = classify_descriptor(metadescriptor, false);
+    Py_XDECREF(metadescriptor);
+#ifdef Py_GIL_DISABLED
+    if (FT_ATOMIC_LOAD_UINT32_RELAXED(metaclass->tp_version_tag) != meta_version) {
+        meta_version = 0;
+    }
+#else
+    unsigned int meta_version = metaclass->tp_version_tag;
+#endif
     switch (metakind) {
         case METHOD:
         case NON_DESCRIPTOR:
@@ -1408,39 +1548,57 @@ specialize_class_load_attr(PyObject *owner, _Py_CODEUNIT *instr,
     }
     PyObject *descr = NULL;
     DescriptorClassification kind = 0;
-    kind = analyze_descriptor(cls, name, &descr, 0);
-    if (type_get_version(cls, LOAD_ATTR) == 0) {
+    unsigned int tp_version = 0;
+    kind = analyze_descriptor(cls, name, &descr, &tp_version, 0);
+    if (tp_version == 0) {
+        SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_OUT_OF_VERSIONS);
+        Py_XDECREF(descr);
         return -1;
     }
     bool metaclass_check = false;
-    if ((Py_TYPE(cls)->tp_flags & Py_TPFLAGS_IMMUTABLETYPE) == 0) {
+    if ((metaclass->tp_flags & Py_TPFLAGS_IMMUTABLETYPE) == 0) {
         metaclass_check = true;
-        if (type_get_version(Py_TYPE(cls), LOAD_ATTR) == 0) {
+        if (meta_version == 0) {
+            SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_OUT_OF_VERSIONS);
+            Py_XDECREF(descr);
             return -1;
         }
     }
+    int result;
     switch (kind) {
         case METHOD:
         case NON_DESCRIPTOR:
-            write_u32(cache->type_version, cls->tp_version_tag);
+#ifdef Py_GIL_DISABLED
+            if (!can_cache_borrowed_descr(descr)) {
+                SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_OTHER);
+                result = -1;
+                break;
+            }
+#endif
+            write_u32(cache->type_version, tp_version);
             write_obj(cache->descr, descr);
             if (metaclass_check) {
-                write_u32(cache->keys_version, Py_TYPE(cls)->tp_version_tag);
-                instr->op.code = LOAD_ATTR_CLASS_WITH_METACLASS_CHECK;
+                write_u32(cache->keys_version, meta_version);
+                specialize(instr, LOAD_ATTR_CLASS_WITH_METACLASS_CHECK);
             }
             else {
-                instr->op.code = LOAD_ATTR_CLASS;
+                specialize(instr, LOAD_ATTR_CLASS);
             }
-            return 0;
+            result = 0;
+            break;
 #ifdef Py_STATS
         case ABSENT:
             SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_EXPECTED_ERROR);
-            return -1;
+            result = -1;
+            break;
 #endif
         default:
             SPECIALIZATION_FAIL(LOAD_ATTR, load_attr_fail_kind(kind));
-            return -1;
+            result = -1;
+            break;
     }
+    Py_XDECREF(descr);
+    return result;
 }
 
 // Please collect stats carefully before and after modifying. A subtle change
@@ -1448,13 +1606,21 @@ specialize_class_load_attr(PyObject *owner, _Py_CODEUNIT *instr,
 // python.exe -m test_typing test_re test_dis test_zlib.
 static int
 specialize_attr_loadclassattr(PyObject *owner, _Py_CODEUNIT *instr, PyObject *name,
-PyObject *descr, DescriptorClassification kind, bool is_method)
+                              PyObject *descr, unsigned int tp_version,
+                              DescriptorClassification kind, bool is_method)
 {
     _PyLoadMethodCache *cache = (_PyLoadMethodCache *)(instr + 1);
     PyTypeObject *owner_cls = Py_TYPE(owner);
 
     assert(descr != NULL);
     assert((is_method && kind == METHOD) || (!is_method && kind == NON_DESCRIPTOR));
+#ifdef Py_GIL_DISABLED
+    if (!can_cache_borrowed_descr(descr)) {
+        SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_OTHER);
+        return 0;
+    }
+#endif
+    uint8_t specialized_op;
     if (owner_cls->tp_flags & Py_TPFLAGS_INLINE_VALUES) {
         PyDictKeysObject *keys = ((PyHeapTypeObject *)owner_cls)->ht_cached_keys;
         assert(_PyDictKeys_StringLookup(keys, name) < 0);
@@ -1465,7 +1631,7 @@ PyObject *descr, DescriptorClassification kind, bool is_method)
             return 0;
         }
         write_u32(cache->keys_version, keys_version);
-        instr->op.code = is_method ? LOAD_ATTR_METHOD_WITH_VALUES : LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES;
+        specialized_op = is_method ? LOAD_ATTR_METHOD_WITH_VALUES : LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES;
     }
     else {
         Py_ssize_t dictoffset;
@@ -1480,10 +1646,11 @@ PyObject *descr, DescriptorClassification kind, bool is_method)
             }
         }
         if (dictoffset == 0) {
-            instr->op.code = is_method ? LOAD_ATTR_METHOD_NO_DICT : LOAD_ATTR_NONDESCRIPTOR_NO_DICT;
+            specialized_op = is_method ? LOAD_ATTR_METHOD_NO_DICT : LOAD_ATTR_NONDESCRIPTOR_NO_DICT;
         }
         else if (is_method) {
-            PyObject *dict = *(PyObject **) ((char *)owner + dictoffset);
+            PyObject *dict = FT_ATOMIC_LOAD_PTR_ACQUIRE(
+                *(PyObject **) ((char *)owner + dictoffset));
             if (dict) {
                 SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_ATTR_NOT_MANAGED_DICT);
                 return 0;
@@ -1494,7 +1661,7 @@ PyObject *descr, DescriptorClassification kind, bool is_method)
             dictoffset -= MANAGED_DICT_OFFSET;
             assert(((uint16_t)dictoffset) == dictoffset);
             cache->dict_offset = (uint16_t)dictoffset;
-            instr->op.code = LOAD_ATTR_METHOD_LAZY_DICT;
+            specialized_op = LOAD_ATTR_METHOD_LAZY_DICT;
         }
         else {
             SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_ATTR_CLASS_ATTR_SIMPLE);
@@ -1515,109 +1682,109 @@ PyObject *descr, DescriptorClassification kind, bool is_method)
     *  PyType_Modified usages in typeobject.c). The MCACHE has been
     *  working since Python 2.6 and it's battle-tested.
     */
-    write_u32(cache->type_version, owner_cls->tp_version_tag);
+    write_u32(cache->type_version, tp_version);
     write_obj(cache->descr, descr);
+    specialize(instr, specialized_op);
     return 1;
 }
 
-void
-_Py_Specialize_LoadGlobal(
+static void
+specialize_load_global_lock_held(
     PyObject *globals, PyObject *builtins,
     _Py_CODEUNIT *instr, PyObject *name)
 {
-    assert(ENABLE_SPECIALIZATION);
+    assert(ENABLE_SPECIALIZATION_FT);
     assert(_PyOpcode_Caches[LOAD_GLOBAL] == INLINE_CACHE_ENTRIES_LOAD_GLOBAL);
     /* Use inline cache */
     _PyLoadGlobalCache *cache = (_PyLoadGlobalCache *)(instr + 1);
     assert(PyUnicode_CheckExact(name));
     if (!PyDict_CheckExact(globals)) {
-        SPECIALIZATION_FAIL(LOAD_GLOBAL, SPEC_FAIL_LOAD_GLOBAL_NON_DICT);
-        goto fail;
+        unspecialize(instr, SPEC_FAIL_LOAD_GLOBAL_NON_DICT);
+        return;
     }
     PyDictKeysObject * globals_keys = ((PyDictObject *)globals)->ma_keys;
     if (!DK_IS_UNICODE(globals_keys)) {
-        SPECIALIZATION_FAIL(LOAD_GLOBAL, SPEC_FAIL_LOAD_GLOBAL_NON_STRING_OR_SPLIT);
-        goto fail;
+        unspecialize(instr, SPEC_FAIL_LOAD_GLOBAL_NON_STRING_OR_SPLIT);
+        return;
     }
     Py_ssize_t index = _PyDictKeys_StringLookup(globals_keys, name);
     if (index == DKIX_ERROR) {
-        SPECIALIZATION_FAIL(LOAD_GLOBAL, SPEC_FAIL_EXPECTED_ERROR);
-        goto fail;
+        unspecialize(instr, SPEC_FAIL_EXPECTED_ERROR);
+        return;
     }
     PyInterpreterState *interp = _PyInterpreterState_GET();
     if (index != DKIX_EMPTY) {
         if (index != (uint16_t)index) {
-            SPECIALIZATION_FAIL(LOAD_GLOBAL, SPEC_FAIL_OUT_OF_RANGE);
-            goto fail;
+            unspecialize(instr, SPEC_FAIL_OUT_OF_RANGE);
+            return;
         }
-        uint32_t keys_version = _PyDictKeys_GetVersionForCurrentState(
-                interp, globals_keys);
+        uint32_t keys_version = _PyDict_GetKeysVersionForCurrentState(
+                interp, (PyDictObject*) globals);
         if (keys_version == 0) {
-            SPECIALIZATION_FAIL(LOAD_GLOBAL, SPEC_FAIL_OUT_OF_VERSIONS);
-            goto fail;
+            unspecialize(instr, SPEC_FAIL_OUT_OF_VERSIONS);
+            return;
         }
         if (keys_version != (uint16_t)keys_version) {
-            SPECIALIZATION_FAIL(LOAD_GLOBAL, SPEC_FAIL_OUT_OF_RANGE);
-            goto fail;
+            unspecialize(instr, SPEC_FAIL_OUT_OF_RANGE);
+            return;
         }
         cache->index = (uint16_t)index;
         cache->module_keys_version = (uint16_t)keys_version;
-        instr->op.code = LOAD_GLOBAL_MODULE;
-        goto success;
+        specialize(instr, LOAD_GLOBAL_MODULE);
+        return;
     }
     if (!PyDict_CheckExact(builtins)) {
-        SPECIALIZATION_FAIL(LOAD_GLOBAL, SPEC_FAIL_LOAD_GLOBAL_NON_DICT);
-        goto fail;
+        unspecialize(instr, SPEC_FAIL_LOAD_GLOBAL_NON_DICT);
+        return;
     }
     PyDictKeysObject * builtin_keys = ((PyDictObject *)builtins)->ma_keys;
     if (!DK_IS_UNICODE(builtin_keys)) {
-        SPECIALIZATION_FAIL(LOAD_GLOBAL, SPEC_FAIL_LOAD_GLOBAL_NON_STRING_OR_SPLIT);
-        goto fail;
+        unspecialize(instr, SPEC_FAIL_LOAD_GLOBAL_NON_STRING_OR_SPLIT);
+        return;
     }
     index = _PyDictKeys_StringLookup(builtin_keys, name);
     if (index == DKIX_ERROR) {
-        SPECIALIZATION_FAIL(LOAD_GLOBAL, SPEC_FAIL_EXPECTED_ERROR);
-        goto fail;
+        unspecialize(instr, SPEC_FAIL_EXPECTED_ERROR);
+        return;
     }
     if (index != (uint16_t)index) {
-        SPECIALIZATION_FAIL(LOAD_GLOBAL, SPEC_FAIL_OUT_OF_RANGE);
-        goto fail;
+        unspecialize(instr, SPEC_FAIL_OUT_OF_RANGE);
+        return;
     }
-    uint32_t globals_version = _PyDictKeys_GetVersionForCurrentState(
-            interp, globals_keys);
+    uint32_t globals_version = _PyDict_GetKeysVersionForCurrentState(
+            interp, (PyDictObject*) globals);
     if (globals_version == 0) {
-        SPECIALIZATION_FAIL(LOAD_GLOBAL, SPEC_FAIL_OUT_OF_VERSIONS);
-        goto fail;
+        unspecialize(instr, SPEC_FAIL_OUT_OF_VERSIONS);
+        return;
     }
     if (globals_version != (uint16_t)globals_version) {
-        SPECIALIZATION_FAIL(LOAD_GLOBAL, SPEC_FAIL_OUT_OF_RANGE);
-        goto fail;
+        unspecialize(instr, SPEC_FAIL_OUT_OF_RANGE);
+        return;
     }
-    uint32_t builtins_version = _PyDictKeys_GetVersionForCurrentState(
-            interp, builtin_keys);
+    uint32_t builtins_version = _PyDict_GetKeysVersionForCurrentState(
+            interp, (PyDictObject*) builtins);
     if (builtins_version == 0) {
-        SPECIALIZATION_FAIL(LOAD_GLOBAL, SPEC_FAIL_OUT_OF_VERSIONS);
-        goto fail;
+        unspecialize(instr, SPEC_FAIL_OUT_OF_VERSIONS);
+        return;
     }
     if (builtins_version > UINT16_MAX) {
-        SPECIALIZATION_FAIL(LOAD_GLOBAL, SPEC_FAIL_OUT_OF_RANGE);
-        goto fail;
+        unspecialize(instr, SPEC_FAIL_OUT_OF_RANGE);
+        return;
     }
     cache->index = (uint16_t)index;
     cache->module_keys_version = (uint16_t)globals_version;
     cache->builtin_keys_version = (uint16_t)builtins_version;
-    instr->op.code = LOAD_GLOBAL_BUILTIN;
-    goto success;
-fail:
-    STAT_INC(LOAD_GLOBAL, failure);
-    assert(!PyErr_Occurred());
-    instr->op.code = LOAD_GLOBAL;
-    cache->counter = adaptive_counter_backoff(cache->counter);
-    return;
-success:
-    STAT_INC(LOAD_GLOBAL, success);
-    assert(!PyErr_Occurred());
-    cache->counter = adaptive_counter_cooldown();
+    specialize(instr, LOAD_GLOBAL_BUILTIN);
+}
+
+void
+_Py_Specialize_LoadGlobal(
+    PyObject *globals, PyObject *builtins,
+    _Py_CODEUNIT *instr, PyObject *name)
+{
+    Py_BEGIN_CRITICAL_SECTION2(globals, builtins);
+    specialize_load_global_lock_held(globals, builtins, instr, name);
+    Py_END_CRITICAL_SECTION2();
 }
 
 #ifdef Py_STATS
@@ -1700,7 +1867,7 @@ function_get_version(PyObject *o, int opcode)
 static uint32_t
 type_get_version(PyTypeObject *t, int opcode)
 {
-    uint32_t version = t->tp_version_tag;
+    uint32_t version = FT_ATOMIC_LOAD_UINT32_RELAXED(t->tp_version_tag);
     if (version == 0) {
         SPECIALIZATION_FAIL(opcode, SPEC_FAIL_OUT_OF_VERSIONS);
         return 0;
@@ -1715,183 +1882,147 @@ _Py_Specialize_BinarySubscr(
     PyObject *container = PyStackRef_AsPyObjectBorrow(container_st);
     PyObject *sub = PyStackRef_AsPyObjectBorrow(sub_st);
 
-    assert(ENABLE_SPECIALIZATION);
+    assert(ENABLE_SPECIALIZATION_FT);
     assert(_PyOpcode_Caches[BINARY_SUBSCR] ==
            INLINE_CACHE_ENTRIES_BINARY_SUBSCR);
-    _PyBinarySubscrCache *cache = (_PyBinarySubscrCache *)(instr + 1);
     PyTypeObject *container_type = Py_TYPE(container);
     if (container_type == &PyList_Type) {
         if (PyLong_CheckExact(sub)) {
             if (_PyLong_IsNonNegativeCompact((PyLongObject *)sub)) {
-                instr->op.code = BINARY_SUBSCR_LIST_INT;
-                goto success;
+                specialize(instr, BINARY_SUBSCR_LIST_INT);
+                return;
             }
-            SPECIALIZATION_FAIL(BINARY_SUBSCR, SPEC_FAIL_OUT_OF_RANGE);
-            goto fail;
+            unspecialize(instr, SPEC_FAIL_OUT_OF_RANGE);
+            return;
         }
-        SPECIALIZATION_FAIL(BINARY_SUBSCR,
+        unspecialize(instr,
             PySlice_Check(sub) ? SPEC_FAIL_SUBSCR_LIST_SLICE : SPEC_FAIL_OTHER);
-        goto fail;
+        return;
     }
     if (container_type == &PyTuple_Type) {
         if (PyLong_CheckExact(sub)) {
             if (_PyLong_IsNonNegativeCompact((PyLongObject *)sub)) {
-                instr->op.code = BINARY_SUBSCR_TUPLE_INT;
-                goto success;
+                specialize(instr, BINARY_SUBSCR_TUPLE_INT);
+                return;
             }
-            SPECIALIZATION_FAIL(BINARY_SUBSCR, SPEC_FAIL_OUT_OF_RANGE);
-            goto fail;
+            unspecialize(instr, SPEC_FAIL_OUT_OF_RANGE);
+            return;
         }
-        SPECIALIZATION_FAIL(BINARY_SUBSCR,
+        unspecialize(instr,
             PySlice_Check(sub) ? SPEC_FAIL_SUBSCR_TUPLE_SLICE : SPEC_FAIL_OTHER);
-        goto fail;
+        return;
     }
     if (container_type == &PyUnicode_Type) {
         if (PyLong_CheckExact(sub)) {
             if (_PyLong_IsNonNegativeCompact((PyLongObject *)sub)) {
-                instr->op.code = BINARY_SUBSCR_STR_INT;
-                goto success;
+                specialize(instr, BINARY_SUBSCR_STR_INT);
+                return;
             }
-            SPECIALIZATION_FAIL(BINARY_SUBSCR, SPEC_FAIL_OUT_OF_RANGE);
-            goto fail;
+            unspecialize(instr, SPEC_FAIL_OUT_OF_RANGE);
+            return;
         }
-        SPECIALIZATION_FAIL(BINARY_SUBSCR,
+        unspecialize(instr,
             PySlice_Check(sub) ? SPEC_FAIL_SUBSCR_STRING_SLICE : SPEC_FAIL_OTHER);
-        goto fail;
+        return;
     }
     if (container_type == &PyDict_Type) {
-        instr->op.code = BINARY_SUBSCR_DICT;
-        goto success;
+        specialize(instr, BINARY_SUBSCR_DICT);
+        return;
     }
+#ifndef Py_GIL_DISABLED
+    // BINARY_SUBSCR_GETITEM reads the __getitem__ function cached on the
+    // type without holding a reference to it, which is not safe when another
+    // thread can replace it.
     PyTypeObject *cls = Py_TYPE(container);
     PyObject *descriptor = _PyType_Lookup(cls, &_Py_ID(__getitem__));
     if (descriptor && Py_TYPE(descriptor) == &PyFunction_Type) {
         if (!(container_type->tp_flags & Py_TPFLAGS_HEAPTYPE)) {
-            SPECIALIZATION_FAIL(BINARY_SUBSCR, SPEC_FAIL_SUBSCR_NOT_HEAP_TYPE);
-            goto fail;
+            unspecialize(instr, SPEC_FAIL_SUBSCR_NOT_HEAP_TYPE);
+            return;
         }
         PyFunctionObject *func = (PyFunctionObject *)descriptor;
         PyCodeObject *fcode = (PyCodeObject *)func->func_code;
         int kind = function_kind(fcode);
         if (kind != SIMPLE_FUNCTION) {
-            SPECIALIZATION_FAIL(BINARY_SUBSCR, kind);
-            goto fail;
+            unspecialize(instr, kind);
+            return;
         }
         if (fcode->co_argcount != 2) {
-            SPECIALIZATION_FAIL(BINARY_SUBSCR, SPEC_FAIL_WRONG_NUMBER_ARGUMENTS);
-            goto fail;
+            unspecialize(instr, SPEC_FAIL_WRONG_NUMBER_ARGUMENTS);
+            return;
         }
         uint32_t version = _PyFunction_GetVersionForCurrentState(func);
         if (!_PyFunction_IsVersionValid(version)) {
-            SPECIALIZATION_FAIL(BINARY_SUBSCR, SPEC_FAIL_OUT_OF_VERSIONS);
-            goto fail;
+            unspecialize(instr, SPEC_FAIL_OUT_OF_VERSIONS);
+            return;
         }
         if (_PyInterpreterState_GET()->eval_frame) {
-            SPECIALIZATION_FAIL(BINARY_SUBSCR, SPEC_FAIL_OTHER);
-            goto fail;
+            unspecialize(instr, SPEC_FAIL_OTHER);
+            return;
         }
         PyHeapTypeObject *ht = (PyHeapTypeObject *)container_type;
         // This pointer is invalidated by PyType_Modified (see the comment on
         // struct _specialization_cache):
         ht->_spec_cache.getitem = descriptor;
         ht->_spec_cache.getitem_version = version;
-        instr->op.code = BINARY_SUBSCR_GETITEM;
-        goto success;
+        specialize(instr, BINARY_SUBSCR_GETITEM);
+        return;
     }
-    SPECIALIZATION_FAIL(BINARY_SUBSCR,
-                        binary_subscr_fail_kind(container_type, sub));
-fail:
-    STAT_INC(BINARY_SUBSCR, failure);
-    assert(!PyErr_Occurred());
-    instr->op.code = BINARY_SUBSCR;
-    cache->counter = adaptive_counter_backoff(cache->counter);
-    return;
-success:
-    STAT_INC(BINARY_SUBSCR, success);
-    assert(!PyErr_Occurred());
-    cache->counter = adaptive_counter_cooldown();
+#endif  // Py_GIL_DISABLED
+#ifdef Py_STATS
+    unspecialize(instr, binary_subscr_fail_kind(container_type, sub));
+#else
+    unspecialize(instr, SPEC_FAIL_OTHER);
+#endif
 }
 
-void
-_Py_Specialize_StoreSubscr(_PyStackRef container_st, _PyStackRef sub_st, _Py_CODEUNIT *instr)
+#ifdef Py_STATS
+static int
+store_subscr_fail_kind(PyObject *container, PyObject *sub)
 {
-    PyObject *container = PyStackRef_AsPyObjectBorrow(container_st);
-    PyObject *sub = PyStackRef_AsPyObjectBorrow(sub_st);
-
-    assert(ENABLE_SPECIALIZATION);
-    _PyStoreSubscrCache *cache = (_PyStoreSubscrCache *)(instr + 1);
     PyTypeObject *container_type = Py_TYPE(container);
-    if (container_type == &PyList_Type) {
-        if (PyLong_CheckExact(sub)) {
-            if (_PyLong_IsNonNegativeCompact((PyLongObject *)sub)
-                && ((PyLongObject *)sub)->long_value.ob_digit[0] < (size_t)PyList_GET_SIZE(container))
-            {
-                instr->op.code = STORE_SUBSCR_LIST_INT;
-                goto success;
-            }
-            else {
-                SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_OUT_OF_RANGE);
-                goto fail;
-            }
-        }
-        else if (PySlice_Check(sub)) {
-            SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_SUBSCR_LIST_SLICE);
-            goto fail;
-        }
-        else {
-            SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_OTHER);
-            goto fail;
-        }
-    }
-    if (container_type == &PyDict_Type) {
-        instr->op.code = STORE_SUBSCR_DICT;
-        goto success;
-    }
-#ifdef Py_STATS
     PyMappingMethods *as_mapping = container_type->tp_as_mapping;
     if (as_mapping && (as_mapping->mp_ass_subscript
                        == PyDict_Type.tp_as_mapping->mp_ass_subscript)) {
-        SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_SUBSCR_DICT_SUBCLASS_NO_OVERRIDE);
-        goto fail;
+        return SPEC_FAIL_SUBSCR_DICT_SUBCLASS_NO_OVERRIDE;
     }
     if (PyObject_CheckBuffer(container)) {
         if (PyLong_CheckExact(sub) && (!_PyLong_IsNonNegativeCompact((PyLongObject *)sub))) {
-            SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_OUT_OF_RANGE);
+            return SPEC_FAIL_OUT_OF_RANGE;
         }
         else if (strcmp(container_type->tp_name, "array.array") == 0) {
             if (PyLong_CheckExact(sub)) {
-                SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_SUBSCR_ARRAY_INT);
+                return SPEC_FAIL_SUBSCR_ARRAY_INT;
             }
             else if (PySlice_Check(sub)) {
-                SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_SUBSCR_ARRAY_SLICE);
+                return SPEC_FAIL_SUBSCR_ARRAY_SLICE;
             }
             else {
-                SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_OTHER);
+                return SPEC_FAIL_OTHER;
             }
         }
         else if (PyByteArray_CheckExact(container)) {
             if (PyLong_CheckExact(sub)) {
-                SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_SUBSCR_BYTEARRAY_INT);
+                return SPEC_FAIL_SUBSCR_BYTEARRAY_INT;
             }
             else if (PySlice_Check(sub)) {
-                SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_SUBSCR_BYTEARRAY_SLICE);
+                return SPEC_FAIL_SUBSCR_BYTEARRAY_SLICE;
             }
             else {
-                SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_OTHER);
+                return SPEC_FAIL_OTHER;
             }
         }
         else {
             if (PyLong_CheckExact(sub)) {
-                SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_SUBSCR_BUFFER_INT);
+                return SPEC_FAIL_SUBSCR_BUFFER_INT;
             }
             else if (PySlice_Check(sub)) {
-                SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_SUBSCR_BUFFER_SLICE);
+                return SPEC_FAIL_SUBSCR_BUFFER_SLICE;
             }
             else {
-                SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_OTHER);
+                return SPEC_FAIL_OTHER;
             }
         }
-        goto fail;
     }
     PyObject *descriptor = _PyType_Lookup(container_type, &_Py_ID(__setitem__));
     if (descriptor && Py_TYPE(descriptor) == &PyFunction_Type) {
@@ -1899,27 +2030,58 @@ _Py_Specialize_StoreSubscr(_PyStackRef container_st, _PyStackRef sub_st, _Py_COD
         PyCodeObject *code = (PyCodeObject *)func->func_code;
         int kind = function_kind(code);
         if (kind == SIMPLE_FUNCTION) {
-            SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_SUBSCR_PY_SIMPLE);
+            return SPEC_FAIL_SUBSCR_PY_SIMPLE;
         }
         else {
-            SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_SUBSCR_PY_OTHER);
+            return SPEC_FAIL_SUBSCR_PY_OTHER;
         }
-        goto fail;
     }
+    return SPEC_FAIL_OTHER;
+}
 #endif   // Py_STATS
-    SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_OTHER);
-fail:
-    STAT_INC(STORE_SUBSCR, failure);
-    assert(!PyErr_Occurred());
-    instr->op.code = STORE_SUBSCR;
-    cache->counter = adaptive_counter_backoff(cache->counter);
-    return;
-success:
-    STAT_INC(STORE_SUBSCR, success);
-    assert(!PyErr_Occurred());
-    cache->counter = adaptive_counter_cooldown();
+
+void
+_Py_Specialize_StoreSubscr(_PyStackRef container_st, _PyStackRef sub_st, _Py_CODEUNIT *instr)
+{
+    PyObject *container = PyStackRef_AsPyObjectBorrow(container_st);
+    PyObject *sub = PyStackRef_AsPyObjectBorrow(sub_st);
+
+    assert(ENABLE_SPECIALIZATION_FT);
+    PyTypeObject *container_type = Py_TYPE(container);
+    if (container_type == &PyList_Type) {
+        if (PyLong_CheckExact(sub)) {
+            if (_PyLong_IsNonNegativeCompact((PyLongObject *)sub)
+                && ((PyLongObject *)sub)->long_value.ob_digit[0] < (size_t)PyList_GET_SIZE(container))
+            {
+                specialize(instr, STORE_SUBSCR_LIST_INT);
+                return;
+            }
+            else {
+                unspecialize(instr, SPEC_FAIL_OUT_OF_RANGE);
+                return;
+            }
+        }
+        else if (PySlice_Check(sub)) {
+            unspecialize(instr, SPEC_FAIL_SUBSCR_LIST_SLICE);
+            return;
+        }
+        else {
+            unspecialize(instr, SPEC_FAIL_OTHER);
+            return;
+        }
+    }
+    if (container_type == &PyDict_Type) {
+        specialize(instr, STORE_SUBSCR_DICT);
+        return;
+    }
+#ifdef Py_STATS
+    unspecialize(instr, store_subscr_fail_kind(container, sub));
+#else
+    unspecialize(instr, SPEC_FAIL_OTHER);
+#endif
 }
 
+#ifndef Py_GIL_DISABLED
 /* Returns a borrowed reference.
  * The reference is only valid if guarded by a type version check.
  */
@@ -1953,8 +2115,9 @@ get_init_for_simple_managed_python_class(PyTypeObject *tp)
     ((PyHeapTypeObject *)tp)->_spec_cache.init = init;
     return (PyFunctionObject *)init;
 }
+#endif  // Py_GIL_DISABLED
 
-static int
+static void
 specialize_class_call(PyObject *callable, _Py_CODEUNIT *instr, int nargs)
 {
     assert(PyType_Check(callable));
@@ -1963,45 +2126,51 @@ specialize_class_call(PyObject *callable, _Py_CODEUNIT *instr, int nargs)
         int oparg = instr->op.arg;
         if (nargs == 1 && oparg == 1) {
             if (tp == &PyUnicode_Type) {
-                instr->op.code = CALL_STR_1;
-                return 0;
+                specialize(instr, CALL_STR_1);
+                return;
             }
             else if (tp == &PyType_Type) {
-                instr->op.code = CALL_TYPE_1;
-                return 0;
+                specialize(instr, CALL_TYPE_1);
+                return;
             }
             else if (tp == &PyTuple_Type) {
-                instr->op.code = CALL_TUPLE_1;
-                return 0;
+                specialize(instr, CALL_TUPLE_1);
+                return;
             }
         }
         if (tp->tp_vectorcall != NULL) {
-            instr->op.code = CALL_BUILTIN_CLASS;
-            return 0;
+            specialize(instr, CALL_BUILTIN_CLASS);
+            return;
         }
         goto generic;
     }
     if (Py_TYPE(tp) != &PyType_Type) {
         goto generic;
     }
+#ifndef Py_GIL_DISABLED
+    // CALL_ALLOC_AND_ENTER_INIT calls the __init__ cached on the type without
+    // holding a reference to it, which is not safe when another thread can
+    // replace it.
     if (tp->tp_new == PyBaseObject_Type.tp_new) {
         PyFunctionObject *init = get_init_for_simple_managed_python_class(tp);
-        if (type_get_version(tp, CALL) == 0) {
-            return -1;
+        uint32_t version = type_get_version(tp, CALL);
+        if (version == 0) {
+            unspecialize(instr, SPEC_FAIL_OUT_OF_VERSIONS);
+            return;
         }
         if (init != NULL) {
             _PyCallCache *cache = (_PyCallCache *)(instr + 1);
-            write_u32(cache->func_version, tp->tp_version_tag);
-            _Py_SET_OPCODE(*instr, CALL_ALLOC_AND_ENTER_INIT);
-            return 0;
+            write_u32(cache->func_version, version);
+            specialize(instr, CALL_ALLOC_AND_ENTER_INIT);
+            return;
         }
     }
+#endif
 generic:
-    instr->op.code = CALL_NON_PY_GENERAL;
-    return 0;
+    specialize(instr, CALL_NON_PY_GENERAL);
 }
 
-static int
+static void
 specialize_method_descriptor(PyMethodDescrObject *descr, _Py_CODEUNIT *instr,
                              int nargs)
 {
@@ -2010,16 +2179,16 @@ specialize_method_descriptor(PyMethodDescrObject *descr, _Py_CODEUNIT *instr,
         METH_KEYWORDS | METH_METHOD)) {
         case METH_NOARGS: {
             if (nargs != 1) {
-                SPECIALIZATION_FAIL(CALL, SPEC_FAIL_WRONG_NUMBER_ARGUMENTS);
-                return -1;
+                unspecialize(instr, SPEC_FAIL_WRONG_NUMBER_ARGUMENTS);
+                return;
             }
-            instr->op.code = CALL_METHOD_DESCRIPTOR_NOARGS;
-            return 0;
+            specialize(instr, CALL_METHOD_DESCRIPTOR_NOARGS);
+            return;
         }
         case METH_O: {
             if (nargs != 2) {
-                SPECIALIZATION_FAIL(CALL, SPEC_FAIL_WRONG_NUMBER_ARGUMENTS);
-                return -1;
+                unspecialize(instr, SPEC_FAIL_WRONG_NUMBER_ARGUMENTS);
+                return;
             }
             PyInterpreterState *interp = _PyInterpreterState_GET();
             PyObject *list_append = interp->callable_cache.list_append;
@@ -2027,26 +2196,25 @@ specialize_method_descriptor(PyMethodDescrObject *descr, _Py_CODEUNIT *instr,
             bool pop = (next.op.code == POP_TOP);
             int oparg = instr->op.arg;
             if ((PyObject *)descr == list_append && oparg == 1 && pop) {
-                instr->op.code = CALL_LIST_APPEND;
-                return 0;
+                specialize(instr, CALL_LIST_APPEND);
+                return;
             }
-            instr->op.code = CALL_METHOD_DESCRIPTOR_O;
-            return 0;
+            specialize(instr, CALL_METHOD_DESCRIPTOR_O);
+            return;
         }
         case METH_FASTCALL: {
-            instr->op.code = CALL_METHOD_DESCRIPTOR_FAST;
-            return 0;
+            specialize(instr, CALL_METHOD_DESCRIPTOR_FAST);
+            return;
         }
         case METH_FASTCALL | METH_KEYWORDS: {
-            instr->op.code = CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS;
-            return 0;
+            specialize(instr, CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS);
+            return;
         }
     }
-    instr->op.code = CALL_NON_PY_GENERAL;
-    return 0;
+    specialize(instr, CALL_NON_PY_GENERAL);
 }
 
-static int
+static void
 specialize_py_call(PyFunctionObject *func, _Py_CODEUNIT *instr, int nargs,
                    bool bound_method)
 {
@@ -2055,34 +2223,33 @@ specialize_py_call(PyFunctionObject *func, _Py_CODEUNIT *instr, int nargs,
     int kind = function_kind(code);
     /* Don't specialize if PEP 523 is active */
     if (_PyInterpreterState_GET()->eval_frame) {
-        SPECIALIZATION_FAIL(CALL, SPEC_FAIL_CALL_PEP_523);
-        return -1;
+        unspecialize(instr, SPEC_FAIL_CALL_PEP_523);
+        return;
     }
     int argcount = -1;
     if (kind == SPEC_FAIL_CODE_NOT_OPTIMIZED) {
-        SPECIALIZATION_FAIL(CALL, SPEC_FAIL_CODE_NOT_OPTIMIZED);
-        return -1;
+        unspecialize(instr, SPEC_FAIL_CODE_NOT_OPTIMIZED);
+        return;
     }
     if (kind == SIMPLE_FUNCTION) {
         argcount = code->co_argcount;
     }
     int version = _PyFunction_GetVersionForCurrentState(func);
     if (!_PyFunction_IsVersionValid(version)) {
-        SPECIALIZATION_FAIL(CALL, SPEC_FAIL_OUT_OF_VERSIONS);
-        return -1;
+        unspecialize(instr, SPEC_FAIL_OUT_OF_VERSIONS);
+        return;
     }
     write_u32(cache->func_version, version);
     if (argcount == nargs + bound_method) {
-        instr->op.code = bound_method ? CALL_BOUND_METHOD_EXACT_ARGS : CALL_PY_EXACT_ARGS;
+        specialize(instr, bound_method ? CALL_BOUND_METHOD_EXACT_ARGS : CALL_PY_EXACT_ARGS);
     }
     else {
-        instr->op.code = bound_method ? CALL_BOUND_METHOD_GENERAL : CALL_PY_GENERAL;
+        specialize(instr, bound_method ? CALL_BOUND_METHOD_GENERAL : CALL_PY_GENERAL);
     }
-    return 0;
 }
 
 
-static int
+static void
 specialize_py_call_kw(PyFunctionObject *func, _Py_CODEUNIT *instr, int nargs,
                    bool bound_method)
 {
@@ -2091,66 +2258,65 @@ specialize_py_call_kw(PyFunctionObject *func, _Py_CODEUNIT *instr, int nargs,
     int kind = function_kind(code);
     /* Don't specialize if PEP 523 is active */
     if (_PyInterpreterState_GET()->eval_frame) {
-        SPECIALIZATION_FAIL(CALL, SPEC_FAIL_CALL_PEP_523);
-        return -1;
+        unspecialize(instr, SPEC_FAIL_CALL_PEP_523);
+        return;
     }
     if (kind == SPEC_FAIL_CODE_NOT_OPTIMIZED) {
-        SPECIALIZATION_FAIL(CALL, SPEC_FAIL_CODE_NOT_OPTIMIZED);
-        return -1;
+        unspecialize(instr, SPEC_FAIL_CODE_NOT_OPTIMIZED);
+        return;
     }
     int version = _PyFunction_GetVersionForCurrentState(func);
     if (!_PyFunction_IsVersionValid(version)) {
-        SPECIALIZATION_FAIL(CALL, SPEC_FAIL_OUT_OF_VERSIONS);
-        return -1;
+        unspecialize(instr, SPEC_FAIL_OUT_OF_VERSIONS);
+        return;
     }
     write_u32(cache->func_version, version);
-    instr->op.code = bound_method ? CALL_KW_BOUND_METHOD : CALL_KW_PY;
-    return 0;
+    specialize(instr, bound_method ? CALL_KW_BOUND_METHOD : CALL_KW_PY);
 }
 
-static int
+static void
 specialize_c_call(PyObject *callable, _Py_CODEUNIT *instr, int nargs)
 {
     if (PyCFunction_GET_FUNCTION(callable) == NULL) {
-        SPECIALIZATION_FAIL(CALL, SPEC_FAIL_OTHER);
-        return 1;
+        unspecialize(instr, SPEC_FAIL_OTHER);
+        return;
     }
     switch (PyCFunction_GET_FLAGS(callable) &
         (METH_VARARGS | METH_FASTCALL | METH_NOARGS | METH_O |
         METH_KEYWORDS | METH_METHOD)) {
         case METH_O: {
             if (nargs != 1) {
-                SPECIALIZATION_FAIL(CALL, SPEC_FAIL_WRONG_NUMBER_ARGUMENTS);
-                return 1;
+                unspecialize(instr, SPEC_FAIL_WRONG_NUMBER_ARGUMENTS);
+                return;
             }
             /* len(o) */
             PyInterpreterState *interp = _PyInterpreterState_GET();
             if (callable == interp->callable_cache.len) {
-                instr->op.code = CALL_LEN;
-                return 0;
+                specialize(instr, CALL_LEN);
+                return;
             }
-            instr->op.code = CALL_BUILTIN_O;
-            return 0;
+            specialize(instr, CALL_BUILTIN_O);
+            return;
         }
         case METH_FASTCALL: {
             if (nargs == 2) {
                 /* isinstance(o1, o2) */
                 PyInterpreterState *interp = _PyInterpreterState_GET();
                 if (callable == interp->callable_cache.isinstance) {
-                    instr->op.code = CALL_ISINSTANCE;
-                    return 0;
+                    specialize(instr, CALL_ISINSTANCE);
+                    return;
                 }
             }
-            instr->op.code = CALL_BUILTIN_FAST;
-            return 0;
+            specialize(instr, CALL_BUILTIN_FAST);
+            return;
         }
         case METH_FASTCALL | METH_KEYWORDS: {
-            instr->op.code = CALL_BUILTIN_FAST_WITH_KEYWORDS;
-            return 0;
+            specialize(instr, CALL_BUILTIN_FAST_WITH_KEYWORDS);
+            return;
         }
         default:
-            instr->op.code = CALL_NON_PY_GENERAL;
-            return 0;
+            specialize(instr, CALL_NON_PY_GENERAL);
+            return;
     }
 }
 
@@ -2159,47 +2325,32 @@ _Py_Specialize_Call(_PyStackRef callable_st, _Py_CODEUNIT *instr, int nargs)
 {
     PyObject *callable = PyStackRef_AsPyObjectBorrow(callable_st);
 
-    assert(ENABLE_SPECIALIZATION);
+    assert(ENABLE_SPECIALIZATION_FT);
     assert(_PyOpcode_Caches[CALL] == INLINE_CACHE_ENTRIES_CALL);
     assert(_Py_OPCODE(*instr) != INSTRUMENTED_CALL);
-    _PyCallCache *cache = (_PyCallCache *)(instr + 1);
-    int fail;
     if (PyCFunction_CheckExact(callable)) {
-        fail = specialize_c_call(callable, instr, nargs);
+        specialize_c_call(callable, instr, nargs);
     }
     else if (PyFunction_Check(callable)) {
-        fail = specialize_py_call((PyFunctionObject *)callable, instr, nargs, false);
+        specialize_py_call((PyFunctionObject *)callable, instr, nargs, false);
     }
     else if (PyType_Check(callable)) {
-        fail = specialize_class_call(callable, instr, nargs);
+        specialize_class_call(callable, instr, nargs);
     }
     else if (Py_IS_TYPE(callable, &PyMethodDescr_Type)) {
-        fail = specialize_method_descriptor((PyMethodDescrObject *)callable, instr, nargs);
+        specialize_method_descriptor((PyMethodDescrObject *)callable, instr, nargs);
     }
     else if (PyMethod_Check(callable)) {
         PyObject *func = ((PyMethodObject *)callable)->im_func;
         if (PyFunction_Check(func)) {
-            fail = specialize_py_call((PyFunctionObject *)func, instr, nargs, true);
+            specialize_py_call((PyFunctionObject *)func, instr, nargs, true);
         }
         else {
-            SPECIALIZATION_FAIL(CALL, SPEC_FAIL_CALL_BOUND_METHOD);
-            fail = -1;
+            unspecialize(instr, SPEC_FAIL_CALL_BOUND_METHOD);
         }
     }
     else {
-        instr->op.code = CALL_NON_PY_GENERAL;
-        fail = 0;
-    }
-    if (fail) {
-        STAT_INC(CALL, failure);
-        assert(!PyErr_Occurred());
-        instr->op.code = CALL;
-        cache->counter = adaptive_counter_backoff(cache->counter);
-    }
-    else {
-        STAT_INC(CALL, success);
-        assert(!PyErr_Occurred());
-        cache->counter = adaptive_counter_cooldown();
+        specialize(instr, CALL_NON_PY_GENERAL);
     }
 }
 
@@ -2208,38 +2359,23 @@ _Py_Specialize_CallKw(_PyStackRef callable_st, _Py_CODEUNIT *instr, int nargs)
 {
     PyObject *callable = PyStackRef_AsPyObjectBorrow(callable_st);
 
-    assert(ENABLE_SPECIALIZATION);
+    assert(ENABLE_SPECIALIZATION_FT);
     assert(_PyOpcode_Caches[CALL_KW] == INLINE_CACHE_ENTRIES_CALL_KW);
     assert(_Py_OPCODE(*instr) != INSTRUMENTED_CALL_KW);
-    _PyCallCache *cache = (_PyCallCache *)(instr + 1);
-    int fail;
     if (PyFunction_Check(callable)) {
-        fail = specialize_py_call_kw((PyFunctionObject *)callable, instr, nargs, false);
+        specialize_py_call_kw((PyFunctionObject *)callable, instr, nargs, false);
     }
     else if (PyMethod_Check(callable)) {
         PyObject *func = ((PyMethodObject *)callable)->im_func;
         if (PyFunction_Check(func)) {
-            fail = specialize_py_call_kw((PyFunctionObject *)func, instr, nargs, true);
+            specialize_py_call_kw((PyFunctionObject *)func, instr, nargs, true);
         }
         else {
-            SPECIALIZATION_FAIL(CALL_KW, SPEC_FAIL_CALL_BOUND_METHOD);
-            fail = -1;
+            unspecialize(instr, SPEC_FAIL_CALL_BOUND_METHOD);
         }
     }
     else {
-        instr->op.code = CALL_KW_NON_PY;
-        fail = 0;
-    }
-    if (fail) {
-        STAT_INC(CALL, failure);
-        assert(!PyErr_Occurred());
-        instr->op.code = CALL_KW;
-        cache->counter = adaptive_counter_backoff(cache->counter);
-    }
-    else {
-        STAT_INC(CALL, success);
-        assert(!PyErr_Occurred());
-        cache->counter = adaptive_counter_cooldown();
+        specialize(instr, CALL_KW_NON_PY);
     }
 }
 
@@ -2419,49 +2555,48 @@ _Py_Specialize_CompareOp(_PyStackRef lhs_st, _PyStackRef rhs_st, _Py_CODEUNIT *i
     PyObject *lhs = PyStackRef_AsPyObjectBorrow(lhs_st);
     PyObject *rhs = PyStackRef_AsPyObjectBorrow(rhs_st);
 
-    assert(ENABLE_SPECIALIZATION);
+    assert(ENABLE_SPECIALIZATION_FT);
     assert(_PyOpcode_Caches[COMPARE_OP] == INLINE_CACHE_ENTRIES_COMPARE_OP);
     // All of these specializations compute boolean values, so they're all valid
     // regardless of the fifth-lowest oparg bit.
-    _PyCompareOpCache *cache = (_PyCompareOpCache *)(instr + 1);
     if (Py_TYPE(lhs) != Py_TYPE(rhs)) {
-        SPECIALIZATION_FAIL(COMPARE_OP, compare_op_fail_kind(lhs, rhs));
-        goto failure;
+#ifdef Py_STATS
+        unspecialize(instr, compare_op_fail_kind(lhs, rhs));
+#else
+        unspecialize(instr, SPEC_FAIL_OTHER);
+#endif
+        return;
     }
     if (PyFloat_CheckExact(lhs)) {
-        instr->op.code = COMPARE_OP_FLOAT;
-        goto success;
+        specialize(instr, COMPARE_OP_FLOAT);
+        return;
     }
     if (PyLong_CheckExact(lhs)) {
         if (_PyLong_IsCompact((PyLongObject *)lhs) && _PyLong_IsCompact((PyLongObject *)rhs)) {
-            instr->op.code = COMPARE_OP_INT;
-            goto success;
+            specialize(instr, COMPARE_OP_INT);
+            return;
         }
         else {
-            SPECIALIZATION_FAIL(COMPARE_OP, SPEC_FAIL_COMPARE_OP_BIG_INT);
-            goto failure;
+            unspecialize(instr, SPEC_FAIL_COMPARE_OP_BIG_INT);
+            return;
         }
     }
     if (PyUnicode_CheckExact(lhs)) {
         int cmp = oparg >> 5;
         if (cmp != Py_EQ && cmp != Py_NE) {
-            SPECIALIZATION_FAIL(COMPARE_OP, SPEC_FAIL_COMPARE_OP_STRING);
-            goto failure;
+            unspecialize(instr, SPEC_FAIL_COMPARE_OP_STRING);
+            return;
         }
         else {
-            instr->op.code = COMPARE_OP_STR;
-            goto success;
+            specialize(instr, COMPARE_OP_STR);
+            return;
         }
     }
-    SPECIALIZATION_FAIL(COMPARE_OP, compare_op_fail_kind(lhs, rhs));
-failure:
-    STAT_INC(COMPARE_OP, failure);
-    instr->op.code = COMPARE_OP;
-    cache->counter = adaptive_counter_backoff(cache->counter);
-    return;
-success:
-    STAT_INC(COMPARE_OP, success);
-    cache->counter = adaptive_counter_cooldown();
+#ifdef Py_STATS
+    unspecialize(instr, compare_op_fail_kind(lhs, rhs));
+#else
+    unspecialize(instr, SPEC_FAIL_OTHER);
+#endif
 }
 
 #ifdef Py_STATS
@@ -2483,42 +2618,36 @@ _Py_Specialize_UnpackSequence(_PyStackRef seq_st, _Py_CODEUNIT *instr, int oparg
 {
     PyObject *seq = PyStackRef_AsPyObjectBorrow(seq_st);
 
-    assert(ENABLE_SPECIALIZATION);
+    assert(ENABLE_SPECIALIZATION_FT);
     assert(_PyOpcode_Caches[UNPACK_SEQUENCE] ==
            INLINE_CACHE_ENTRIES_UNPACK_SEQUENCE);
-    _PyUnpackSequenceCache *cache = (_PyUnpackSequenceCache *)(instr + 1);
     if (PyTuple_CheckExact(seq)) {
         if (PyTuple_GET_SIZE(seq) != oparg) {
-            SPECIALIZATION_FAIL(UNPACK_SEQUENCE, SPEC_FAIL_EXPECTED_ERROR);
-            goto failure;
+            unspecialize(instr, SPEC_FAIL_EXPECTED_ERROR);
+            return;
         }
         if (PyTuple_GET_SIZE(seq) == 2) {
-            instr->op.code = UNPACK_SEQUENCE_TWO_TUPLE;
-            goto success;
+            specialize(instr, UNPACK_SEQUENCE_TWO_TUPLE);
+            return;
         }
-        instr->op.code = UNPACK_SEQUENCE_TUPLE;
-        goto success;
+        specialize(instr, UNPACK_SEQUENCE_TUPLE);
+        return;
     }
     if (PyList_CheckExact(seq)) {
         if (PyList_GET_SIZE(seq) != oparg) {
-            SPECIALIZATION_FAIL(UNPACK_SEQUENCE, SPEC_FAIL_EXPECTED_ERROR);
-            goto failure;
+            unspecialize(instr, SPEC_FAIL_EXPECTED_ERROR);
+            return;
         }
-        instr->op.code = UNPACK_SEQUENCE_LIST;
-        goto success;
+        specialize(instr, UNPACK_SEQUENCE_LIST);
+        return;
     }
-    SPECIALIZATION_FAIL(UNPACK_SEQUENCE, unpack_sequence_fail_kind(seq));
-failure:
-    STAT_INC(UNPACK_SEQUENCE, failure);
-    instr->op.code = UNPACK_SEQUENCE;
-    cache->counter = adaptive_counter_backoff(cache->counter);
-    return;
-success:
-    STAT_INC(UNPACK_SEQUENCE, success);
-    cache->counter = adaptive_counter_cooldown();
+#ifdef Py_STATS
+    unspecialize(instr, unpack_sequence_fail_kind(seq));
+#else
+    unspecialize(instr, SPEC_FAIL_OTHER);
+#endif
 }
 
-#ifdef Py_STATS
 int
  _PySpecialization_ClassifyIterator(PyObject *iter)
 {
@@ -2589,49 +2718,64 @@ int
     }
     return SPEC_FAIL_OTHER;
 }
-#endif   // Py_STATS
 
 void
 _Py_Specialize_ForIter(_PyStackRef iter, _Py_CODEUNIT *instr, int oparg)
 {
-    assert(ENABLE_SPECIALIZATION);
+    assert(ENABLE_SPECIALIZATION_FT);
     assert(_PyOpcode_Caches[FOR_ITER] == INLINE_CACHE_ENTRIES_FOR_ITER);
-    _PyForIterCache *cache = (_PyForIterCache *)(instr + 1);
     PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
     PyTypeObject *tp = Py_TYPE(iter_o);
+#ifdef Py_GIL_DISABLED
+    // The specialized instructions advance the iterator without locking it,
+    // so only specialize for iterators that no other thread can see. This
+    // still covers the common "for x in <expr>:" loop, where the iterator
+    // lives only on this frame's stack.
+    if (!_PyObject_IsUniquelyReferenced(iter_o)) {
+        unspecialize(instr, SPEC_FAIL_OTHER);
+        return;
+    }
+#endif
     if (tp == &PyListIter_Type) {
-        instr->op.code = FOR_ITER_LIST;
-        goto success;
+#ifdef Py_GIL_DISABLED
+        // The list itself may still be shared and resized by another thread.
+        _PyListIterObject *it = (_PyListIterObject *)iter_o;
+        if (it->it_seq == NULL ||
+            !_PyObject_IsUniquelyReferenced((PyObject *)it->it_seq))
+        {
+            unspecialize(instr, SPEC_FAIL_ITER_LIST);
+            return;
+        }
+#endif
+        specialize(instr, FOR_ITER_LIST);
+        return;
     }
     else if (tp == &PyTupleIter_Type) {
-        instr->op.code = FOR_ITER_TUPLE;
-        goto success;
+        specialize(instr, FOR_ITER_TUPLE);
+        return;
     }
     else if (tp == &PyRangeIter_Type) {
-        instr->op.code = FOR_ITER_RANGE;
-        goto success;
+        specialize(instr, FOR_ITER_RANGE);
+        return;
     }
     else if (tp == &PyGen_Type && oparg <= SHRT_MAX) {
         assert(instr[oparg + INLINE_CACHE_ENTRIES_FOR_ITER + 1].op.code == END_FOR  ||
             instr[oparg + INLINE_CACHE_ENTRIES_FOR_ITER + 1].op.code == INSTRUMENTED_END_FOR
         );
+#ifdef Py_GIL_DISABLED
+        // Generator frame state is not yet updated atomically
+        unspecialize(instr, SPEC_FAIL_ITER_GENERATOR);
+        return;
+#else
         if (_PyInterpreterState_GET()->eval_frame) {
-            SPECIALIZATION_FAIL(FOR_ITER, SPEC_FAIL_OTHER);
-            goto failure;
-        }
-        instr->op.code = FOR_ITER_GEN;
-        goto success;
-    }
-    SPECIALIZATION_FAIL(FOR_ITER,
-                        _PySpecialization_ClassifyIterator(iter_o));
-failure:
-    STAT_INC(FOR_ITER, failure);
-    instr->op.code = FOR_ITER;
-    cache->counter = adaptive_counter_backoff(cache->counter);
-    return;
-success:
-    STAT_INC(FOR_ITER, success);
-    cache->counter = adaptive_counter_cooldown();
+            unspecialize(instr, SPEC_FAIL_OTHER);
+            return;
+        }
+        specialize(instr, FOR_ITER_GEN);
+        return;
+#endif
+    }
+    unspecialize(instr, _PySpecialization_ClassifyIterator(iter_o));
 }
 
 void
@@ -2639,125 +2783,119 @@ _Py_Specialize_Send(_PyStackRef receiver_st, _Py_CODEUNIT *instr)
 {
     PyObject *receiver = PyStackRef_AsPyObjectBorrow(receiver_st);
 
-    assert(ENABLE_SPECIALIZATION);
+    assert(ENABLE_SPECIALIZATION_FT);
     assert(_PyOpcode_Caches[SEND] == INLINE_CACHE_ENTRIES_SEND);
-    _PySendCache *cache = (_PySendCache *)(instr + 1);
     PyTypeObject *tp = Py_TYPE(receiver);
     if (tp == &PyGen_Type || tp == &PyCoro_Type) {
+#ifdef Py_GIL_DISABLED
+        // Generator frame state is not yet updated atomically
+        unspecialize(instr, SPEC_FAIL_OTHER);
+        return;
+#else
         if (_PyInterpreterState_GET()->eval_frame) {
-            SPECIALIZATION_FAIL(SEND, SPEC_FAIL_OTHER);
-            goto failure;
-        }
-        instr->op.code = SEND_GEN;
-        goto success;
-    }
-    SPECIALIZATION_FAIL(SEND,
-                        _PySpecialization_ClassifyIterator(receiver));
-failure:
-    STAT_INC(SEND, failure);
-    instr->op.code = SEND;
-    cache->counter = adaptive_counter_backoff(cache->counter);
-    return;
-success:
-    STAT_INC(SEND, success);
-    cache->counter = adaptive_counter_cooldown();
+            unspecialize(instr, SPEC_FAIL_OTHER);
+            return;
+        }
+        specialize(instr, SEND_GEN);
+        return;
+#endif
+    }
+    unspecialize(instr, _PySpecialization_ClassifyIterator(receiver));
 }
 
+#ifdef Py_STATS
+static int
+to_bool_fail_kind(PyObject *value)
+{
+    if (PyByteArray_CheckExact(value)) {
+        return SPEC_FAIL_TO_BOOL_BYTEARRAY;
+    }
+    if (PyBytes_CheckExact(value)) {
+        return SPEC_FAIL_TO_BOOL_BYTES;
+    }
+    if (PyDict_CheckExact(value)) {
+        return SPEC_FAIL_TO_BOOL_DICT;
+    }
+    if (PyFloat_CheckExact(value)) {
+        return SPEC_FAIL_TO_BOOL_FLOAT;
+    }
+    if (PyMemoryView_Check(value)) {
+        return SPEC_FAIL_TO_BOOL_MEMORY_VIEW;
+    }
+    if (PyAnySet_CheckExact(value)) {
+        return SPEC_FAIL_TO_BOOL_SET;
+    }
+    if (PyTuple_CheckExact(value)) {
+        return SPEC_FAIL_TO_BOOL_TUPLE;
+    }
+    return SPEC_FAIL_OTHER;
+}
+#endif   // Py_STATS
+
 void
 _Py_Specialize_ToBool(_PyStackRef value_o, _Py_CODEUNIT *instr)
 {
-    assert(ENABLE_SPECIALIZATION);
+    assert(ENABLE_SPECIALIZATION_FT);
     assert(_PyOpcode_Caches[TO_BOOL] == INLINE_CACHE_ENTRIES_TO_BOOL);
     _PyToBoolCache *cache = (_PyToBoolCache *)(instr + 1);
     PyObject *value = PyStackRef_AsPyObjectBorrow(value_o);
     if (PyBool_Check(value)) {
-        instr->op.code = TO_BOOL_BOOL;
-        goto success;
+        specialize(instr, TO_BOOL_BOOL);
+        return;
     }
     if (PyLong_CheckExact(value)) {
-        instr->op.code = TO_BOOL_INT;
-        goto success;
+        specialize(instr, TO_BOOL_INT);
+        return;
     }
     if (PyList_CheckExact(value)) {
-        instr->op.code = TO_BOOL_LIST;
-        goto success;
+        specialize(instr, TO_BOOL_LIST);
+        return;
     }
     if (Py_IsNone(value)) {
-        instr->op.code = TO_BOOL_NONE;
-        goto success;
+        specialize(instr, TO_BOOL_NONE);
+        return;
     }
     if (PyUnicode_CheckExact(value)) {
-        instr->op.code = TO_BOOL_STR;
-        goto success;
+        specialize(instr, TO_BOOL_STR);
+        return;
     }
     if (PyType_HasFeature(Py_TYPE(value), Py_TPFLAGS_HEAPTYPE)) {
+        // Read the version before checking the slots: if the type is changed
+        // concurrently, the version we cache will no longer match.
+        if (!PyUnstable_Type_AssignVersionTag(Py_TYPE(value))) {
+            unspecialize(instr, SPEC_FAIL_OUT_OF_VERSIONS);
+            return;
+        }
+        uint32_t version = type_get_version(Py_TYPE(value), TO_BOOL);
+        if (version == 0) {
+            unspecialize(instr, SPEC_FAIL_OUT_OF_VERSIONS);
+            return;
+        }
         PyNumberMethods *nb = Py_TYPE(value)->tp_as_number;
         if (nb && nb->nb_bool) {
-            SPECIALIZATION_FAIL(TO_BOOL, SPEC_FAIL_TO_BOOL_NUMBER);
-            goto failure;
+            unspecialize(instr, SPEC_FAIL_TO_BOOL_NUMBER);
+            return;
         }
         PyMappingMethods *mp = Py_TYPE(value)->tp_as_mapping;
         if (mp && mp->mp_length) {
-            SPECIALIZATION_FAIL(TO_BOOL, SPEC_FAIL_TO_BOOL_MAPPING);
-            goto failure;
+            unspecialize(instr, SPEC_FAIL_TO_BOOL_MAPPING);
+            return;
         }
         PySequenceMethods *sq = Py_TYPE(value)->tp_as_sequence;
         if (sq && sq->sq_length) {
-            SPECIALIZATION_FAIL(TO_BOOL, SPEC_FAIL_TO_BOOL_SEQUENCE);
-            goto failure;
+            unspecialize(instr, SPEC_FAIL_TO_BOOL_SEQUENCE);
+            return;
         }
-        if (!PyUnstable_Type_AssignVersionTag(Py_TYPE(value))) {
-            SPECIALIZATION_FAIL(TO_BOOL, SPEC_FAIL_OUT_OF_VERSIONS);
-            goto failure;
-        }
-        uint32_t version = type_get_version(Py_TYPE(value), TO_BOOL);
-        if (version == 0) {
-            goto failure;
-        }
-        instr->op.code = TO_BOOL_ALWAYS_TRUE;
+        // The version must be in the cache before the opcode is published
         write_u32(cache->version, version);
-        assert(version);
-        goto success;
+        specialize(instr, TO_BOOL_ALWAYS_TRUE);
+        return;
     }
 #ifdef Py_STATS
-    if (PyByteArray_CheckExact(value)) {
-        SPECIALIZATION_FAIL(TO_BOOL, SPEC_FAIL_TO_BOOL_BYTEARRAY);
-        goto failure;
-    }
-    if (PyBytes_CheckExact(value)) {
-        SPECIALIZATION_FAIL(TO_BOOL, SPEC_FAIL_TO_BOOL_BYTES);
-        goto failure;
-    }
-    if (PyDict_CheckExact(value)) {
-        SPECIALIZATION_FAIL(TO_BOOL, SPEC_FAIL_TO_BOOL_DICT);
-        goto failure;
-    }
-    if (PyFloat_CheckExact(value)) {
-        SPECIALIZATION_FAIL(TO_BOOL, SPEC_FAIL_TO_BOOL_FLOAT);
-        goto failure;
-    }
-    if (PyMemoryView_Check(value)) {
-        SPECIALIZATION_FAIL(TO_BOOL, SPEC_FAIL_TO_BOOL_MEMORY_VIEW);
-        goto failure;
-    }
-    if (PyAnySet_CheckExact(value)) {
-        SPECIALIZATION_FAIL(TO_BOOL, SPEC_FAIL_TO_BOOL_SET);
-        goto failure;
-    }
-    if (PyTuple_CheckExact(value)) {
-        SPECIALIZATION_FAIL(TO_BOOL, SPEC_FAIL_TO_BOOL_TUPLE);
-        goto failure;
-    }
-    SPECIALIZATION_FAIL(TO_BOOL, SPEC_FAIL_OTHER);
-#endif   // Py_STATS
-failure:
-    STAT_INC(TO_BOOL, failure);
-    instr->op.code = TO_BOOL;
-    cache->counter = adaptive_counter_backoff(cache->counter);
-    return;
-success:
-    STAT_INC(TO_BOOL, success);
-    cache->counter = adaptive_counter_cooldown();
+    unspecialize(instr, to_bool_fail_kind(value));
+#else
+    unspecialize(instr, SPEC_FAIL_OTHER);
+#endif
 }
 
 static int
@@ -2797,6 +2935,198 @@ _Py_Specialize_ContainsOp(_PyStackRef value_st, _Py_CODEUNIT *instr)
     return;
 }
 
+/* Specialization profiles.
+ *
+ * A profile records, for each instruction that has an adaptive counter, the
+ * opcode it currently executes as (specialized or generic) and how far its
+ * counter has backed off:
+ *
+ *   (offset, opcode, backoff)
+ *
+ * offset is in bytes, as in the dis module. For generic instructions, backoff
+ * is the exponent of the counter's backoff, which grows each time
+ * specialization fails. It is 0 for specialized instructions.
+ *
+ * Applying a profile does not write specialized opcodes back: their inline
+ * caches hold type, function and dict keys versions that are only valid in
+ * the process that recorded them. Instead, the code is quickened again, and
+ * instructions that were specialized are primed to specialize the first time
+ * they run, while instructions that kept failing to specialize resume with
+ * the same backoff, so that they do not go through the failed attempts again.
+ */
+
+static int
+has_adaptive_counter(int opcode)
+{
+    switch (opcode) {
+        case JUMP_BACKWARD:
+        case POP_JUMP_IF_FALSE:
+        case POP_JUMP_IF_TRUE:
+        case POP_JUMP_IF_NONE:
+        case POP_JUMP_IF_NOT_NONE:
+            return 0;
+        default:
+            return _PyOpcode_Caches[opcode] != 0;
+    }
+}
+
+static int
+get_profile_opcode(PyCodeObject *co, int i)
+{
+    int opcode = FT_ATOMIC_LOAD_UINT8_RELAXED(_PyCode_CODE(co)[i].op.code);
+    if (opcode >= MIN_INSTRUMENTED_OPCODE) {
+        // Instrumented instructions are never specialized
+        opcode = _Py_GetBaseCodeUnit(co, i).op.code;
+    }
+    return opcode;
+}
+
+PyObject *
+_PyCode_GetSpecializationProfile(PyCodeObject *co)
+{
+    PyObject *profile = PyList_New(0);
+    if (profile == NULL) {
+        return NULL;
+    }
+#if ENABLE_SPECIALIZATION_FT
+    _Py_CODEUNIT *instructions = _PyCode_CODE(co);
+    int code_len = (int)Py_SIZE(co);
+    for (int i = 0; i < code_len; i += _PyInstruction_GetLength(co, i)) {
+        int opcode = get_profile_opcode(co, i);
+        int base_opcode = _PyOpcode_Deopt[opcode];
+        if (!has_adaptive_counter(base_opcode)) {
+            continue;
+        }
+        _Py_BackoffCounter counter = load_counter(&instructions[i + 1].counter);
+        if (is_unreachable_backoff_counter(counter)) {
+            continue;
+        }
+        int backoff = 0;
+        if (opcode == base_opcode) {
+            backoff = counter.value_and_backoff & ((1 << BACKOFF_BITS) - 1);
+        }
+        PyObject *site = Py_BuildValue("(iii)", i * (int)sizeof(_Py_CODEUNIT),
+                                       opcode, backoff);
+        if (site == NULL) {
+            goto error;
+        }
+        int err = PyList_Append(profile, site);
+        Py_DECREF(site);
+        if (err < 0) {
+            goto error;
+        }
+    }
+#endif  /* ENABLE_SPECIALIZATION_FT */
+    return profile;
+#if ENABLE_SPECIALIZATION_FT
+error:
+    Py_DECREF(profile);
+    return NULL;
+#endif
+}
+
+#if ENABLE_SPECIALIZATION_FT
+/* Called by _PyCode_Quicken() for a site whose index matches instr, after the
+ * counter of instr has been reset.  instr is not specialized. */
+static int
+apply_profile_site(_Py_CODEUNIT *instr, const _PyProfileSite *site)
+{
+    if (_PyOpcode_Deopt[site->opcode] != instr->op.code) {
+        // The profile was recorded against different bytecode
+        return 0;
+    }
+    if (site->opcode != instr->op.code) {
+        instr[1].counter = make_backoff_counter(0, ADAPTIVE_WARMUP_BACKOFF);
+    }
+    else if (site->backoff > ADAPTIVE_WARMUP_BACKOFF) {
+        int backoff = site->backoff;
+        instr[1].counter = make_backoff_counter((1 << backoff) - 1, backoff);
+    }
+    return 1;
+}
+
+static int
+compare_profile_sites(const void *a, const void *b)
+{
+    int ia = ((const _PyProfileSite *)a)->index;
+    int ib = ((const _PyProfileSite *)b)->index;
+    return (ia > ib) - (ia < ib);
+}
+#endif  /* ENABLE_SPECIALIZATION_FT */
+
+Py_ssize_t
+_PyCode_ApplySpecializationProfile(PyCodeObject *co, PyObject *profile)
+{
+    PyObject *seq = PySequence_Fast(profile, "profile must be a sequence");
+    if (seq == NULL) {
+        return -1;
+    }
+    Py_ssize_t n = PySequence_Fast_GET_SIZE(seq);
+    _PyProfileSite *sites = PyMem_New(_PyProfileSite, n);
+    if (sites == NULL) {
+        Py_DECREF(seq);
+        PyErr_NoMemory();
+        return -1;
+    }
+    Py_ssize_t nsites = 0;
+    for (Py_ssize_t k = 0; k < n; k++) {
+        PyObject *site = PySequence_Fast_GET_ITEM(seq, k);
+        int offset, opcode, backoff;
+        if (!PyTuple_Check(site)) {
+            PyErr_Format(PyExc_TypeError,
+                         "profile entries must be tuples, not '%.100s'",
+                         Py_TYPE(site)->tp_name);
+            goto error;
+        }
+        if (!PyArg_ParseTuple(site, "iii;profile entries must be "
+                              "(offset, opcode, backoff) tuples",
+                              &offset, &opcode, &backoff))
+        {
+            goto error;
+        }
+        if (offset < 0 || offset % (int)sizeof(_Py_CODEUNIT) != 0 ||
+            opcode < 0 || opcode >= MIN_INSTRUMENTED_OPCODE)
+        {
+            continue;
+        }
+        sites[nsites].index = offset / (int)sizeof(_Py_CODEUNIT);
+        sites[nsites].opcode = (uint8_t)opcode;
+        sites[nsites].backoff = (uint8_t)Py_MIN(Py_MAX(backoff, 0), MAX_BACKOFF);
+        nsites++;
+    }
+    Py_DECREF(seq);
+
+    Py_ssize_t applied = 0;
+#if ENABLE_SPECIALIZATION_FT
+    qsort(sites, nsites, sizeof(_PyProfileSite), compare_profile_sites);
+#ifdef Py_GIL_DISABLED
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    int enable_counters = interp->config.tlbc_enabled;
+    _PyEval_StopTheWorld(interp);
+#else
+    int enable_counters = 1;
+#endif
+    // Instrumented instructions and executors would have to be
+    // re-instrumented or invalidated; leave such code alone.
+    if (co->_co_monitoring == NULL &&
+        (co->co_executors == NULL || co->co_executors->size == 0))
+    {
+        applied = _PyCode_Quicken(_PyCode_CODE(co), Py_SIZE(co),
+                                  co->co_consts, enable_counters,
+                                  sites, nsites);
+    }
+#ifdef Py_GIL_DISABLED
+    _PyEval_StartTheWorld(interp);
+#endif
+#endif  /* ENABLE_SPECIALIZATION_FT */
+    PyMem_Free(sites);
+    return applied;
+error:
+    Py_DECREF(seq);
+    PyMem_Free(sites);
+    return -1;
+}
+
 /* Code init cleanup.
  * CALL_ALLOC_AND_ENTER_INIT will set up
  * the frame to execute the EXIT_INIT_CHECK
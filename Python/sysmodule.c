@@ -20,11 +20,13 @@ Data members:
 #include "pycore_ceval.h"         // _PyEval_SetAsyncGenFinalizer()
 #include "pycore_dict.h"          // _PyDict_GetItemWithError()
 #include "pycore_frame.h"         // _PyInterpreterFrame
+#include "pycore_freelist.h"      // _PyObject_GetFreeListStats()
 #include "pycore_initconfig.h"    // _PyStatus_EXCEPTION()
 #include "pycore_long.h"          // _PY_LONG_MAX_STR_DIGITS_THRESHOLD
 #include "pycore_modsupport.h"    // _PyModule_CreateInitialized()
 #include "pycore_namespace.h"     // _PyNamespace_New()
 #include "pycore_object.h"        // _PyObject_DebugTypeStats()
+#include "pycore_obmalloc.h"      // _PyObject_EnterRegion()
 #include "pycore_pathconfig.h"    // _PyPathConfig_ComputeSysPath0()
 #include "pycore_pyerrors.h"      // _PyErr_GetRaisedException()
 #include "pycore_pylifecycle.h"   // _PyErr_WriteUnraisableDefaultHook()
@@ -34,6 +36,7 @@ Data members:
 #include "pycore_pystats.h"       // _Py_PrintSpecializationStats()
 #include "pycore_structseq.h"     // _PyStructSequence_InitBuiltinWithFlags()
 #include "pycore_sysmodule.h"     // export _PySys_GetSizeOf()
+#include "pycore_time.h"          // _PyTime_FromSecondsDouble()
 #include "pycore_tuple.h"         // _PyTuple_FromArray()
 
 #include "pydtrace.h"             // PyDTrace_AUDIT()
@@ -1971,6 +1974,185 @@ sys_getallocatedblocks_impl(PyObject *module)
     return _Py_GetGlobalAllocatedBlocks();
 }
 
+/*[clinic input]
+sys._enter_allocation_region
+
+Start an allocation region.
+
+Until the matching _exit_allocation_region() call, small objects are
+bump-allocated from memory that is recycled in bulk once they are all
+freed.  Regions nest; only the outermost one has an effect.
+[clinic start generated code]*/
+
+static PyObject *
+sys__enter_allocation_region_impl(PyObject *module)
+/*[clinic end generated code: output=bfe077973bde2bbd input=8df17666c55e3bac]*/
+{
+    _PyObject_EnterRegion();
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+sys._exit_allocation_region
+
+End an allocation region.
+
+Return the number of memory blocks allocated in the outermost region
+that are still alive.  These objects escaped the region: their memory is
+released when the last of them is freed.
+[clinic start generated code]*/
+
+static PyObject *
+sys__exit_allocation_region_impl(PyObject *module)
+/*[clinic end generated code: output=311c899ab30b6c1d input=09ff8c527e06868e]*/
+{
+    Py_ssize_t escaped = _PyObject_ExitRegion();
+    if (escaped < 0) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "no allocation region is active");
+        return NULL;
+    }
+    return PyLong_FromSsize_t(escaped);
+}
+
+/*[clinic input]
+sys._purge_memory -> Py_ssize_t
+
+Return the free memory held by the allocator of this thread to the OS.
+
+Return the number of bytes released.
+[clinic start generated code]*/
+
+static Py_ssize_t
+sys__purge_memory_impl(PyObject *module)
+/*[clinic end generated code: output=fb017c6c2b06a09a input=c7edd613bc789508]*/
+{
+    return _PyMem_PurgeFreeMemory();
+}
+
+/*[clinic input]
+sys._start_memory_purger
+
+    interval: double = 1.0
+
+Return free memory to the OS every *interval* seconds.
+
+Every thread of the main interpreter purges the memory held by its
+allocator the next time it checks for pending events, so threads that
+are not running Python code purge when they resume.
+[clinic start generated code]*/
+
+static PyObject *
+sys__start_memory_purger_impl(PyObject *module, double interval)
+/*[clinic end generated code: output=bec2253898d525b2 input=1903893619b8858e]*/
+{
+    if (!(interval > 0.0)) {
+        PyErr_SetString(PyExc_ValueError,
+                        "purge interval must be strictly positive");
+        return NULL;
+    }
+    if (!_Py_IsMainInterpreter(_PyInterpreterState_GET())) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "the memory purger can only be started "
+                        "from the main interpreter");
+        return NULL;
+    }
+    PyTime_t ns;
+    if (_PyTime_FromSecondsDouble(interval, _PyTime_ROUND_CEILING, &ns) < 0) {
+        return NULL;
+    }
+    if (_PyMem_StartPurger(ns) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+sys._stop_memory_purger
+
+Stop the memory purger.
+
+If the memory purger is not running, this function has no effect.
+[clinic start generated code]*/
+
+static PyObject *
+sys__stop_memory_purger_impl(PyObject *module)
+/*[clinic end generated code: output=f344611f6e6b3b0b input=f2ac4322ed82f343]*/
+{
+    _PyMem_StopPurger();
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+sys._get_memory_purger_stats
+
+Return a dict describing the memory purger.
+
+"running" and "interval" describe the purger thread; "interval" is None
+when it is not running.  "purges" and
+"bytes_released" count all purges, including sys._purge_memory() calls.
+[clinic start generated code]*/
+
+static PyObject *
+sys__get_memory_purger_stats_impl(PyObject *module)
+/*[clinic end generated code: output=2b64c0ec6fe746bb input=0612b36bdd0b59e4]*/
+{
+    struct _pymem_allocators *allocators = &_PyRuntime.allocators;
+    PyMutex_Lock(&allocators->purger.control);
+    int running = allocators->purger.active;
+    double interval = PyTime_AsSecondsDouble(allocators->purger.interval);
+    PyMutex_Unlock(&allocators->purger.control);
+    return Py_BuildValue(
+        "{sOsNsnsn}",
+        "running", running ? Py_True : Py_False,
+        "interval", running ? PyFloat_FromDouble(interval) : Py_NewRef(Py_None),
+        "purges", _Py_atomic_load_ssize(&allocators->purger.purges),
+        "bytes_released",
+        _Py_atomic_load_ssize(&allocators->purger.bytes_released));
+}
+
+/*[clinic input]
+sys._get_freelist_stats
+
+Return a dict describing the freelists of the current interpreter.
+
+Each kind of freelist maps to a dict with its "limit", its current "size",
+and the number of allocations served by the freelist ("hits") or not
+("misses"), and of deallocations that found it full ("overflows").  Kinds
+made of several freelists, like "tuples" with one per size, report their
+totals.
+[clinic start generated code]*/
+
+static PyObject *
+sys__get_freelist_stats_impl(PyObject *module)
+/*[clinic end generated code: output=036245206e9cc002 input=9a43dfbe9a92fd99]*/
+{
+    return _PyObject_GetFreeListStats(_PyInterpreterState_GET());
+}
+
+/*[clinic input]
+sys._set_freelist_limit
+
+    name: str
+    limit: Py_ssize_t
+    /
+
+Set the maximum number of items of the freelists of the given kind.
+
+Items beyond the new limit are freed.  A limit of 0 disables the freelist.
+[clinic start generated code]*/
+
+static PyObject *
+sys__set_freelist_limit_impl(PyObject *module, const char *name,
+                             Py_ssize_t limit)
+/*[clinic end generated code: output=86350063d46d98e7 input=41227d06b1cf1768]*/
+{
+    if (_PyObject_SetFreeListLimit(_PyInterpreterState_GET(), name, limit) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
 /*[clinic input]
 sys.getunicodeinternedsize -> Py_ssize_t
 
@@ -2345,6 +2527,85 @@ sys_is_stack_trampoline_active_impl(PyObject *module)
 }
 
 
+/*[clinic input]
+sys._start_sampling_profiler
+
+    interval: double = 0.001
+
+Start sampling the stacks of running threads every *interval* seconds.
+
+Samples are taken when the sampled thread next checks for pending events,
+so only threads that are running Python code are sampled.  Use
+sys._dump_sampling_profile() to retrieve the samples.
+[clinic start generated code]*/
+
+static PyObject *
+sys__start_sampling_profiler_impl(PyObject *module, double interval)
+/*[clinic end generated code: output=ef263a210cde4c8b input=549dab9b1990c285]*/
+{
+    if (!(interval > 0.0)) {
+        PyErr_SetString(PyExc_ValueError,
+                        "sampling interval must be strictly positive");
+        return NULL;
+    }
+    if (!_Py_IsMainInterpreter(_PyInterpreterState_GET())) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "the sampling profiler can only be started "
+                        "from the main interpreter");
+        return NULL;
+    }
+    PyTime_t ns;
+    if (_PyTime_FromSecondsDouble(interval, _PyTime_ROUND_CEILING, &ns) < 0) {
+        return NULL;
+    }
+    if (_PySamplingProfiler_Start(ns) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+
+/*[clinic input]
+sys._stop_sampling_profiler
+
+Stop the sampling profiler.
+
+The samples taken so far are kept until they are dumped.  If the
+sampling profiler is not running, this function has no effect.
+[clinic start generated code]*/
+
+static PyObject *
+sys__stop_sampling_profiler_impl(PyObject *module)
+/*[clinic end generated code: output=054eb817ceb9c6ad input=dfe4c7f862c774b9]*/
+{
+    if (_PySamplingProfiler_Stop() < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+
+/*[clinic input]
+sys._dump_sampling_profile
+
+    clear: bool = True
+
+Return the samples taken by the sampling profiler as folded stacks.
+
+The result maps each stack, formatted as semicolon-separated
+"function (filename:lineno)" frames with the outermost frame first,
+to the number of times it was sampled.  If *clear* is true, the
+samples are discarded.
+[clinic start generated code]*/
+
+static PyObject *
+sys__dump_sampling_profile_impl(PyObject *module, int clear)
+/*[clinic end generated code: output=55f45d504d10e54b input=362bd73e36195852]*/
+{
+    return _PySamplingProfiler_Dump(clear);
+}
+
+
 /*[clinic input]
 sys._getframemodulename
 
@@ -2551,6 +2812,14 @@ static PyMethodDef sys_methods[] = {
     SYS_GETDEFAULTENCODING_METHODDEF
     SYS_GETDLOPENFLAGS_METHODDEF
     SYS_GETALLOCATEDBLOCKS_METHODDEF
+    SYS__ENTER_ALLOCATION_REGION_METHODDEF
+    SYS__EXIT_ALLOCATION_REGION_METHODDEF
+    SYS__PURGE_MEMORY_METHODDEF
+    SYS__START_MEMORY_PURGER_METHODDEF
+    SYS__STOP_MEMORY_PURGER_METHODDEF
+    SYS__GET_MEMORY_PURGER_STATS_METHODDEF
+    SYS__GET_FREELIST_STATS_METHODDEF
+    SYS__SET_FREELIST_LIMIT_METHODDEF
     SYS_GETUNICODEINTERNEDSIZE_METHODDEF
     SYS_GETFILESYSTEMENCODING_METHODDEF
     SYS_GETFILESYSTEMENCODEERRORS_METHODDEF
@@ -2591,6 +2860,9 @@ static PyMethodDef sys_methods[] = {
     SYS_ACTIVATE_STACK_TRAMPOLINE_METHODDEF
     SYS_DEACTIVATE_STACK_TRAMPOLINE_METHODDEF
     SYS_IS_STACK_TRAMPOLINE_ACTIVE_METHODDEF
+    SYS__START_SAMPLING_PROFILER_METHODDEF
+    SYS__STOP_SAMPLING_PROFILER_METHODDEF
+    SYS__DUMP_SAMPLING_PROFILE_METHODDEF
     SYS_UNRAISABLEHOOK_METHODDEF
     SYS_GET_INT_MAX_STR_DIGITS_METHODDEF
     SYS_SET_INT_MAX_STR_DIGITS_METHODDEF
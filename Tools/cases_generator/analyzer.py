@@ -175,6 +175,8 @@ class Uop:
     replicates: "Uop | None" = None
     # Size of the instruction(s), only set for uops containing the INSTRUCTION_SIZE macro
     instruction_size: int | None = None
+    # The uops this one is made of, only set for uops defined with fused()
+    fused: list["Uop"] = field(default_factory=list)
 
     def dump(self, indent: str) -> None:
         print(
@@ -283,12 +285,19 @@ def dump(self, indent: str) -> None:
         print(indent, self.name, "= ", ", ".join([m.name for m in self.members]))
 
 
+@dataclass
+class Label:
+    name: str
+    body: list[lexer.Token]
+
+
 @dataclass
 class Analysis:
     instructions: dict[str, Instruction]
     uops: dict[str, Uop]
     families: dict[str, Family]
     pseudos: dict[str, PseudoInstruction]
+    labels: dict[str, Label]
     opmap: dict[str, int]
     have_arg: int
     min_instrumented: int
@@ -578,6 +587,7 @@ def has_error_without_pop(op: parser.InstDef) -> bool:
     "_PyErr_Occurred",
     "_PyEval_FrameClearAndPop",
     "_PyFloat_FromDouble_ConsumeInputs",
+    "_PyFloat_StoreDouble_ConsumeInputs",
     "_PyFrame_GetCode",
     "_PyFrame_IsIncomplete",
     "_PyFrame_PushUnchecked",
@@ -603,6 +613,7 @@ def has_error_without_pop(op: parser.InstDef) -> bool:
     "_PyObject_GC_TRACK",
     "_PyObject_GetManagedDict",
     "_PyObject_InlineValues",
+    "_PyObject_IsUniquelyReferenced",
     "_PyObject_ManagedDictPointer",
     "_PyThreadState_HasStackSpace",
     "_PyTuple_FromArraySteal",
@@ -623,6 +634,7 @@ def has_error_without_pop(op: parser.InstDef) -> bool:
     "_Py_NewRef",
     "_Py_SINGLETON",
     "_Py_STR",
+    "_Py_TryIncrefCompareStackRef",
     "_Py_atomic_load_uintptr_relaxed",
     "_Py_set_eval_breaker_bit",
     "advance_backoff_counter",
@@ -997,6 +1009,67 @@ def add_pseudo(
     )
 
 
+def add_fused(fused: parser.Fused, uops: dict[str, Uop]) -> None:
+    tkn = fused.tokens[0]
+    if fused.name in uops:
+        raise analysis_error(f"Duplicate uop {fused.name}", tkn)
+    if len(fused.uops) != 2:
+        raise analysis_error("A fused uop must have exactly two parts", tkn)
+    parts: list[Uop] = []
+    for name in fused.uops:
+        if name not in uops:
+            raise analysis_error(f"No Uop named {name}", tkn)
+        parts.append(uops[name])
+    guard, op = parts
+    if guard.fused or op.fused:
+        raise analysis_error("Cannot fuse a fused uop", tkn)
+    if not guard.is_viable() or not op.is_viable():
+        raise analysis_error("Cannot fuse a uop that is not viable in tier 2", tkn)
+    # The guard runs first, so it must leave the stack exactly as it found
+    # it; that lets the fused uop share the stack effect of the second part
+    # and keep the operands in locals between the two.
+    peeks = all(
+        var.peek for var in guard.stack.inputs + guard.stack.outputs
+    )
+    if not peeks or len(guard.stack.inputs) > len(op.stack.inputs):
+        raise analysis_error(
+            f"{guard.name} must only peek at the inputs of {op.name}", tkn
+        )
+    if guard.properties.escapes or not guard.properties.infallible:
+        raise analysis_error(f"{guard.name} must not escape or fail", tkn)
+    if guard.properties.oparg or guard.properties.const_oparg >= 0:
+        raise analysis_error(f"{guard.name} must not use oparg", tkn)
+    if any(cache.name != "unused" for cache in guard.caches):
+        raise analysis_error(f"{guard.name} must not use the operand", tkn)
+    if (op.properties.deopts or op.properties.side_exit) and (
+        guard.properties.deopts or guard.properties.side_exit
+    ):
+        raise analysis_error("Only one part of a fused uop may exit", tkn)
+    properties = Properties.from_list([guard.properties, op.properties])
+    properties.tier = 2
+    uops[fused.name] = Uop(
+        name=fused.name,
+        context=fused.context,
+        annotations=[],
+        stack=op.stack,
+        caches=op.caches,
+        deferred_refs={},
+        output_stores=[],
+        body=[],
+        properties=properties,
+        fused=parts,
+    )
+
+
+def add_label(
+    label: parser.LabelDef,
+    labels: dict[str, Label],
+) -> None:
+    if label.name in labels:
+        raise analysis_error(f"Duplicate label {label.name}", label.first_token)
+    labels[label.name] = Label(label.name, label.block.tokens)
+
+
 def assign_opcodes(
     instructions: dict[str, Instruction],
     families: dict[str, Family],
@@ -1115,6 +1188,7 @@ def analyze_forest(forest: list[parser.AstNode]) -> Analysis:
     uops: dict[str, Uop] = {}
     families: dict[str, Family] = {}
     pseudos: dict[str, PseudoInstruction] = {}
+    labels: dict[str, Label] = {}
     for node in forest:
         match node:
             case parser.InstDef(name):
@@ -1123,17 +1197,24 @@ def analyze_forest(forest: list[parser.AstNode]) -> Analysis:
                 else:
                     assert node.kind == "op"
                     add_op(node, uops)
+            case parser.LabelDef():
+                add_label(node, labels)
             case parser.Macro():
                 pass
             case parser.Family():
                 pass
             case parser.Pseudo():
                 pass
+            case parser.Fused():
+                pass
             case _:
                 assert False
     for node in forest:
         if isinstance(node, parser.Macro):
             add_macro(node, instructions, uops)
+    for node in forest:
+        if isinstance(node, parser.Fused):
+            add_fused(node, uops)
     for node in forest:
         match node:
             case parser.Family():
@@ -1165,7 +1246,7 @@ def analyze_forest(forest: list[parser.AstNode]) -> Analysis:
         families["BINARY_OP"].members.append(inst)
     opmap, first_arg, min_instrumented = assign_opcodes(instructions, families, pseudos)
     return Analysis(
-        instructions, uops, families, pseudos, opmap, first_arg, min_instrumented
+        instructions, uops, families, pseudos, labels, opmap, first_arg, min_instrumented
     )
 
 
@@ -191,19 +191,19 @@ def error_if(
         except ValueError:
             offset = -1
         if offset > 0:
-            self.out.emit(f"goto pop_{offset}_")
+            self.out.emit(f"JUMP_TO_LABEL(pop_{offset}_")
             self.out.emit(label)
-            self.out.emit(";\n")
+            self.out.emit(");\n")
         elif offset == 0:
-            self.out.emit("goto ")
+            self.out.emit("JUMP_TO_LABEL(")
             self.out.emit(label)
-            self.out.emit(";\n")
+            self.out.emit(");\n")
         else:
             self.out.emit("{\n")
             storage.copy().flush(self.out)
-            self.out.emit("goto ")
+            self.out.emit("JUMP_TO_LABEL(")
             self.out.emit(label)
-            self.out.emit(";\n")
+            self.out.emit(");\n")
             self.out.emit("}\n")
         return not unconditional
 
@@ -218,9 +218,17 @@ def error_no_pop(
         next(tkn_iter)  # LPAREN
         next(tkn_iter)  # RPAREN
         next(tkn_iter)  # Semi colon
-        self.out.emit_at("goto error;", tkn)
+        self.out.emit_at("JUMP_TO_LABEL(error);", tkn)
         return False
 
+    def goto_label(self, goto: Token, label: Token) -> None:
+        """Replace `goto label;` with a jump that works in both the computed
+        goto and the tail-calling interpreter."""
+        self.out.emit_at("JUMP_TO_LABEL", goto)
+        self.out.emit("(")
+        self.out.emit(label.text)
+        self.out.emit(")")
+
     def decref_inputs(
         self,
         tkn: Token,
@@ -489,8 +497,9 @@ def _emit_block(
                         return reachable, tkn, storage
                     self.out.emit(tkn)
                 elif tkn.kind == "GOTO":
-                    reachable = False;
-                    self.out.emit(tkn)
+                    label_tkn = next(tkn_iter)
+                    self.goto_label(tkn, label_tkn)
+                    reachable = False
                 elif tkn.kind == "IDENTIFIER":
                     if tkn.text in self._replacers:
                         if not self._replacers[tkn.text](tkn, tkn_iter, uop, storage, inst):
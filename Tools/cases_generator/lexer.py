@@ -213,6 +213,9 @@ def choice(*opts: str) -> str:
 # A macro in the DSL
 MACRO = "MACRO"
 kwds.append(MACRO)
+# A label in the DSL
+LABEL = "LABEL"
+kwds.append(LABEL)
 keywords = {name.lower(): name for name in kwds}
 
 ANNOTATION = "ANNOTATION"
@@ -112,6 +112,12 @@ def emit_save(self, storage: Storage) -> None:
     def emit_reload(self, storage: Storage) -> None:
         pass
 
+    def goto_label(self, goto: Token, label: Token) -> None:
+        # The abstract interpreter is not a tier 1 function,
+        # so keep plain gotos to its own labels.
+        self.out.emit(goto)
+        self.out.emit(label)
+
 
 def write_uop(
     override: Uop | None,
@@ -190,6 +196,9 @@ def generate_abstract_interpreter(
             continue
         if uop.is_super():
             continue
+        if uop.fused:
+            # Fused uops are only formed when the trace is compiled
+            continue
         if not uop.is_viable():
             out.emit(f"/* {uop.name} is not a viable micro-op for tier 2 */\n\n")
             continue
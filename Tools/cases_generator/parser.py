@@ -1,8 +1,10 @@
 from parsing import (  # noqa: F401
     InstDef,
+    LabelDef,
     Macro,
     Pseudo,
     Family,
+    Fused,
     Parser,
     Context,
     CacheEffect,
@@ -128,6 +128,12 @@ class InstDef(Node):
     block: Block
 
 
+@dataclass
+class LabelDef(Node):
+    name: str
+    block: Block
+
+
 @dataclass
 class Macro(Node):
     name: str
@@ -151,7 +157,13 @@ class Pseudo(Node):
     as_sequence: bool
 
 
-AstNode = InstDef | Macro | Pseudo | Family
+@dataclass
+class Fused(Node):
+    name: str
+    uops: list[str]  # the micro-ops fused into one, in execution order
+
+
+AstNode = InstDef | Macro | Pseudo | Family | LabelDef | Fused
 
 
 class Parser(PLexer):
@@ -163,8 +175,12 @@ def definition(self) -> AstNode | None:
             return family
         if pseudo := self.pseudo_def():
             return pseudo
+        if fused := self.fused_def():
+            return fused
         if inst := self.inst_def():
             return inst
+        if label := self.label_def():
+            return label
         return None
 
     @contextual
@@ -182,6 +198,18 @@ def inst_def(self) -> InstDef | None:
             raise self.make_syntax_error("Expected block")
         return None
 
+    @contextual
+    def label_def(self) -> LabelDef | None:
+        # label(NAME) block
+        if self.expect(lx.LABEL):
+            if self.expect(lx.LPAREN):
+                if tkn := self.expect(lx.IDENTIFIER):
+                    if self.expect(lx.RPAREN):
+                        if block := self.block():
+                            return LabelDef(tkn.text, block)
+                        raise self.make_syntax_error("Expected block")
+        return None
+
     @contextual
     def inst_header(self) -> InstHeader | None:
         # annotation* inst(NAME, (inputs -- outputs))
@@ -439,6 +467,25 @@ def pseudo_def(self) -> Pseudo | None:
                                         )
         return None
 
+    @contextual
+    def fused_def(self) -> Fused | None:
+        # fused(NAME) = OP + OP ... ;
+        if (tkn := self.expect(lx.IDENTIFIER)) and tkn.text == "fused":
+            if self.expect(lx.LPAREN):
+                if tkn := self.expect(lx.IDENTIFIER):
+                    if self.expect(lx.RPAREN):
+                        if self.expect(lx.EQUALS):
+                            uops = []
+                            while op := self.expect(lx.IDENTIFIER):
+                                uops.append(op.text)
+                                if not self.expect(lx.PLUS):
+                                    break
+                            else:
+                                raise self.make_syntax_error("Expected op name")
+                            self.require(lx.SEMI)
+                            return Fused(tkn.text, uops)
+        return None
+
     def members(self, allow_sequence : bool=False) -> list[str] | None:
         here = self.getpos()
         if tkn := self.expect(lx.IDENTIFIER):
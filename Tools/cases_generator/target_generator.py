@@ -1,6 +1,6 @@
-"""Generate targets for computed goto dispatch
+"""Generate targets for computed goto and tail-call dispatch
 Reads the instruction definitions from bytecodes.c.
-Writes the table to opcode_targets.h by default.
+Writes the tables to opcode_targets.h by default.
 """
 
 import argparse
@@ -21,14 +21,41 @@
 
 def write_opcode_targets(analysis: Analysis, out: CWriter) -> None:
     """Write header file that defines the jump target table"""
-    targets = ["&&_unknown_opcode,\n"] * 256
+    targets = ["&&unknown_opcode,\n"] * 256
     for name, op in analysis.opmap.items():
         if op < 256:
             targets[op] = f"&&TARGET_{name},\n"
+    out.emit("#if !Py_TAIL_CALL_INTERP\n")
     out.emit("static void *opcode_targets[256] = {\n")
     for target in targets:
         out.emit(target)
     out.emit("};\n")
+    out.emit("#else /* Py_TAIL_CALL_INTERP */\n")
+    write_tail_call_table(analysis, out)
+    out.emit("#endif /* Py_TAIL_CALL_INTERP */\n")
+
+
+def function_proto(name: str) -> str:
+    return f"Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_{name}(TAIL_CALL_PARAMS)"
+
+
+def write_tail_call_table(analysis: Analysis, out: CWriter) -> None:
+    """Write the forward declarations of the instruction and label functions
+    of the tail-calling interpreter, and the table used to dispatch to them"""
+    for name in analysis.labels:
+        out.emit(f"{function_proto(name)};\n")
+    out.emit("\n")
+    for name in sorted(analysis.instructions):
+        out.emit(f"{function_proto(name)};\n")
+    out.emit("\n")
+    targets = ["_TAIL_CALL_unknown_opcode,\n"] * 256
+    for name, op in analysis.opmap.items():
+        if op < 256:
+            targets[op] = f"_TAIL_CALL_{name},\n"
+    out.emit("static const py_tail_call_funcptr INSTRUCTION_TABLE[256] = {\n")
+    for target in targets:
+        out.emit(target)
+    out.emit("};\n")
 
 
 arg_parser = argparse.ArgumentParser(
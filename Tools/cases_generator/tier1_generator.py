@@ -182,9 +182,31 @@ def generate_tier1(
         out.start_line()
         out.emit("}")
         out.emit("\n")
+    generate_tier1_labels(analysis, emitter)
     outfile.write(FOOTER)
 
 
+def generate_tier1_labels(analysis: Analysis, emitter: Emitter) -> None:
+    """Emit the labels shared by all instructions (error handling, frame
+    entry and exit). With computed gotos these are plain C labels; in the
+    tail-calling interpreter each one becomes a function of its own."""
+    if not analysis.labels:
+        return
+    out = emitter.out
+    out.emit("\n")
+    out.emit("/* END INSTRUCTIONS */\n")
+    for name, label in analysis.labels.items():
+        out.emit("\n")
+        out.emit(f"LABEL({name})\n")
+        tkn_iter = iter(label.body)
+        for tkn in tkn_iter:
+            if tkn.kind == "GOTO":
+                emitter.goto_label(tkn, next(tkn_iter))
+            else:
+                out.emit(tkn)
+        out.start_line()
+
+
 arg_parser = argparse.ArgumentParser(
     description="Generate the code for the interpreter switch.",
     formatter_class=argparse.ArgumentDefaultsHelpFormatter,
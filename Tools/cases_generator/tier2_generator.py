@@ -50,17 +50,20 @@ def declare_variable(
 
 
 def declare_variables(uop: Uop, out: CWriter) -> None:
+    parts = uop.fused or [uop]
     stack = Stack()
-    for var in reversed(uop.stack.inputs):
-        stack.pop(var)
-    for var in uop.stack.outputs:
-        stack.push(Local.undefined(var))
+    for part in parts:
+        for var in reversed(part.stack.inputs):
+            stack.pop(var)
+        for var in part.stack.outputs:
+            stack.push(Local.undefined(var))
     required = set(stack.defined)
     required.discard("unused")
-    for var in reversed(uop.stack.inputs):
-        declare_variable(var, uop, required, out)
-    for var in uop.stack.outputs:
-        declare_variable(var, uop, required, out)
+    for part in parts:
+        for var in reversed(part.stack.inputs):
+            declare_variable(var, part, required, out)
+        for var in part.stack.outputs:
+            declare_variable(var, part, required, out)
 
 
 class Tier2Emitter(Emitter):
@@ -229,7 +232,19 @@ def generate_tier2(
         out.emit(f"case {uop.name}: {{\n")
         declare_variables(uop, out)
         stack = Stack()
-        stack = write_uop(uop, emitter, stack)
+        if uop.fused:
+            # The parts share one stack, so values produced or peeked by
+            # one part stay in locals for the next and are only spilled
+            # when the fused uop flushes or exits.
+            for part in uop.fused:
+                out.start_line()
+                out.emit(f"// {part.name}\n")
+                out.emit("{\n")
+                stack = write_uop(part, emitter, stack)
+                out.start_line()
+                out.emit("}\n")
+        else:
+            stack = write_uop(uop, emitter, stack)
         out.start_line()
         if not uop.properties.always_exits:
             stack.flush(out)
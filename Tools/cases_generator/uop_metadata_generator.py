@@ -7,6 +7,7 @@
 
 from analyzer import (
     Analysis,
+    Uop,
     analyze_files,
 )
 from generators_common import (
@@ -15,7 +16,7 @@
     write_header,
     cflags,
 )
-from stack import Stack
+from stack import Stack, StackOffset
 from cwriter import CWriter
 from typing import TextIO
 
@@ -26,7 +27,9 @@ def generate_names_and_flags(analysis: Analysis, out: CWriter) -> None:
     out.emit("extern const uint16_t _PyUop_Flags[MAX_UOP_ID+1];\n")
     out.emit("extern const uint8_t _PyUop_Replication[MAX_UOP_ID+1];\n")
     out.emit("extern const char * const _PyOpcode_uop_name[MAX_UOP_ID+1];\n\n")
-    out.emit("extern int _PyUop_num_popped(int opcode, int oparg);\n\n")
+    out.emit("extern int _PyUop_num_popped(int opcode, int oparg);\n")
+    out.emit("extern int _PyUop_num_pushed(int opcode, int oparg);\n")
+    out.emit("extern int _PyUop_Fuse(int first, int second);\n\n")
     out.emit("#ifdef NEED_OPCODE_METADATA\n")
     out.emit("const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {\n")
     for uop in analysis.uops.values():
@@ -61,9 +64,44 @@ def generate_names_and_flags(analysis: Analysis, out: CWriter) -> None:
     out.emit("    return -1;\n")
     out.emit("}\n")
     out.emit("}\n\n")
+    out.emit("int _PyUop_num_pushed(int opcode, int oparg)\n{\n")
+    out.emit("switch(opcode) {\n")
+    for uop in analysis.uops.values():
+        if uop.is_viable() and uop.properties.tier != 1:
+            offset = StackOffset.empty()
+            for var in uop.stack.outputs:
+                if not var.peek:
+                    offset.push(var)
+            out.emit(f"case {uop.name}:\n")
+            out.emit(f"    return {offset.to_c()};\n")
+    out.emit("default:\n")
+    out.emit("    return -1;\n")
+    out.emit("}\n")
+    out.emit("}\n\n")
+    generate_fuse(analysis, out)
     out.emit("#endif // NEED_OPCODE_METADATA\n\n")
 
 
+def generate_fuse(analysis: Analysis, out: CWriter) -> None:
+    by_first: dict[str, list[Uop]] = {}
+    for uop in analysis.uops.values():
+        if uop.fused:
+            by_first.setdefault(uop.fused[0].name, []).append(uop)
+    out.emit("int _PyUop_Fuse(int first, int second)\n{\n")
+    out.emit("switch(first) {\n")
+    for first, fused in by_first.items():
+        out.emit(f"case {first}:\n")
+        out.emit("    switch(second) {\n")
+        for uop in fused:
+            out.emit(f"    case {uop.fused[1].name}:\n")
+            out.emit(f"        return {uop.name};\n")
+        out.emit("    }\n")
+        out.emit("    break;\n")
+    out.emit("}\n")
+    out.emit("return 0;\n")
+    out.emit("}\n\n")
+
+
 def generate_uop_metadata(
     filenames: list[str], analysis: Analysis, outfile: TextIO
 ) -> None:
@@ -89,6 +89,9 @@ do {                                                         \
 #undef WITHIN_STACK_BOUNDS
 #define WITHIN_STACK_BOUNDS() 1
 
+#define ENTER_INLINED_CALL(STACKSIZE) ((void)(STACKSIZE))
+#define LEAVE_INLINED_CALL() ((void)0)
+
 #define TIER_TWO 2
 
 __attribute__((preserve_none)) _Py_CODEUNIT *
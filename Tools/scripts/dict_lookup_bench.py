@@ -0,0 +1,40 @@
+#!/usr/bin/env python3
+#
+# Time lookup hits and misses in dicts of growing sizes, with int and str
+# keys.  Tables of 2**16 to 2**24 slots (about 43,000 to 11 million keys)
+# have tags, see DK_HAS_TAGS() in Objects/dictobject.c.
+
+import random
+import sys
+from time import perf_counter as now
+
+LOOKUPS = 1_000_000
+
+
+def bench(d, keys):
+    best = float('inf')
+    for _ in range(3):
+        t0 = now()
+        for k in keys:
+            k in d
+        best = min(best, now() - t0)
+    return best / len(keys) * 1e9
+
+
+def main():
+    sizes = [int(arg) for arg in sys.argv[1:]] or [
+        1_000, 40_000, 100_000, 1_000_000, 4_000_000]
+    print(f"{'keys':>10} {'kind':>5} {'hit ns':>8} {'miss ns':>8}")
+    for n in sizes:
+        ints = random.sample(range(1 << 60), 2 * n)
+        for kind, keys in (('int', ints), ('str', [f'k{k}' for k in ints])):
+            d = dict.fromkeys(keys[:n])
+            hits = random.choices(keys[:n], k=LOOKUPS)
+            misses = random.choices(keys[n:], k=LOOKUPS)
+            print(f"{n:10} {kind:>5} {bench(d, hits):8.1f}"
+                  f" {bench(d, misses):8.1f}")
+            del d
+
+
+if __name__ == '__main__':
+    main()
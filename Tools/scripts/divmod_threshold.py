@@ -1,55 +1,60 @@
 #!/usr/bin/env python3
 #
-# Determine threshold for switching from longobject.c divmod to
-# _pylong.int_divmod().
+# Determine the thresholds for switching from the school division of
+# longobject.c (x_divrem) to recursive division (bz_divrem).
+#
+# divmod() is timed against a long division done in blocks of fewer than
+# BZ_DIV_CUTOFF quotient digits, each of which uses the school algorithm.
+# Run it on a build with BZ_DIV_CUTOFF and BZ_DIV_LIMIT lowered to find
+# where the recursive division starts to win.
 
-from random import randrange
+import sys
+from random import getrandbits
 from time import perf_counter as now
-from _pylong import int_divmod as divmod_fast
 
-BITS_PER_DIGIT = 30
+BITS_PER_DIGIT = sys.int_info.bits_per_digit
+BZ_DIV_CUTOFF = 80  # from longobject.c
 
 
 def rand_digits(n):
-    top = 1 << (n * BITS_PER_DIGIT)
-    return randrange(top >> 1, top)
-
-
-def probe_den(nd):
-    den = rand_digits(nd)
-    count = 0
-    for nn in range(nd, nd + 3000):
-        num = rand_digits(nn)
+    bits = n * BITS_PER_DIGIT
+    return getrandbits(bits - 1) | 1 << (bits - 1)
+
+
+def school_divmod(num, den):
+    block = (BZ_DIV_CUTOFF - 1) * BITS_PER_DIGIT
+    mask = (1 << block) - 1
+    blocks = []
+    while num:
+        blocks.append(num & mask)
+        num >>= block
+    q = r = 0
+    for b in reversed(blocks):
+        qb, r = divmod(r << block | b, den)
+        q = q << block | qb
+    return q, r
+
+
+def best_time(func, num, den):
+    best = float('inf')
+    for _ in range(5):
         t0 = now()
-        e1, e2 = divmod(num, den)
-        t1 = now()
-        f1, f2 = divmod_fast(num, den)
-        t2 = now()
-        s1 = t1 - t0
-        s2 = t2 - t1
-        assert e1 == f1
-        assert e2 == f2
-        if s2 < s1:
-            count += 1
-            if count >= 3:
-                print(
-                    "for",
-                    nd,
-                    "denom digits,",
-                    nn - nd,
-                    "extra num digits is enough",
-                )
-                break
-        else:
-            count = 0
-    else:
-        print("for", nd, "denom digits, no num seems big enough")
+        result = func(num, den)
+        best = min(best, now() - t0)
+    return best, result
 
 
 def main():
-    for nd in range(30):
-        nd = (nd + 1) * 100
-        probe_den(nd)
+    print(f"{'den':>7} {'quot':>7} {'school':>10} {'divmod':>10}  ratio")
+    for nd in (40, 60, 80, 120, 200, 400, 1000, 3000):
+        den = rand_digits(nd)
+        for nq in (nd // 2, nd, 4 * nd):
+            num = rand_digits(nd + nq)
+            t1, r1 = best_time(school_divmod, num, den)
+            t2, r2 = best_time(divmod, num, den)
+            assert r1 == r2
+            print(f"{nd:7} {nq:7} {t1 * 1e6:10.1f} {t2 * 1e6:10.1f}"
+                  f"  {t2 / t1:5.2f}")
 
 
 if __name__ == '__main__':